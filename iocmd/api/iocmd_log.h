@@ -48,6 +48,18 @@
 #define IOCMD_FORCE_STRINGS_COPYING             IOCMD_FEATURE_DISABLED
 #endif
 
+/**
+ * If set to IOCMD_FEATURE_ENABLED then integer arguments of IOCMD_Log are stored in log buffer as LEB128 varints
+ * without type byte (signed ones zig-zag encoded), so small values and small negative values take 1 byte instead of 2-9.
+ * Logs stored in this way are marked in type of main string, so they are still decoded correctly by buffer readers.
+ * Gain is small - for logs of test application records are only about 3.9% shorter - so it pays off mostly when
+ * logs carry many small integer arguments.
+ * If set to IOCMD_FEATURE_DISABLED then integer arguments are stored as type byte followed by 1-8 significant bytes.
+ */
+#ifndef IOCMD_LOG_VARINT_ARGUMENTS
+#define IOCMD_LOG_VARINT_ARGUMENTS              IOCMD_FEATURE_DISABLED
+#endif
+
 /**
  * If set to IOCMD_FEATURE_ENABLED then library supports temporarily posponing all types of logs(entrances,
  * logs, data logging, data comparison, OS switch context logging). When logs are postponed, all calls of logging functions
@@ -64,6 +76,65 @@
 #define IOCMD_SUPPORT_ENTRANCE_LOGGING          IOCMD_FEATURE_ENABLED
 #endif
 
+/**
+ * Definition used if IOCMD_SUPPORT_ENTRANCE_LOGGING is defined to IOCMD_FEATURE_ENABLED.
+ * If set to IOCMD_FEATURE_ENABLED then functions enter / exit are not stored in logs buffers. Instead, enter and exit
+ * of the same function are paired per thread, time between them is measured (by IOCMD_OS_GET_CURRENT_TIME) and for every
+ * function there is collected number of calls, total / min / max time and histogram of times. Statistics are printed
+ * by command "prof". Entrances must be enabled (or quiet) on the log to profile its functions.
+ * If IOCMD_LOG_TRACE_EXPORT is enabled too then functions enter / exit are also stored in logs buffers as without profiler.
+ * Requires C11 atomics, _Thread_local and IOCMD_LOG_HIGH_RES_TIME or IOCMD_OS_GET_CURRENT_TIME defined by application.
+ */
+#ifndef IOCMD_LOG_PROFILER
+#define IOCMD_LOG_PROFILER                      IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * Definition used if IOCMD_LOG_PROFILER is defined to IOCMD_FEATURE_ENABLED.
+ * Maximum number of different functions which can be profiled. Functions entered when table is full are not profiled.
+ */
+#ifndef IOCMD_LOG_PROFILER_NUM_FUNCTIONS
+#define IOCMD_LOG_PROFILER_NUM_FUNCTIONS        32
+#endif
+
+/**
+ * Definition used if IOCMD_LOG_PROFILER is defined to IOCMD_FEATURE_ENABLED.
+ * Maximum depth of nested calls tracked per thread. Functions entered deeper are not profiled.
+ */
+#ifndef IOCMD_LOG_PROFILER_STACK_DEPTH
+#define IOCMD_LOG_PROFILER_STACK_DEPTH          32
+#endif
+
+/**
+ * Definition used if IOCMD_LOG_PROFILER is defined to IOCMD_FEATURE_ENABLED.
+ * Histogram of times is log-linear: every power of 2 is divided to 2^IOCMD_LOG_PROFILER_HISTOGRAM_PRECISION buckets.
+ * Default value 2 gives 4 buckets per power of 2 - maximum error of time read from histogram is 25%.
+ */
+#ifndef IOCMD_LOG_PROFILER_HISTOGRAM_PRECISION
+#define IOCMD_LOG_PROFILER_HISTOGRAM_PRECISION  2
+#endif
+
+/**
+ * Definition used if IOCMD_SUPPORT_ENTRANCE_LOGGING is defined to IOCMD_FEATURE_ENABLED.
+ * Compiler attribute which calls function _func when variable goes out of scope. Used by IOCMD_ENTER_FUNC_SCOPE.
+ * If compiler doesn't support such attribute then this macro shall be defined empty - then IOCMD_ENTER_FUNC_SCOPE
+ * logs only enter of function.
+ */
+#ifndef IOCMD_LOG_CLEANUP_ATTRIBUTE
+#define IOCMD_LOG_CLEANUP_ATTRIBUTE(_func)      __attribute__((cleanup(_func)))
+#endif
+
+/**
+ * If set to IOCMD_FEATURE_ENABLED then library provides IOCMD_Proc_Buffered_Logs_Trace - logs are read from buffers
+ * same as by IOCMD_Proc_Buffered_Logs but printed as Chrome trace-event JSON (opened by chrome://tracing or Perfetto UI):
+ * function enter / exit are begin / end of slices, logs are instant events and context switches are instant events
+ * on tracks of both threads. Context type is used as process id and context number as thread id of the event.
+ * Data logs and data comparisions are not exported. Requires IOCMD_LOG_PRINT_TIME.
+ */
+#ifndef IOCMD_LOG_TRACE_EXPORT
+#define IOCMD_LOG_TRACE_EXPORT                  IOCMD_FEATURE_DISABLED
+#endif
+
 /**
  * If set to IOCMD_FEATURE_ENABLED then library supports logging data buffers.
  * If set to IOCMD_FEATURE_DISABLED then functions for data logging don't exist.
@@ -98,6 +169,70 @@
 #define IOCMD_DATA_COMPARE_PRINT_BOTH_CONTEXTS  IOCMD_FEATURE_DISABLED
 #endif
 
+/**
+ * If set to IOCMD_FEATURE_ENABLED then IOCMD_Log_Data_Comparision compares both buffers during logging
+ * and stores in main / quiet buffer only rows (8 * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT bytes) which differ,
+ * instead of full copy of data1 and data2. Equal rows are printed as single "equal" line.
+ * If diff doesn't fit into IOCMD_LOG_DATA_COMPARE_DIFF_MAX_SIZE bytes or is not smaller than both buffers
+ * then both buffers are logged fully.
+ * If set to IOCMD_FEATURE_DISABLED then data1 and data2 are always logged fully.
+ */
+#ifndef IOCMD_LOG_DATA_COMPARE_DIFF_ONLY
+#define IOCMD_LOG_DATA_COMPARE_DIFF_ONLY        IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * Number of equal rows logged before and after every row which differs when IOCMD_LOG_DATA_COMPARE_DIFF_ONLY is enabled.
+ */
+#ifndef IOCMD_LOG_DATA_COMPARE_DIFF_CONTEXT_ROWS
+#define IOCMD_LOG_DATA_COMPARE_DIFF_CONTEXT_ROWS   0
+#endif
+
+/**
+ * Maximum size of diff stored for single comparison when IOCMD_LOG_DATA_COMPARE_DIFF_ONLY is enabled.
+ * Every stored row takes 2 bytes of row index and up to 2 * 8 * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT bytes of data.
+ * Must not be bigger than IOCMD_MAX_LOG__DATA_1_LENGTH.
+ */
+#ifndef IOCMD_LOG_DATA_COMPARE_DIFF_MAX_SIZE
+#define IOCMD_LOG_DATA_COMPARE_DIFF_MAX_SIZE    256
+#endif
+
+/**
+ * If set to IOCMD_FEATURE_ENABLED then data logged by IOCMD_Log_Data_Context is compressed (LZ77, byte oriented
+ * block format similar to LZ4; runs of equal bytes are encoded as matches with offset 1) before putting into main / quiet buffer
+ * and decompressed by IOCMD_Proc_Buffered_Logs. Data is stored uncompressed if compression doesn't make it smaller.
+ * If set to IOCMD_FEATURE_DISABLED then data is always stored as is.
+ */
+#ifndef IOCMD_LOG_DATA_COMPRESSION
+#define IOCMD_LOG_DATA_COMPRESSION              IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * Minimum size of data which is compressed when IOCMD_LOG_DATA_COMPRESSION is enabled.
+ */
+#ifndef IOCMD_LOG_DATA_COMPRESSION_THRESHOLD
+#define IOCMD_LOG_DATA_COMPRESSION_THRESHOLD    64
+#endif
+
+/**
+ * Size (as power of 2) of hash table used by compressor to find repeated sequences.
+ * Hash table takes 2 * (2 ^ IOCMD_LOG_DATA_COMPRESSION_HASH_BITS) bytes of stack during logging.
+ */
+#ifndef IOCMD_LOG_DATA_COMPRESSION_HASH_BITS
+#define IOCMD_LOG_DATA_COMPRESSION_HASH_BITS    9
+#endif
+
+/**
+ * If set to IOCMD_FEATURE_ENABLED then data logged by IOCMD_Log_Data_Context which doesn't fit into
+ * IOCMD_WORKING_BUF_RECOMMENDED_SIZE is stored as few logs (fragments) put one after another into main / quiet buffer.
+ * IOCMD_Proc_Buffered_Logs prints log line with first fragment and only data rows for next ones,
+ * so whole data is printed even if IOCMD_MAX_LOG__DATA_1_LENGTH is small.
+ * If set to IOCMD_FEATURE_DISABLED then data which doesn't fit is cut.
+ */
+#ifndef IOCMD_LOG_DATA_FRAGMENTATION
+#define IOCMD_LOG_DATA_FRAGMENTATION            IOCMD_FEATURE_DISABLED
+#endif
+
 /**
  * If set to IOCMD_FEATURE_ENABLED then library supports printing logs to the output immediately after putting to the buffer.
  * If set to IOCMD_FEATURE_DISABLED then functions for immediate printouts don't exist.
@@ -145,6 +280,143 @@
    ((((const char*)(_ptr)) >= ((const char*)IOCMD_PROGRAM_MEMORY_BEGIN)) && (((const char*)(_ptr)) <= ((const char*)IOCMD_PROGRAM_MEMORY_END)))
 #endif
 
+/**
+ * If set to IOCMD_FEATURE_ENABLED then main and quiet logs are kept in one ring buffer of size
+ * IOCMD_LOG_MAIN_BUF_SIZE + IOCMD_LOG_QUIET_BUF_SIZE instead of two separate buffers. Every log is stored only once,
+ * with flags saying if it belongs to main and / or quiet logs, so logs visible in both views don't occupy memory twice.
+ * Main view has its own read position, so IOCMD_Proc_Buffered_Logs(false, ...) prints every main log only once, same as
+ * with separate buffers. The difference is that oldest logs are removed from the common buffer regardless of view -
+ * big amount of quiet logs can remove main logs which were not printed yet.
+ * Requires both IOCMD_LOG_MAIN_BUF_SIZE and IOCMD_LOG_QUIET_BUF_SIZE bigger than 0.
+ * If set to IOCMD_FEATURE_DISABLED then logs visible in both views are copied to main and to quiet buffer.
+ */
+#ifndef IOCMD_LOG_SINGLE_STORAGE
+#define IOCMD_LOG_SINGLE_STORAGE                IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * If set to IOCMD_FEATURE_ENABLED then memory for main and quiet buffers is not reserved inside of the library.
+ * It is given by the application to IOCMD_Logs_Init_With_Memory (heap, mmap'ed, hugepage-backed or shared memory)
+ * and can be replaced in runtime by IOCMD_Logs_Change_Memory, so buffers size becomes a deployment parameter.
+ * IOCMD_LOG_MAIN_BUF_SIZE and IOCMD_LOG_QUIET_BUF_SIZE are then the maximal sizes of buffers which can be given
+ * (they still decide which buffers exist and the size of global counters stored in every log).
+ * IOCMD_Logs_Init is not available in this mode.
+ * If set to IOCMD_FEATURE_DISABLED then buffers are static tables of sizes IOCMD_LOG_MAIN_BUF_SIZE and IOCMD_LOG_QUIET_BUF_SIZE.
+ */
+#ifndef IOCMD_LOG_EXTERNAL_BUF_MEMORY
+#define IOCMD_LOG_EXTERNAL_BUF_MEMORY           IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * If set to IOCMD_FEATURE_ENABLED then, when the oldest logs must be removed from full main / quiet buffer, 1/8 of the buffer
+ * is released above requested size, so following logs don't have to remove oldest logs again. In overloaded system
+ * full buffer keeps then on average up to 1/16 of its size less logs.
+ * If set to IOCMD_FEATURE_DISABLED then the oldest logs are removed only until requested size is free,
+ * but not less than 1/8 of the buffer (in both cases up to position kept in index - see IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE).
+ */
+#ifndef IOCMD_LOG_REMOVE_LOGS_IN_BATCHES
+#define IOCMD_LOG_REMOVE_LOGS_IN_BATCHES        IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * Number of positions of logs kept for every main / quiet buffer, one about every 1 / IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE
+ * of the buffer; must be power of 2. When the oldest logs must be removed from full buffer, they are removed at once up to
+ * the first such position which frees requested size - lengths of removed logs are not read, so in overloaded system
+ * reclaiming space costs constant time per stored log. Buffer is released then up to 1 / IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE
+ * of its size more than requested.
+ * If set to 0 then lengths of the oldest logs are read one by one until requested size is free.
+ */
+#ifndef IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE
+#define IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE        32
+#endif
+
+/**
+ * If set to IOCMD_FEATURE_ENABLED then header of every log is stored in main / quiet buffer in compact form:
+ * global counters and time as difference to previous log in the same buffer, context and file name only when they changed.
+ * Every IOCMD_LOG_COMPACT_HEADER_KEYFRAME_PERIOD log stored in a buffer is a keyframe which doesn't depend on previous logs,
+ * and when buffer is full, oldest logs are always removed up to such log - logs which stay in the buffer can be always decoded.
+ * Headers are converted when logs are copied to main / quiet buffer, so this option requires
+ * IOCMD_LOG_COMPRESS_OUTSIDE_LOCK or IOCMD_LOG_LOCK_FREE_STAGING.
+ * If set to IOCMD_FEATURE_DISABLED then every log has full header.
+ */
+#ifndef IOCMD_LOG_COMPACT_HEADER
+#define IOCMD_LOG_COMPACT_HEADER                IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * Definition used if IOCMD_LOG_COMPACT_HEADER is defined to IOCMD_FEATURE_ENABLED.
+ * Every how many logs stored in a buffer keyframe is stored (1 - 255). Bigger value saves more memory,
+ * but more logs can be removed together with the oldest ones when buffer is full.
+ */
+#ifndef IOCMD_LOG_COMPACT_HEADER_KEYFRAME_PERIOD
+#define IOCMD_LOG_COMPACT_HEADER_KEYFRAME_PERIOD   16
+#endif
+
+/**
+ * If set to IOCMD_FEATURE_ENABLED then every IOCMD_EMERG - IOCMD_DEBUG_LO macro places one constant call site descriptor
+ * (log ID, level, file name, line, format, number of arguments and their types captured during compilation - C11 _Generic,
+ * or templates from iocmd_log.hpp in C++; types are 0 if compiler cannot capture them) in linker section IOCMD_LOG_CALL_SITES_SECTION
+ * and the log stores only 2-bytes index of its descriptor instead of line, file name and format.
+ * Descriptors of all logs in the program can be read by IOCMD_Log_Get_Call_Sites.
+ * Requires IOCMD_SUPPORT_VARIADIC_MACROS, compiler supporting IOCMD_LOG_CALL_SITE_ATTRIBUTE and linker which marks
+ * begin and end of the section with IOCMD_LOG_CALL_SITES_BEGIN / IOCMD_LOG_CALL_SITES_END symbols.
+ * Format and IOCMD__LINE__LOCAL / IOCMD__FILE__LOCAL used by these macros must be constants.
+ * If set to IOCMD_FEATURE_DISABLED then logs store line, file name and format.
+ */
+#ifndef IOCMD_LOG_CALL_SITE_DESCRIPTORS
+#define IOCMD_LOG_CALL_SITE_DESCRIPTORS         IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * Definitions used if IOCMD_LOG_CALL_SITE_DESCRIPTORS is defined to IOCMD_FEATURE_ENABLED.
+ * Name of linker section with call site descriptors; must be valid C identifier. Default begin / end symbols
+ * and attribute are for GCC / clang with GNU ld or lld, which define __start_<section> and __stop_<section> symbols.
+ * Attribute sets alignment explicitly, so the compiler doesn't add padding between descriptors of different files.
+ */
+#ifndef IOCMD_LOG_CALL_SITES_SECTION
+#define IOCMD_LOG_CALL_SITES_SECTION            iocmd_call_sites
+#endif
+
+#ifndef IOCMD_LOG_CALL_SITE_ATTRIBUTE
+#define IOCMD_LOG_CALL_SITE_ATTRIBUTE \
+   __attribute__((section(IOCMD_LOG_STRINGIFY(IOCMD_LOG_CALL_SITES_SECTION)), used, aligned(sizeof(void*))))
+#endif
+
+#ifndef IOCMD_LOG_CALL_SITES_BEGIN
+#define IOCMD_LOG_CALL_SITES_BEGIN              IOCMD_LOG_CONCAT(__start_, IOCMD_LOG_CALL_SITES_SECTION)
+#endif
+
+#ifndef IOCMD_LOG_CALL_SITES_END
+#define IOCMD_LOG_CALL_SITES_END                IOCMD_LOG_CONCAT(__stop_, IOCMD_LOG_CALL_SITES_SECTION)
+#endif
+
+/**
+ * Definition used if IOCMD_LOG_CALL_SITE_DESCRIPTORS is defined to IOCMD_FEATURE_ENABLED.
+ * If set to IOCMD_FEATURE_ENABLED then types of arguments stored in call site descriptor are used when log is stored.
+ * Arguments of such logs are copied to log buffer according to their types, without parsing the format;
+ * format is parsed only when log is printed. Logs with argument of other type than integer, floating point,
+ * char pointer or void pointer (signed / unsigned char pointers are treated as void pointers), and all logs when types
+ * cannot be captured (compiler older than C11), are processed as before. Types are checked against the format once,
+ * by first log of the call site - every char pointer must be consumed by %s and every %s must get char pointer,
+ * otherwise the call site also falls back to parsing the format.
+ * If set to IOCMD_FEATURE_DISABLED then format of every log is parsed when log is stored.
+ */
+#ifndef IOCMD_LOG_TYPED_ARGUMENTS
+#define IOCMD_LOG_TYPED_ARGUMENTS               IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * If set to IOCMD_FEATURE_ENABLED then macros IOCMD_EMERG - IOCMD_DEBUG_LO, IOCMD_LOG_DATA_* and IOCMD_COMPARE_DATA_*
+ * compare level of the log with global table IOCMD_Log_Effective_Levels (highest level which currently reaches main
+ * or quiet buffer) before arguments are evaluated and function is called. Table is recomputed only when levels are changed
+ * (IOCMD_Logs_Init, IOCMD_Set_All_Logs, IOCMD_Set_Temporary_* / IOCMD_Clear_Temporary_* and iocmd_cmd commands),
+ * so log disabled on runtime costs one load and one comparison. Arguments of such log are not evaluated at all.
+ * If set to IOCMD_FEATURE_DISABLED then level is checked by called function, after evaluating arguments.
+ */
+#ifndef IOCMD_LOG_INLINE_LEVEL_CHECK
+#define IOCMD_LOG_INLINE_LEVEL_CHECK            IOCMD_FEATURE_DISABLED
+#endif
+
 
 /**
  * ----------------------------------------- MULTI-THREAD / MULTI-CONTEXT OPERATIONS PROTECTION --------------------------------
@@ -233,6 +505,74 @@
 #define IOCMD_EXIT_CRITICAL()
 #endif
 
+/**
+ * If set to IOCMD_FEATURE_ENABLED then IOCMD_Log compresses the log into buffer on the stack of the calling context
+ * (IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH bytes) before IOCMD_PROTECTION_LOCK is taken, so the lock is held only
+ * for removing old logs, copying the log to main / quiet buffer and updating counters - time proportional to log size instead
+ * of format complexity. Costs one additional copy of the log.
+ * If set to IOCMD_FEATURE_DISABLED then IOCMD_Log compresses the log directly in main / quiet buffer under the lock.
+ * Not used when IOCMD_LOG_LOCK_FREE_STAGING is enabled - then logs are always compressed outside of the lock.
+ */
+#ifndef IOCMD_LOG_COMPRESS_OUTSIDE_LOCK
+#define IOCMD_LOG_COMPRESS_OUTSIDE_LOCK         IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * If set to IOCMD_FEATURE_ENABLED then IOCMD_Log doesn't hold IOCMD_PROTECTION_LOCK while the log is being compressed.
+ * Every writer reserves a slot in lock-free staging ring (C11 atomics are required), fills it and publishes it.
+ * Published logs are moved in order to main / quiet buffer (and get their global counters) in batches: by IOCMD_Proc_Buffered_Logs,
+ * by any other logging function which takes the lock, or by the writer which fills the ring up to IOCMD_LOG_STAGING_TRANSFER_THRESHOLD.
+ * Other writers don't touch the lock at all. It is intended for systems where many threads log in parallel.
+ * If set to IOCMD_FEATURE_DISABLED then IOCMD_Log builds every log directly in main / quiet buffer under the lock.
+ */
+#ifndef IOCMD_LOG_LOCK_FREE_STAGING
+#define IOCMD_LOG_LOCK_FREE_STAGING             IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * Definition used if IOCMD_LOG_LOCK_FREE_STAGING is defined to IOCMD_FEATURE_ENABLED.
+ * Number of slots in staging ring - must be power of 2. Every slot occupies IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH bytes.
+ * When all slots are busy, writer moves published logs to main / quiet buffer by itself, and if the oldest slot is still
+ * being filled by preempted writer, it stores its own log directly under the lock.
+ */
+#ifndef IOCMD_LOG_STAGING_NUM_SLOTS
+#define IOCMD_LOG_STAGING_NUM_SLOTS             32
+#endif
+
+/**
+ * Definition used if IOCMD_LOG_LOCK_FREE_STAGING is defined to IOCMD_FEATURE_ENABLED.
+ * Number of published logs waiting in staging ring after which writer moves them to main / quiet buffer (if no other writer
+ * does it at the moment). Must be in range 1 - IOCMD_LOG_STAGING_NUM_SLOTS; 1 means the lock is taken after every log.
+ */
+#ifndef IOCMD_LOG_STAGING_TRANSFER_THRESHOLD
+#define IOCMD_LOG_STAGING_TRANSFER_THRESHOLD    (IOCMD_LOG_STAGING_NUM_SLOTS / 2)
+#endif
+
+/**
+ * Definition used if IOCMD_LOG_LOCK_FREE_STAGING is defined to IOCMD_FEATURE_ENABLED.
+ * Number of staging rings owned by single threads. Each of first IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS threads which log gets
+ * its own ring when it logs first time, so writers don't share any ring slots and don't take the lock after every log -
+ * their logs are moved to main / quiet buffer (merged with logs of other rings by publishing order) when IOCMD_Proc_Buffered_Logs
+ * or other logging function takes the lock, or when the ring becomes full. Threads which don't get own ring use common ring
+ * sized by IOCMD_LOG_STAGING_NUM_SLOTS.
+ * Application must call IOCMD_Log_Thread_Exit at the end of every thread which logs - the library does not depend on
+ * threads API of any OS, so it cannot see that a thread finished (with POSIX threads it can be called e.g. from destructor
+ * of pthread key). Rings of threads which finished without calling it are never given back, so threads created later
+ * would use common ring.
+ * Requires C11 _Thread_local. If set to 0 then all threads use common ring.
+ */
+#ifndef IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS
+#define IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS     0
+#endif
+
+/**
+ * Definition used if IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS is bigger than 0.
+ * Number of slots in every thread's own staging ring - must be power of 2.
+ */
+#ifndef IOCMD_LOG_CONTEXT_STAGING_NUM_SLOTS
+#define IOCMD_LOG_CONTEXT_STAGING_NUM_SLOTS     64
+#endif
+
 
 /* ----------------------------------------- LOGGING ENVIRONEMENTAL CONDITIONS ------------------------------------------------- */
 
@@ -245,13 +585,51 @@
 #define IOCMD_LOG_PRINT_TIME                    IOCMD_FEATURE_ENABLED
 #endif
 
+/**
+ * Definition used if IOCMD_LOG_PRINT_TIME is defined to IOCMD_FEATURE_ENABLED.
+ * If set to IOCMD_FEATURE_ENABLED then library uses its own time source (requires POSIX clock_gettime):
+ * IOCMD_Time_DT is 64-bit and IOCMD_OS_GET_CURRENT_TIME is by default IOCMD_Log_Get_Time, which returns ticks of TSC
+ * (x86 with invariant TSC, if IOCMD_LOG_HIGH_RES_TIME_TSC is enabled) or nanoseconds of clock_gettime(CLOCK_MONOTONIC).
+ * TSC is calibrated against CLOCK_MONOTONIC by IOCMD_Logs_Init (which waits 1 ms for it) and again when logs are printed,
+ * each time interval from IOCMD_Logs_Init doubled. Time is printed in seconds with microseconds resolution,
+ * counted from IOCMD_Logs_Init or as wall-clock time (see IOCMD_LOG_HIGH_RES_TIME_WALL_CLOCK).
+ * If set to IOCMD_FEATURE_DISABLED then time is returned by IOCMD_OS_GET_CURRENT_TIME and printed as it is.
+ */
+#ifndef IOCMD_LOG_HIGH_RES_TIME
+#define IOCMD_LOG_HIGH_RES_TIME                 IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * Definition used if IOCMD_LOG_HIGH_RES_TIME is defined to IOCMD_FEATURE_ENABLED.
+ * If set to IOCMD_FEATURE_ENABLED then time is read from TSC when CPU supports invariant TSC.
+ * If set to IOCMD_FEATURE_DISABLED then time is always read by clock_gettime(CLOCK_MONOTONIC).
+ */
+#ifndef IOCMD_LOG_HIGH_RES_TIME_TSC
+#define IOCMD_LOG_HIGH_RES_TIME_TSC             IOCMD_FEATURE_ENABLED
+#endif
+
+/**
+ * Definition used if IOCMD_LOG_HIGH_RES_TIME is defined to IOCMD_FEATURE_ENABLED.
+ * If set to IOCMD_FEATURE_ENABLED then time of log is printed as UTC time of day: [HH:MM:SS.uuuuuu].
+ * If set to IOCMD_FEATURE_DISABLED then time of log is printed as time from IOCMD_Logs_Init: [seconds.uuuuuu].
+ */
+#ifndef IOCMD_LOG_HIGH_RES_TIME_WALL_CLOCK
+#define IOCMD_LOG_HIGH_RES_TIME_WALL_CLOCK      IOCMD_FEATURE_DISABLED
+#endif
+
 /**
  * If IOCMD_LOG_PRINT_TIME was declared to IOCMD_FEATURE_ENABLED then this macro will be used by library to get system time in miliseconds.
  * For this reason this macro shall be re-defined to some mechanism (function or reading global variable) which will return
  * current system time.
  */
 #ifndef IOCMD_OS_GET_CURRENT_TIME
+#if(IOCMD_LOG_HIGH_RES_TIME)
+#define IOCMD_OS_GET_CURRENT_TIME()             IOCMD_Log_Get_Time()
+#else
 #define IOCMD_OS_GET_CURRENT_TIME()             0
+/* time is not measured - features which need it (profiler) are rejected */
+#define IOCMD_OS_GET_CURRENT_TIME_NOT_PROVIDED
+#endif
 #endif
 
 /**
@@ -662,7 +1040,10 @@ typedef enum IOCMD_Log_Level_Enum_Tag
 
    /* 27 - 38 - reserved for internal marking data compare on levels "EMERG" - "DEBUG_LO" */
    IOCMD_LOG_DATA_COMPARE_CONTEXT_BEGIN= IOCMD_LOG_DATA_PRINT_CONTEXT_END + 1,
-   IOCMD_LOG_DATA_COMPARE_CONTEXT_END  = IOCMD_LOG_DATA_COMPARE_CONTEXT_BEGIN + IOCMD_LOG_LEVEL_DEBUG_LO
+   IOCMD_LOG_DATA_COMPARE_CONTEXT_END  = IOCMD_LOG_DATA_COMPARE_CONTEXT_BEGIN + IOCMD_LOG_LEVEL_DEBUG_LO,
+
+   /* 39 - internal marking of log which stores index of call site descriptor instead of line, file name and format */
+   IOCMD_LOG_CALL_SITE                 = IOCMD_LOG_DATA_COMPARE_CONTEXT_END + 1
 }IOCMD_Log_Level_ET; /* gcc -fshort-enums */
 
 typedef enum IOCMD_Entrance_Logging_Enum_Tag
@@ -751,8 +1132,79 @@ typedef uint8_t IOCMD_Context_Type_DT;
 
 
 #ifndef IOCMD_TIME_DT_EXTERNAL
+#if(IOCMD_LOG_HIGH_RES_TIME)
+typedef uint64_t IOCMD_Time_DT;
+#else
 typedef uint32_t IOCMD_Time_DT;
 #endif
+#endif
+
+#if(IOCMD_SUPPORT_ENTRANCE_LOGGING)
+/**
+ * Scope of function declared by IOCMD_ENTER_FUNC_SCOPE - keeps everything needed to log exit of function
+ */
+typedef struct IOCMD_Log_Scope_eXtendedTag
+{
+   const char       *file;
+   const char       *func_name;
+   uint16_t          line;
+   IOCMD_Log_ID_DT   id;
+   IOCMD_Bool_DT     enabled;
+}IOCMD_Log_Scope_XT;
+#endif
+
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+#if(IOCMD_LOG_TYPED_ARGUMENTS && (!defined(__cplusplus)))
+#include <stdatomic.h>
+/* IOCMD_Log_Arg_Types_Check_ET of the call site - written by first log of every context; iocmd_log.hpp defines it for C++ */
+typedef atomic_uint_least8_t IOCMD_Log_Arg_Types_Check_DT;
+#endif
+
+/**
+ * Call site descriptor - one for every IOCMD_EMERG - IOCMD_DEBUG_LO macro in the program, placed in IOCMD_LOG_CALL_SITES_SECTION
+ */
+typedef struct IOCMD_Log_Call_Site_eXtendedTag
+{
+   const char       *file;
+   const char       *format;
+   uint16_t          line;
+   uint8_t           level;
+   /* number of arguments after format */
+   uint8_t           num_args;
+   IOCMD_Log_ID_DT   id;
+   /* 4 bits (IOCMD_Log_Arg_Type_ET) for every argument after format, first argument in the lowest bits */
+   uint64_t          arg_types;
+#if(IOCMD_LOG_TYPED_ARGUMENTS)
+   /* IOCMD_Log_Arg_Types_Check_ET - result of checking arg_types against format, done by first log of the call site */
+   IOCMD_Log_Arg_Types_Check_DT *arg_types_check;
+#endif
+}IOCMD_Log_Call_Site_XT;
+
+typedef enum IOCMD_Log_Arg_Type_Enum_Tag
+{
+   IOCMD_LOG_ARG_UNKNOWN         = 0,
+   /* int and smaller integers - promoted to int */
+   IOCMD_LOG_ARG_INT             = 1,
+   IOCMD_LOG_ARG_LONG            = 2,
+   IOCMD_LOG_ARG_LONG_LONG       = 3,
+   /* float and double - float is promoted to double */
+   IOCMD_LOG_ARG_DOUBLE          = 4,
+   IOCMD_LOG_ARG_LONG_DOUBLE     = 5,
+   IOCMD_LOG_ARG_STRING          = 6,
+   IOCMD_LOG_ARG_POINTER         = 7
+}IOCMD_Log_Arg_Type_ET;
+
+#if(IOCMD_LOG_TYPED_ARGUMENTS)
+typedef enum IOCMD_Log_Arg_Types_Check_Enum_Tag
+{
+   IOCMD_LOG_ARG_TYPES_NOT_CHECKED  = 0,
+   /* every argument has known type and only char pointers are consumed by %s */
+   IOCMD_LOG_ARG_TYPES_VALID        = 1,
+   /* arguments are stored by parsing format */
+   IOCMD_LOG_ARG_TYPES_INVALID      = 2
+}IOCMD_Log_Arg_Types_Check_ET;
+#endif
+#endif
 
 
 /**
@@ -801,6 +1253,20 @@ typedef uint32_t IOCMD_Time_DT;
 
 #endif
 
+#ifdef IOCMD_RUNTIME_SWITCH_LOG
+#undef IOCMD_RUNTIME_SWITCH_LOG
+#endif
+#ifdef IOCMD_SWITCH_LOG
+#undef IOCMD_SWITCH_LOG
+#endif
+#if(IOCMD_LOG_INLINE_LEVEL_CHECK)
+#define IOCMD_RUNTIME_SWITCH_LOG(_id, _level)         ((uint_fast8_t)(_level) <= IOCMD_Log_Effective_Levels[_id])
+#else
+#define IOCMD_RUNTIME_SWITCH_LOG(_id, _level)         1
+#endif
+/* compilation switch goes first, so logs disabled on compilation level are still removed from program image */
+#define IOCMD_SWITCH_LOG(_id, _level)                 (IOCMD_COMPILATION_SWITCH_LOG(_id, _level) && IOCMD_RUNTIME_SWITCH_LOG(_id, _level))
+
 
 /**
  * below collection of macros shall be used to implement entrances / logs / data / comparision recording from program
@@ -812,267 +1278,570 @@ typedef uint32_t IOCMD_Time_DT;
 
 #define IOCMD_EXIT_FUNC(id)                                                                           if(IOCMD_COMPILATION_SWITCH_ENT(id))                              IOCMD_Enter_Exit(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EXT_EXIT,  IOCMD__FILE__LOCAL, IOCMD__FUNCTION__LOCAL)
 
+/**
+ * logs enter of function and exit of function when the scope in which macro is used is left (by any return),
+ * so exit cannot be missed. Shall be used only once in a scope.
+ */
+#define IOCMD_ENTER_FUNC_SCOPE(id)                                                                    \
+   const IOCMD_Log_Scope_XT iocmd_log_scope IOCMD_LOG_CLEANUP_ATTRIBUTE(IOCMD_Exit_Scope) =          \
+      {IOCMD__FILE__LOCAL, IOCMD__FUNCTION__LOCAL, IOCMD__LINE__LOCAL, id, (IOCMD_COMPILATION_SWITCH_ENT(id)) ? IOCMD_TRUE : IOCMD_FALSE}; \
+   IOCMD_ENTER_FUNC(id)
+
 #else
 
 #define IOCMD_ENTER_FUNC(id)
 
 #define IOCMD_EXIT_FUNC(id)
 
+#define IOCMD_ENTER_FUNC_SCOPE(id)
+
+#endif
+
+
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+
+#define _IOCMD_LOG_STRINGIFY(x)                 #x
+#define IOCMD_LOG_STRINGIFY(x)                  _IOCMD_LOG_STRINGIFY(x)
+#define _IOCMD_LOG_CONCAT(a, b)                 a ## b
+#define IOCMD_LOG_CONCAT(a, b)                  _IOCMD_LOG_CONCAT(a, b)
+
+#define _IOCMD_LOG_CALL_SITE_FORMAT(format, ...)   format
+#define _IOCMD_LOG_CALL_SITE_NUM_ARGS(format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG, num, ...)   num
+#define IOCMD_LOG_CALL_SITE_NUM_ARGS(...) \
+   _IOCMD_LOG_CALL_SITE_NUM_ARGS(__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, ~)
+
+#ifndef IOCMD_LOG_CALL_SITE_ARG_TYPES
+#if(defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L))
+
+#define IOCMD_LOG_ARG_TYPE(a, n)    ((uint64_t)_Generic((a),                                                        \
+   char: IOCMD_LOG_ARG_INT,               signed char: IOCMD_LOG_ARG_INT,        unsigned char: IOCMD_LOG_ARG_INT,      \
+   short: IOCMD_LOG_ARG_INT,              unsigned short: IOCMD_LOG_ARG_INT,     _Bool: IOCMD_LOG_ARG_INT,              \
+   int: IOCMD_LOG_ARG_INT,                unsigned int: IOCMD_LOG_ARG_INT,                                              \
+   long: IOCMD_LOG_ARG_LONG,              unsigned long: IOCMD_LOG_ARG_LONG,                                            \
+   long long: IOCMD_LOG_ARG_LONG_LONG,    unsigned long long: IOCMD_LOG_ARG_LONG_LONG,                                  \
+   float: IOCMD_LOG_ARG_DOUBLE,           double: IOCMD_LOG_ARG_DOUBLE,          long double: IOCMD_LOG_ARG_LONG_DOUBLE,\
+   char*: IOCMD_LOG_ARG_STRING,           const char*: IOCMD_LOG_ARG_STRING,                                            \
+   signed char*: IOCMD_LOG_ARG_POINTER,   const signed char*: IOCMD_LOG_ARG_POINTER,                                    \
+   unsigned char*: IOCMD_LOG_ARG_POINTER, const unsigned char*: IOCMD_LOG_ARG_POINTER,                                  \
+   void*: IOCMD_LOG_ARG_POINTER,          const void*: IOCMD_LOG_ARG_POINTER,                                           \
+   default: IOCMD_LOG_ARG_UNKNOWN) << (4U * (n)))
+
+#define _IOCMD_LOG_ARG_TYPES_0( f)                                                          0U
+#define _IOCMD_LOG_ARG_TYPES_1( f, a1)                                                      IOCMD_LOG_ARG_TYPE(a1, 0)
+#define _IOCMD_LOG_ARG_TYPES_2( f, a1, a2)                                                  (_IOCMD_LOG_ARG_TYPES_1( f, a1) | IOCMD_LOG_ARG_TYPE(a2, 1))
+#define _IOCMD_LOG_ARG_TYPES_3( f, a1, a2, a3)                                              (_IOCMD_LOG_ARG_TYPES_2( f, a1, a2) | IOCMD_LOG_ARG_TYPE(a3, 2))
+#define _IOCMD_LOG_ARG_TYPES_4( f, a1, a2, a3, a4)                                          (_IOCMD_LOG_ARG_TYPES_3( f, a1, a2, a3) | IOCMD_LOG_ARG_TYPE(a4, 3))
+#define _IOCMD_LOG_ARG_TYPES_5( f, a1, a2, a3, a4, a5)                                      (_IOCMD_LOG_ARG_TYPES_4( f, a1, a2, a3, a4) | IOCMD_LOG_ARG_TYPE(a5, 4))
+#define _IOCMD_LOG_ARG_TYPES_6( f, a1, a2, a3, a4, a5, a6)                                  (_IOCMD_LOG_ARG_TYPES_5( f, a1, a2, a3, a4, a5) | IOCMD_LOG_ARG_TYPE(a6, 5))
+#define _IOCMD_LOG_ARG_TYPES_7( f, a1, a2, a3, a4, a5, a6, a7)                              (_IOCMD_LOG_ARG_TYPES_6( f, a1, a2, a3, a4, a5, a6) | IOCMD_LOG_ARG_TYPE(a7, 6))
+#define _IOCMD_LOG_ARG_TYPES_8( f, a1, a2, a3, a4, a5, a6, a7, a8)                          (_IOCMD_LOG_ARG_TYPES_7( f, a1, a2, a3, a4, a5, a6, a7) | IOCMD_LOG_ARG_TYPE(a8, 7))
+#define _IOCMD_LOG_ARG_TYPES_9( f, a1, a2, a3, a4, a5, a6, a7, a8, a9)                      (_IOCMD_LOG_ARG_TYPES_8( f, a1, a2, a3, a4, a5, a6, a7, a8) | IOCMD_LOG_ARG_TYPE(a9, 8))
+#define _IOCMD_LOG_ARG_TYPES_10(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                  (_IOCMD_LOG_ARG_TYPES_9( f, a1, a2, a3, a4, a5, a6, a7, a8, a9) | IOCMD_LOG_ARG_TYPE(aA, 9))
+#define _IOCMD_LOG_ARG_TYPES_11(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)              (_IOCMD_LOG_ARG_TYPES_10(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA) | IOCMD_LOG_ARG_TYPE(aB, 10))
+#define _IOCMD_LOG_ARG_TYPES_12(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)          (_IOCMD_LOG_ARG_TYPES_11(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB) | IOCMD_LOG_ARG_TYPE(aC, 11))
+#define _IOCMD_LOG_ARG_TYPES_13(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)      (_IOCMD_LOG_ARG_TYPES_12(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC) | IOCMD_LOG_ARG_TYPE(aD, 12))
+#define _IOCMD_LOG_ARG_TYPES_14(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)  (_IOCMD_LOG_ARG_TYPES_13(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD) | IOCMD_LOG_ARG_TYPE(aE, 13))
+#define _IOCMD_LOG_ARG_TYPES_15(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF) \
+   (_IOCMD_LOG_ARG_TYPES_14(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE) | IOCMD_LOG_ARG_TYPE(aF, 14))
+#define _IOCMD_LOG_ARG_TYPES_16(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG) \
+   (_IOCMD_LOG_ARG_TYPES_15(f, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF) | IOCMD_LOG_ARG_TYPE(aG, 15))
+
+/** Types of arguments after format (first argument of __VA_ARGS__) packed to IOCMD_Log_Call_Site_XT.arg_types */
+#define IOCMD_LOG_CALL_SITE_ARG_TYPES(...) \
+   IOCMD_LOG_CONCAT(_IOCMD_LOG_ARG_TYPES_, IOCMD_LOG_CALL_SITE_NUM_ARGS(__VA_ARGS__))(__VA_ARGS__)
+
+#else
+/* types cannot be captured - format of logs with arguments is parsed when log is stored */
+#define IOCMD_LOG_CALL_SITE_ARG_TYPES(...)      0U
+#endif
 #endif
 
+#if(IOCMD_LOG_TYPED_ARGUMENTS)
+#define _IOCMD_LOG_CALL_SITE_ARG_TYPES_FIELD(...)  , IOCMD_LOG_CALL_SITE_ARG_TYPES(__VA_ARGS__), &iocmd_log_call_site_check
+/* zero initialized - IOCMD_LOG_ARG_TYPES_NOT_CHECKED */
+#define _IOCMD_LOG_CALL_SITE_ARG_TYPES_CHECK        static IOCMD_Log_Arg_Types_Check_DT iocmd_log_call_site_check;
+#else
+#define _IOCMD_LOG_CALL_SITE_ARG_TYPES_FIELD(...)  , IOCMD_LOG_CALL_SITE_ARG_TYPES(__VA_ARGS__)
+#define _IOCMD_LOG_CALL_SITE_ARG_TYPES_CHECK
+#endif
+
+/**
+ * Creates call site descriptor of the log in IOCMD_LOG_CALL_SITES_SECTION and logs with it; format passed as first
+ * argument of __VA_ARGS__ must be a string literal
+ */
+#define IOCMD_LOG_CALL_SITE(id, level, ...) \
+   if(IOCMD_SWITCH_LOG(id, level)) do \
+   { \
+      _IOCMD_LOG_CALL_SITE_ARG_TYPES_CHECK \
+      static const IOCMD_Log_Call_Site_XT IOCMD_LOG_CALL_SITE_ATTRIBUTE iocmd_log_call_site = \
+      { \
+         IOCMD__FILE__LOCAL, _IOCMD_LOG_CALL_SITE_FORMAT(__VA_ARGS__, ~), (uint16_t)(IOCMD__LINE__LOCAL), (uint8_t)(level), \
+         (uint8_t)IOCMD_LOG_CALL_SITE_NUM_ARGS(__VA_ARGS__), (IOCMD_Log_ID_DT)(id) _IOCMD_LOG_CALL_SITE_ARG_TYPES_FIELD(__VA_ARGS__) \
+      }; \
+      IOCMD_Log_Call_Site(&iocmd_log_call_site, __VA_ARGS__); \
+   } while(0)
+
+#define IOCMD_EMERG(id, ...)                                                                          IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      __VA_ARGS__)
+#define IOCMD_EMERG_1(id,  format, a1)                                                                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1)
+#define IOCMD_EMERG_2(id,  format, a1, a2)                                                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2)
+#define IOCMD_EMERG_3(id,  format, a1, a2, a3)                                                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3)
+#define IOCMD_EMERG_4(id,  format, a1, a2, a3, a4)                                                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4)
+#define IOCMD_EMERG_5(id,  format, a1, a2, a3, a4, a5)                                                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5)
+#define IOCMD_EMERG_6(id,  format, a1, a2, a3, a4, a5, a6)                                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_EMERG_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_EMERG_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_EMERG_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_EMERG_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_EMERG_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_EMERG_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_EMERG_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_EMERG_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_EMERG_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_EMERG_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_EMERG,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_ALERT(id, ...)                                                                          IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      __VA_ARGS__)
+#define IOCMD_ALERT_1(id,  format, a1)                                                                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1)
+#define IOCMD_ALERT_2(id,  format, a1, a2)                                                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2)
+#define IOCMD_ALERT_3(id,  format, a1, a2, a3)                                                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3)
+#define IOCMD_ALERT_4(id,  format, a1, a2, a3, a4)                                                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4)
+#define IOCMD_ALERT_5(id,  format, a1, a2, a3, a4, a5)                                                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5)
+#define IOCMD_ALERT_6(id,  format, a1, a2, a3, a4, a5, a6)                                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_ALERT_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_ALERT_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_ALERT_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_ALERT_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_ALERT_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_ALERT_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_ALERT_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_ALERT_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_ALERT_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_ALERT_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ALERT,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_CRIT(id, ...)                                                                           IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       __VA_ARGS__)
+#define IOCMD_CRIT_1(id,  format, a1)                                                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1)
+#define IOCMD_CRIT_2(id,  format, a1, a2)                                                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2)
+#define IOCMD_CRIT_3(id,  format, a1, a2, a3)                                                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3)
+#define IOCMD_CRIT_4(id,  format, a1, a2, a3, a4)                                                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4)
+#define IOCMD_CRIT_5(id,  format, a1, a2, a3, a4, a5)                                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5)
+#define IOCMD_CRIT_6(id,  format, a1, a2, a3, a4, a5, a6)                                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_CRIT_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_CRIT_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_CRIT_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_CRIT_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_CRIT_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_CRIT_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_CRIT_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_CRIT_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_CRIT_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_CRIT_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_CRIT,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_ERROR(id, ...)                                                                          IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      __VA_ARGS__)
+#define IOCMD_ERROR_1(id,  format, a1)                                                                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1)
+#define IOCMD_ERROR_2(id,  format, a1, a2)                                                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2)
+#define IOCMD_ERROR_3(id,  format, a1, a2, a3)                                                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3)
+#define IOCMD_ERROR_4(id,  format, a1, a2, a3, a4)                                                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4)
+#define IOCMD_ERROR_5(id,  format, a1, a2, a3, a4, a5)                                                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5)
+#define IOCMD_ERROR_6(id,  format, a1, a2, a3, a4, a5, a6)                                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_ERROR_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_ERROR_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_ERROR_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_ERROR_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_ERROR_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_ERROR_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_ERROR_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_ERROR_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_ERROR_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_ERROR_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_ERROR,      format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_WARN(id, ...)                                                                           IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       __VA_ARGS__)
+#define IOCMD_WARN_1(id,  format, a1)                                                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1)
+#define IOCMD_WARN_2(id,  format, a1, a2)                                                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2)
+#define IOCMD_WARN_3(id,  format, a1, a2, a3)                                                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3)
+#define IOCMD_WARN_4(id,  format, a1, a2, a3, a4)                                                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4)
+#define IOCMD_WARN_5(id,  format, a1, a2, a3, a4, a5)                                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5)
+#define IOCMD_WARN_6(id,  format, a1, a2, a3, a4, a5, a6)                                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_WARN_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_WARN_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_WARN_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_WARN_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_WARN_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_WARN_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_WARN_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_WARN_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_WARN_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_WARN_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_WARN,       format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_NOTICE(id, ...)                                                                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     __VA_ARGS__)
+#define IOCMD_NOTICE_1(id,  format, a1)                                                               IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1)
+#define IOCMD_NOTICE_2(id,  format, a1, a2)                                                           IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2)
+#define IOCMD_NOTICE_3(id,  format, a1, a2, a3)                                                       IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3)
+#define IOCMD_NOTICE_4(id,  format, a1, a2, a3, a4)                                                   IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4)
+#define IOCMD_NOTICE_5(id,  format, a1, a2, a3, a4, a5)                                               IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5)
+#define IOCMD_NOTICE_6(id,  format, a1, a2, a3, a4, a5, a6)                                           IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_NOTICE_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                       IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_NOTICE_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                   IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_NOTICE_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                               IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_NOTICE_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                           IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_NOTICE_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                       IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_NOTICE_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                   IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_NOTICE_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)               IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_NOTICE_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)           IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_NOTICE_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)       IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_NOTICE_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)   IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_NOTICE,     format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_INFO_HI(id, ...)                                                                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    __VA_ARGS__)
+#define IOCMD_INFO_HI_1(id,  format, a1)                                                              IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1)
+#define IOCMD_INFO_HI_2(id,  format, a1, a2)                                                          IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2)
+#define IOCMD_INFO_HI_3(id,  format, a1, a2, a3)                                                      IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3)
+#define IOCMD_INFO_HI_4(id,  format, a1, a2, a3, a4)                                                  IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4)
+#define IOCMD_INFO_HI_5(id,  format, a1, a2, a3, a4, a5)                                              IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5)
+#define IOCMD_INFO_HI_6(id,  format, a1, a2, a3, a4, a5, a6)                                          IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_INFO_HI_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                      IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_INFO_HI_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                  IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_INFO_HI_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                              IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_INFO_HI_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                          IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_INFO_HI_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                      IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_INFO_HI_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                  IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_INFO_HI_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)              IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_INFO_HI_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)          IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_INFO_HI_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)      IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_INFO_HI_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)  IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_HI,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_INFO_MID(id, ...)                                                                       IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   __VA_ARGS__)
+#define IOCMD_INFO_MID_1(id,  format, a1)                                                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1)
+#define IOCMD_INFO_MID_2(id,  format, a1, a2)                                                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2)
+#define IOCMD_INFO_MID_3(id,  format, a1, a2, a3)                                                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3)
+#define IOCMD_INFO_MID_4(id,  format, a1, a2, a3, a4)                                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4)
+#define IOCMD_INFO_MID_5(id,  format, a1, a2, a3, a4, a5)                                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5)
+#define IOCMD_INFO_MID_6(id,  format, a1, a2, a3, a4, a5, a6)                                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_INFO_MID_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_INFO_MID_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_INFO_MID_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_INFO_MID_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_INFO_MID_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_INFO_MID_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_INFO_MID_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_INFO_MID_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_INFO_MID_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_INFO_MID_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG) IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_MID,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_INFO_LO(id, ...)                                                                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    __VA_ARGS__)
+#define IOCMD_INFO_LO_1(id,  format, a1)                                                              IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1)
+#define IOCMD_INFO_LO_2(id,  format, a1, a2)                                                          IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2)
+#define IOCMD_INFO_LO_3(id,  format, a1, a2, a3)                                                      IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3)
+#define IOCMD_INFO_LO_4(id,  format, a1, a2, a3, a4)                                                  IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4)
+#define IOCMD_INFO_LO_5(id,  format, a1, a2, a3, a4, a5)                                              IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5)
+#define IOCMD_INFO_LO_6(id,  format, a1, a2, a3, a4, a5, a6)                                          IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_INFO_LO_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                      IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_INFO_LO_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                  IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_INFO_LO_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                              IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_INFO_LO_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                          IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_INFO_LO_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                      IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_INFO_LO_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                  IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_INFO_LO_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)              IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_INFO_LO_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)          IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_INFO_LO_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)      IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_INFO_LO_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)  IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_INFO_LO,    format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_DEBUG_HI(id, ...)                                                                       IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   __VA_ARGS__)
+#define IOCMD_DEBUG_HI_1(id,  format, a1)                                                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1)
+#define IOCMD_DEBUG_HI_2(id,  format, a1, a2)                                                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2)
+#define IOCMD_DEBUG_HI_3(id,  format, a1, a2, a3)                                                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3)
+#define IOCMD_DEBUG_HI_4(id,  format, a1, a2, a3, a4)                                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4)
+#define IOCMD_DEBUG_HI_5(id,  format, a1, a2, a3, a4, a5)                                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5)
+#define IOCMD_DEBUG_HI_6(id,  format, a1, a2, a3, a4, a5, a6)                                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_DEBUG_HI_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_DEBUG_HI_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_DEBUG_HI_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_DEBUG_HI_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_DEBUG_HI_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_DEBUG_HI_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_DEBUG_HI_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_DEBUG_HI_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_DEBUG_HI_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_DEBUG_HI_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG) IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_HI,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_DEBUG_MID(id, ...)                                                                      IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  __VA_ARGS__)
+#define IOCMD_DEBUG_MID_1(id,  format, a1)                                                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1)
+#define IOCMD_DEBUG_MID_2(id,  format, a1, a2)                                                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2)
+#define IOCMD_DEBUG_MID_3(id,  format, a1, a2, a3)                                                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3)
+#define IOCMD_DEBUG_MID_4(id,  format, a1, a2, a3, a4)                                                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4)
+#define IOCMD_DEBUG_MID_5(id,  format, a1, a2, a3, a4, a5)                                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5)
+#define IOCMD_DEBUG_MID_6(id,  format, a1, a2, a3, a4, a5, a6)                                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_DEBUG_MID_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_DEBUG_MID_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_DEBUG_MID_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_DEBUG_MID_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_DEBUG_MID_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_DEBUG_MID_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_DEBUG_MID_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)            IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_DEBUG_MID_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)        IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_DEBUG_MID_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)    IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_DEBUG_MID_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_MID,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_DEBUG_LO(id, ...)                                                                       IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   __VA_ARGS__)
+#define IOCMD_DEBUG_LO_1(id,  format, a1)                                                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1)
+#define IOCMD_DEBUG_LO_2(id,  format, a1, a2)                                                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2)
+#define IOCMD_DEBUG_LO_3(id,  format, a1, a2, a3)                                                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3)
+#define IOCMD_DEBUG_LO_4(id,  format, a1, a2, a3, a4)                                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4)
+#define IOCMD_DEBUG_LO_5(id,  format, a1, a2, a3, a4, a5)                                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5)
+#define IOCMD_DEBUG_LO_6(id,  format, a1, a2, a3, a4, a5, a6)                                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_DEBUG_LO_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_DEBUG_LO_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_DEBUG_LO_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_DEBUG_LO_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_DEBUG_LO_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_DEBUG_LO_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                 IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_DEBUG_LO_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)             IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_DEBUG_LO_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)         IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_DEBUG_LO_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)     IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_DEBUG_LO_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG) IOCMD_LOG_CALL_SITE(id, IOCMD_LOG_LEVEL_DEBUG_LO,   format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+
+#else
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_EMERG(id, ...)                                                                          if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_EMERG(id, format)                                                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_EMERG_1(id,  format, a1)                                                                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_EMERG_2(id,  format, a1, a2)                                                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_EMERG_3(id,  format, a1, a2, a3)                                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_EMERG_4(id,  format, a1, a2, a3, a4)                                                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_EMERG_5(id,  format, a1, a2, a3, a4, a5)                                                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_EMERG_6(id,  format, a1, a2, a3, a4, a5, a6)                                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_EMERG_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_EMERG_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_EMERG_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_EMERG_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_EMERG_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_EMERG_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_EMERG_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_EMERG_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_EMERG_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_EMERG_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_EMERG(id, ...)                                                                          if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_EMERG(id, format)                                                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_EMERG_1(id,  format, a1)                                                                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_EMERG_2(id,  format, a1, a2)                                                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_EMERG_3(id,  format, a1, a2, a3)                                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_EMERG_4(id,  format, a1, a2, a3, a4)                                                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_EMERG_5(id,  format, a1, a2, a3, a4, a5)                                                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_EMERG_6(id,  format, a1, a2, a3, a4, a5, a6)                                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_EMERG_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_EMERG_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_EMERG_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_EMERG_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_EMERG_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_EMERG_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_EMERG_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_EMERG_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_EMERG_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_EMERG_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_ALERT(id, ...)                                                                          if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_ALERT(id, format)                                                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_ALERT_1(id,  format, a1)                                                                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_ALERT_2(id,  format, a1, a2)                                                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_ALERT_3(id,  format, a1, a2, a3)                                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_ALERT_4(id,  format, a1, a2, a3, a4)                                                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_ALERT_5(id,  format, a1, a2, a3, a4, a5)                                                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_ALERT_6(id,  format, a1, a2, a3, a4, a5, a6)                                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_ALERT_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_ALERT_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_ALERT_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_ALERT_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_ALERT_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_ALERT_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_ALERT_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_ALERT_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_ALERT_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_ALERT_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_ALERT(id, ...)                                                                          if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_ALERT(id, format)                                                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_ALERT_1(id,  format, a1)                                                                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_ALERT_2(id,  format, a1, a2)                                                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_ALERT_3(id,  format, a1, a2, a3)                                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_ALERT_4(id,  format, a1, a2, a3, a4)                                                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_ALERT_5(id,  format, a1, a2, a3, a4, a5)                                                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_ALERT_6(id,  format, a1, a2, a3, a4, a5, a6)                                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_ALERT_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_ALERT_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_ALERT_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_ALERT_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_ALERT_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_ALERT_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_ALERT_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_ALERT_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_ALERT_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_ALERT_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_CRIT(id, ...)                                                                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_CRIT(id, format)                                                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_CRIT_1(id,  format, a1)                                                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_CRIT_2(id,  format, a1, a2)                                                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_CRIT_3(id,  format, a1, a2, a3)                                                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_CRIT_4(id,  format, a1, a2, a3, a4)                                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_CRIT_5(id,  format, a1, a2, a3, a4, a5)                                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_CRIT_6(id,  format, a1, a2, a3, a4, a5, a6)                                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_CRIT_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_CRIT_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_CRIT_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_CRIT_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_CRIT_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_CRIT_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_CRIT_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_CRIT_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_CRIT_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_CRIT_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_CRIT(id, ...)                                                                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_CRIT(id, format)                                                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_CRIT_1(id,  format, a1)                                                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_CRIT_2(id,  format, a1, a2)                                                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_CRIT_3(id,  format, a1, a2, a3)                                                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_CRIT_4(id,  format, a1, a2, a3, a4)                                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_CRIT_5(id,  format, a1, a2, a3, a4, a5)                                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_CRIT_6(id,  format, a1, a2, a3, a4, a5, a6)                                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_CRIT_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_CRIT_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_CRIT_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_CRIT_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_CRIT_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_CRIT_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_CRIT_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_CRIT_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_CRIT_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_CRIT_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_ERROR(id, ...)                                                                          if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_ERROR(id, format)                                                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_ERROR_1(id,  format, a1)                                                                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_ERROR_2(id,  format, a1, a2)                                                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_ERROR_3(id,  format, a1, a2, a3)                                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_ERROR_4(id,  format, a1, a2, a3, a4)                                                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_ERROR_5(id,  format, a1, a2, a3, a4, a5)                                                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_ERROR_6(id,  format, a1, a2, a3, a4, a5, a6)                                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_ERROR_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_ERROR_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_ERROR_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_ERROR_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_ERROR_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_ERROR_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_ERROR_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_ERROR_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_ERROR_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_ERROR_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_ERROR(id, ...)                                                                          if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_ERROR(id, format)                                                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_ERROR_1(id,  format, a1)                                                                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_ERROR_2(id,  format, a1, a2)                                                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_ERROR_3(id,  format, a1, a2, a3)                                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_ERROR_4(id,  format, a1, a2, a3, a4)                                                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_ERROR_5(id,  format, a1, a2, a3, a4, a5)                                                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_ERROR_6(id,  format, a1, a2, a3, a4, a5, a6)                                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_ERROR_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_ERROR_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_ERROR_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_ERROR_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_ERROR_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_ERROR_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_ERROR_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_ERROR_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_ERROR_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_ERROR_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,    IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_WARN(id, ...)                                                                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_WARN(id, format)                                                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_WARN_1(id,  format, a1)                                                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_WARN_2(id,  format, a1, a2)                                                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_WARN_3(id,  format, a1, a2, a3)                                                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_WARN_4(id,  format, a1, a2, a3, a4)                                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_WARN_5(id,  format, a1, a2, a3, a4, a5)                                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_WARN_6(id,  format, a1, a2, a3, a4, a5, a6)                                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_WARN_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_WARN_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_WARN_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_WARN_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_WARN_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_WARN_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_WARN_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_WARN_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_WARN_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_WARN_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_WARN(id, ...)                                                                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_WARN(id, format)                                                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_WARN_1(id,  format, a1)                                                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_WARN_2(id,  format, a1, a2)                                                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_WARN_3(id,  format, a1, a2, a3)                                                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_WARN_4(id,  format, a1, a2, a3, a4)                                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_WARN_5(id,  format, a1, a2, a3, a4, a5)                                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_WARN_6(id,  format, a1, a2, a3, a4, a5, a6)                                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_WARN_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_WARN_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_WARN_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_WARN_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_WARN_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_WARN_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_WARN_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_WARN_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_WARN_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_WARN_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,     IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_NOTICE(id, ...)                                                                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_NOTICE(id, format)                                                                      if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_NOTICE_1(id,  format, a1)                                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_NOTICE_2(id,  format, a1, a2)                                                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_NOTICE_3(id,  format, a1, a2, a3)                                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_NOTICE_4(id,  format, a1, a2, a3, a4)                                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_NOTICE_5(id,  format, a1, a2, a3, a4, a5)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_NOTICE_6(id,  format, a1, a2, a3, a4, a5, a6)                                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_NOTICE_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_NOTICE_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_NOTICE_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_NOTICE_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_NOTICE_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_NOTICE_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_NOTICE_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_NOTICE_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_NOTICE_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_NOTICE_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_NOTICE(id, ...)                                                                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_NOTICE(id, format)                                                                      if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_NOTICE_1(id,  format, a1)                                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_NOTICE_2(id,  format, a1, a2)                                                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_NOTICE_3(id,  format, a1, a2, a3)                                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_NOTICE_4(id,  format, a1, a2, a3, a4)                                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_NOTICE_5(id,  format, a1, a2, a3, a4, a5)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_NOTICE_6(id,  format, a1, a2, a3, a4, a5, a6)                                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_NOTICE_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_NOTICE_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_NOTICE_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_NOTICE_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_NOTICE_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_NOTICE_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_NOTICE_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_NOTICE_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_NOTICE_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_NOTICE_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_INFO_HI(id, ...)                                                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_INFO_HI(id, format)                                                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_INFO_HI_1(id,  format, a1)                                                              if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_INFO_HI_2(id,  format, a1, a2)                                                          if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_INFO_HI_3(id,  format, a1, a2, a3)                                                      if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_INFO_HI_4(id,  format, a1, a2, a3, a4)                                                  if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_INFO_HI_5(id,  format, a1, a2, a3, a4, a5)                                              if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_INFO_HI_6(id,  format, a1, a2, a3, a4, a5, a6)                                          if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_INFO_HI_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                      if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_INFO_HI_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                  if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_INFO_HI_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                              if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_INFO_HI_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                          if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_INFO_HI_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                      if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_INFO_HI_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                  if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_INFO_HI_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)              if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_INFO_HI_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)          if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_INFO_HI_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)      if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_INFO_HI_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)  if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_INFO_HI(id, ...)                                                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_INFO_HI(id, format)                                                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_INFO_HI_1(id,  format, a1)                                                              if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_INFO_HI_2(id,  format, a1, a2)                                                          if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_INFO_HI_3(id,  format, a1, a2, a3)                                                      if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_INFO_HI_4(id,  format, a1, a2, a3, a4)                                                  if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_INFO_HI_5(id,  format, a1, a2, a3, a4, a5)                                              if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_INFO_HI_6(id,  format, a1, a2, a3, a4, a5, a6)                                          if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_INFO_HI_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                      if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_INFO_HI_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                  if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_INFO_HI_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                              if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_INFO_HI_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                          if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_INFO_HI_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                      if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_INFO_HI_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                  if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_INFO_HI_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)              if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_INFO_HI_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)          if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_INFO_HI_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)      if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_INFO_HI_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)  if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_INFO_MID(id, ...)                                                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_INFO_MID(id, format)                                                                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_INFO_MID_1(id,  format, a1)                                                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_INFO_MID_2(id,  format, a1, a2)                                                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_INFO_MID_3(id,  format, a1, a2, a3)                                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_INFO_MID_4(id,  format, a1, a2, a3, a4)                                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_INFO_MID_5(id,  format, a1, a2, a3, a4, a5)                                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_INFO_MID_6(id,  format, a1, a2, a3, a4, a5, a6)                                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_INFO_MID_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_INFO_MID_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_INFO_MID_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_INFO_MID_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_INFO_MID_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_INFO_MID_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_INFO_MID_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_INFO_MID_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_INFO_MID_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_INFO_MID_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG) if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_INFO_MID(id, ...)                                                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_INFO_MID(id, format)                                                                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_INFO_MID_1(id,  format, a1)                                                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_INFO_MID_2(id,  format, a1, a2)                                                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_INFO_MID_3(id,  format, a1, a2, a3)                                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_INFO_MID_4(id,  format, a1, a2, a3, a4)                                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_INFO_MID_5(id,  format, a1, a2, a3, a4, a5)                                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_INFO_MID_6(id,  format, a1, a2, a3, a4, a5, a6)                                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_INFO_MID_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_INFO_MID_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_INFO_MID_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_INFO_MID_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_INFO_MID_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_INFO_MID_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_INFO_MID_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_INFO_MID_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_INFO_MID_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_INFO_MID_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG) if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_INFO_LO(id, ...)                                                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_INFO_LO(id, format)                                                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_INFO_LO_1(id,  format, a1)                                                              if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_INFO_LO_2(id,  format, a1, a2)                                                          if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_INFO_LO_3(id,  format, a1, a2, a3)                                                      if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_INFO_LO_4(id,  format, a1, a2, a3, a4)                                                  if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_INFO_LO_5(id,  format, a1, a2, a3, a4, a5)                                              if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_INFO_LO_6(id,  format, a1, a2, a3, a4, a5, a6)                                          if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_INFO_LO_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                      if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_INFO_LO_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                  if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_INFO_LO_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                              if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_INFO_LO_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                          if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_INFO_LO_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                      if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_INFO_LO_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                  if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_INFO_LO_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)              if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_INFO_LO_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)          if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_INFO_LO_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)      if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_INFO_LO_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)  if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_INFO_LO(id, ...)                                                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_INFO_LO(id, format)                                                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_INFO_LO_1(id,  format, a1)                                                              if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_INFO_LO_2(id,  format, a1, a2)                                                          if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_INFO_LO_3(id,  format, a1, a2, a3)                                                      if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_INFO_LO_4(id,  format, a1, a2, a3, a4)                                                  if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_INFO_LO_5(id,  format, a1, a2, a3, a4, a5)                                              if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_INFO_LO_6(id,  format, a1, a2, a3, a4, a5, a6)                                          if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_INFO_LO_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                      if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_INFO_LO_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                  if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_INFO_LO_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                              if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_INFO_LO_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                          if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_INFO_LO_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                      if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_INFO_LO_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                  if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_INFO_LO_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)              if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_INFO_LO_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)          if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_INFO_LO_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)      if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_INFO_LO_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)  if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,   IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_DEBUG_HI(id, ...)                                                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_DEBUG_HI(id, format)                                                                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_DEBUG_HI_1(id,  format, a1)                                                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_DEBUG_HI_2(id,  format, a1, a2)                                                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_DEBUG_HI_3(id,  format, a1, a2, a3)                                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_DEBUG_HI_4(id,  format, a1, a2, a3, a4)                                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_DEBUG_HI_5(id,  format, a1, a2, a3, a4, a5)                                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_DEBUG_HI_6(id,  format, a1, a2, a3, a4, a5, a6)                                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_DEBUG_HI_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_DEBUG_HI_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_DEBUG_HI_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_DEBUG_HI_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_DEBUG_HI_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_DEBUG_HI_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_DEBUG_HI_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_DEBUG_HI_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_DEBUG_HI_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_DEBUG_HI_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG) if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_DEBUG_HI(id, ...)                                                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_DEBUG_HI(id, format)                                                                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_DEBUG_HI_1(id,  format, a1)                                                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_DEBUG_HI_2(id,  format, a1, a2)                                                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_DEBUG_HI_3(id,  format, a1, a2, a3)                                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_DEBUG_HI_4(id,  format, a1, a2, a3, a4)                                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_DEBUG_HI_5(id,  format, a1, a2, a3, a4, a5)                                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_DEBUG_HI_6(id,  format, a1, a2, a3, a4, a5, a6)                                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_DEBUG_HI_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_DEBUG_HI_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_DEBUG_HI_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_DEBUG_HI_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_DEBUG_HI_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_DEBUG_HI_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_DEBUG_HI_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_DEBUG_HI_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_DEBUG_HI_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_DEBUG_HI_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG) if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_DEBUG_MID(id, ...)                                                                      if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_DEBUG_MID(id, format)                                                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_DEBUG_MID_1(id,  format, a1)                                                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_DEBUG_MID_2(id,  format, a1, a2)                                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_DEBUG_MID_3(id,  format, a1, a2, a3)                                                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_DEBUG_MID_4(id,  format, a1, a2, a3, a4)                                                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_DEBUG_MID_5(id,  format, a1, a2, a3, a4, a5)                                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_DEBUG_MID_6(id,  format, a1, a2, a3, a4, a5, a6)                                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_DEBUG_MID_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_DEBUG_MID_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_DEBUG_MID_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_DEBUG_MID_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_DEBUG_MID_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_DEBUG_MID_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_DEBUG_MID_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)            if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_DEBUG_MID_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)        if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_DEBUG_MID_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_DEBUG_MID_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF,aG) if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_DEBUG_MID(id, ...)                                                                      if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_DEBUG_MID(id, format)                                                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_DEBUG_MID_1(id,  format, a1)                                                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_DEBUG_MID_2(id,  format, a1, a2)                                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_DEBUG_MID_3(id,  format, a1, a2, a3)                                                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_DEBUG_MID_4(id,  format, a1, a2, a3, a4)                                                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_DEBUG_MID_5(id,  format, a1, a2, a3, a4, a5)                                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_DEBUG_MID_6(id,  format, a1, a2, a3, a4, a5, a6)                                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_DEBUG_MID_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_DEBUG_MID_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_DEBUG_MID_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_DEBUG_MID_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_DEBUG_MID_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_DEBUG_MID_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_DEBUG_MID_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)            if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_DEBUG_MID_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)        if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_DEBUG_MID_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_DEBUG_MID_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF,aG) if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID, IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_DEBUG_LO(id, ...)                                                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, __VA_ARGS__)
-#else
-#define IOCMD_DEBUG_LO(id, format)                                                                    if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format)
-#endif
-#define IOCMD_DEBUG_LO_1(id,  format, a1)                                                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1)
-#define IOCMD_DEBUG_LO_2(id,  format, a1, a2)                                                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2)
-#define IOCMD_DEBUG_LO_3(id,  format, a1, a2, a3)                                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3)
-#define IOCMD_DEBUG_LO_4(id,  format, a1, a2, a3, a4)                                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
-#define IOCMD_DEBUG_LO_5(id,  format, a1, a2, a3, a4, a5)                                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
-#define IOCMD_DEBUG_LO_6(id,  format, a1, a2, a3, a4, a5, a6)                                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
-#define IOCMD_DEBUG_LO_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
-#define IOCMD_DEBUG_LO_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
-#define IOCMD_DEBUG_LO_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
-#define IOCMD_DEBUG_LO_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
-#define IOCMD_DEBUG_LO_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
-#define IOCMD_DEBUG_LO_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                 if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
-#define IOCMD_DEBUG_LO_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)             if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
-#define IOCMD_DEBUG_LO_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)         if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
-#define IOCMD_DEBUG_LO_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)     if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
-#define IOCMD_DEBUG_LO_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG) if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+#define IOCMD_DEBUG_LO(id, ...)                                                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, __VA_ARGS__)
+#else
+#define IOCMD_DEBUG_LO(id, format)                                                                    if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format)
+#endif
+#define IOCMD_DEBUG_LO_1(id,  format, a1)                                                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1)
+#define IOCMD_DEBUG_LO_2(id,  format, a1, a2)                                                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2)
+#define IOCMD_DEBUG_LO_3(id,  format, a1, a2, a3)                                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3)
+#define IOCMD_DEBUG_LO_4(id,  format, a1, a2, a3, a4)                                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4)
+#define IOCMD_DEBUG_LO_5(id,  format, a1, a2, a3, a4, a5)                                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5)
+#define IOCMD_DEBUG_LO_6(id,  format, a1, a2, a3, a4, a5, a6)                                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6)
+#define IOCMD_DEBUG_LO_7(id,  format, a1, a2, a3, a4, a5, a6, a7)                                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7)
+#define IOCMD_DEBUG_LO_8(id,  format, a1, a2, a3, a4, a5, a6, a7, a8)                                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8)
+#define IOCMD_DEBUG_LO_9(id,  format, a1, a2, a3, a4, a5, a6, a7, a8, a9)                             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9)
+#define IOCMD_DEBUG_LO_10(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)                         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA)
+#define IOCMD_DEBUG_LO_11(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)                     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB)
+#define IOCMD_DEBUG_LO_12(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)                 if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC)
+#define IOCMD_DEBUG_LO_13(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)             if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD)
+#define IOCMD_DEBUG_LO_14(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)         if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE)
+#define IOCMD_DEBUG_LO_15(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)     if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF)
+#define IOCMD_DEBUG_LO_16(id, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG) if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,  IOCMD__FILE__LOCAL, format, a1, a2, a3, a4, a5, a6, a7, a8, a9, aA, aB, aC, aD, aE, aF, aG)
+
+#endif /* #if(IOCMD_LOG_CALL_SITE_DESCRIPTORS) */
 
 #if(IOCMD_SUPPORT_DATA_LOGGING)
 
@@ -1082,112 +1851,112 @@ typedef uint32_t IOCMD_Time_DT;
 #endif
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_EMERG(      id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_EMERG(      id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_EMERG(      id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_EMERG(      id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_EMERG_1(    id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_EMERG_2(    id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_EMERG_3(    id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_EMERG_1(    id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_EMERG_2(    id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_EMERG_3(    id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_ALERT(      id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_ALERT(      id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_ALERT(      id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_ALERT(      id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_ALERT_1(    id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_ALERT_2(    id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_ALERT_3(    id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_ALERT_1(    id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_ALERT_2(    id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_ALERT_3(    id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_CRIT(       id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_CRIT(       id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_CRIT(       id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_CRIT(       id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_CRIT_1(     id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_CRIT_2(     id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_CRIT_3(     id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_CRIT_1(     id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_CRIT_2(     id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_CRIT_3(     id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_ERROR(      id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_ERROR(      id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_ERROR(      id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_ERROR(      id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_ERROR_1(    id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_ERROR_2(    id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_ERROR_3(    id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_ERROR_1(    id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_ERROR_2(    id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_ERROR_3(    id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_WARN(       id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_WARN(       id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_WARN(       id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_WARN(       id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_WARN_1(     id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_WARN_2(     id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_WARN_3(     id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_WARN_1(     id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_WARN_2(     id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_WARN_3(     id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_NOTICE(     id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_NOTICE(     id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_NOTICE(     id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_NOTICE(     id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_NOTICE_1(   id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_NOTICE_2(   id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_NOTICE_3(   id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_NOTICE_1(   id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_NOTICE_2(   id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_NOTICE_3(   id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_INFO_HI(    id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_INFO_HI(    id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_INFO_HI(    id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_INFO_HI(    id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_INFO_HI_1(  id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_INFO_HI_2(  id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_INFO_HI_3(  id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_INFO_HI_1(  id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_INFO_HI_2(  id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_INFO_HI_3(  id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_INFO_MID(   id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_INFO_MID(   id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_INFO_MID(   id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_INFO_MID(   id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_INFO_MID_1( id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_INFO_MID_2( id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_INFO_MID_3( id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_INFO_MID_1( id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_INFO_MID_2( id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_INFO_MID_3( id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_INFO_LO(    id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_INFO_LO(    id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_INFO_LO(    id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_INFO_LO(    id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_INFO_LO_1(  id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_INFO_LO_2(  id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_INFO_LO_3(  id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_INFO_LO_1(  id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_INFO_LO_2(  id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_INFO_LO_3(  id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_DEBUG_HI(   id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_DEBUG_HI(   id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_DEBUG_HI(   id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_DEBUG_HI(   id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_DEBUG_HI_1( id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_DEBUG_HI_2( id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_DEBUG_HI_3( id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_DEBUG_HI_1( id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_DEBUG_HI_2( id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_DEBUG_HI_3( id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_DEBUG_MID(  id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_DEBUG_MID(  id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_DEBUG_MID(  id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_DEBUG_MID(  id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_DEBUG_MID_1(id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_DEBUG_MID_2(id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_DEBUG_MID_3(id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_DEBUG_MID_1(id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_DEBUG_MID_2(id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_DEBUG_MID_3(id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_LOG_DATA_DEBUG_LO(   id, data, size, ...)                                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
+#define IOCMD_LOG_DATA_DEBUG_LO(   id, data, size, ...)                                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data, size, __VA_ARGS__)
 #else
-#define IOCMD_LOG_DATA_DEBUG_LO(   id, data, size, description)                                       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data, size, description)
+#define IOCMD_LOG_DATA_DEBUG_LO(   id, data, size, description)                                       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data, size, description)
 #endif
-#define IOCMD_LOG_DATA_DEBUG_LO_1( id, data, size, description, a1)                                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data, size, description, a1)
-#define IOCMD_LOG_DATA_DEBUG_LO_2( id, data, size, description, a1, a2)                               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data, size, description, a1, a2)
-#define IOCMD_LOG_DATA_DEBUG_LO_3( id, data, size, description, a1, a2, a3)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
+#define IOCMD_LOG_DATA_DEBUG_LO_1( id, data, size, description, a1)                                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data, size, description, a1)
+#define IOCMD_LOG_DATA_DEBUG_LO_2( id, data, size, description, a1, a2)                               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data, size, description, a1, a2)
+#define IOCMD_LOG_DATA_DEBUG_LO_3( id, data, size, description, a1, a2, a3)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log_Data_Context(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data, size, description, a1, a2, a3)
 
 #else
 
@@ -1309,112 +2078,112 @@ typedef uint32_t IOCMD_Time_DT;
 #endif
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_EMERG(      id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_EMERG(      id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_EMERG(      id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_EMERG(      id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_EMERG_1(    id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_EMERG_2(    id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_EMERG_3(    id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_EMERG_1(    id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_EMERG_2(    id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_EMERG_3(    id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_EMERG))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_EMERG,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_ALERT(      id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_ALERT(      id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_ALERT(      id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_ALERT(      id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_ALERT_1(    id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_ALERT_2(    id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_ALERT_3(    id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_ALERT_1(    id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_ALERT_2(    id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_ALERT_3(    id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ALERT))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ALERT,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_CRIT(       id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_CRIT(       id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_CRIT(       id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_CRIT(       id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_CRIT_1(     id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_CRIT_2(     id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_CRIT_3(     id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))        IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_CRIT_1(     id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_CRIT_2(     id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_CRIT_3(     id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_CRIT))                    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_CRIT,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_ERROR(      id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_ERROR(      id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_ERROR(      id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_ERROR(      id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_ERROR_1(    id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_ERROR_2(    id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_ERROR_3(    id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))       IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_ERROR_1(    id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_ERROR_2(    id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_ERROR_3(    id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_ERROR))                   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_ERROR,       IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_WARN(       id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_WARN(       id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_WARN(       id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_WARN(       id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_WARN_1(     id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_WARN_2(     id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_WARN_3(     id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))        IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_WARN_1(     id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_WARN_2(     id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_WARN_3(     id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_WARN))                    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_WARN,        IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_NOTICE(     id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_NOTICE(     id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_NOTICE(     id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_NOTICE(     id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_NOTICE_1(   id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_NOTICE_2(   id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_NOTICE_3(   id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))      IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_NOTICE_1(   id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_NOTICE_2(   id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_NOTICE_3(   id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_NOTICE))                  IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_NOTICE,      IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_INFO_HI(    id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_INFO_HI(    id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_INFO_HI(    id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_INFO_HI(    id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_INFO_HI_1(  id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_INFO_HI_2(  id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_INFO_HI_3(  id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))     IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_INFO_HI_1(  id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_INFO_HI_2(  id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_INFO_HI_3(  id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_HI))                 IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_HI,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_INFO_MID(   id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_INFO_MID(   id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_INFO_MID(   id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_INFO_MID(   id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_INFO_MID_1( id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_INFO_MID_2( id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_INFO_MID_3( id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_INFO_MID_1( id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_INFO_MID_2( id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_INFO_MID_3( id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_MID))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_MID,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_INFO_LO(    id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_INFO_LO(    id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_INFO_LO(    id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_INFO_LO(    id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_INFO_LO_1(  id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_INFO_LO_2(  id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_INFO_LO_3(  id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))     IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_INFO_LO_1(  id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_INFO_LO_2(  id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_INFO_LO_3(  id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_INFO_LO))                 IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_INFO_LO,     IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_DEBUG_HI(   id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_DEBUG_HI(   id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_DEBUG_HI(   id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_DEBUG_HI(   id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_DEBUG_HI_1( id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_DEBUG_HI_2( id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_DEBUG_HI_3( id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_DEBUG_HI_1( id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_DEBUG_HI_2( id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_DEBUG_HI_3( id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_HI))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_HI,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_DEBUG_MID(  id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_DEBUG_MID(  id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_DEBUG_MID(  id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_DEBUG_MID(  id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_DEBUG_MID_1(id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_DEBUG_MID_2(id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_DEBUG_MID_3(id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))   IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_DEBUG_MID_1(id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_DEBUG_MID_2(id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_DEBUG_MID_3(id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_MID))               IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_MID,   IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #if(IOCMD_SUPPORT_VARIADIC_MACROS)
-#define IOCMD_COMPARE_DATA_DEBUG_LO(   id, data1, size1, data2, size2, ...)                           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
+#define IOCMD_COMPARE_DATA_DEBUG_LO(   id, data1, size1, data2, size2, ...)                           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, __VA_ARGS__)
 #else
-#define IOCMD_COMPARE_DATA_DEBUG_LO(   id, data1, size1, data2, size2, description)                   if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
+#define IOCMD_COMPARE_DATA_DEBUG_LO(   id, data1, size1, data2, size2, description)                   if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description)
 #endif
-#define IOCMD_COMPARE_DATA_DEBUG_LO_1( id, data1, size1, data2, size2, description, a1)               if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
-#define IOCMD_COMPARE_DATA_DEBUG_LO_2( id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
-#define IOCMD_COMPARE_DATA_DEBUG_LO_3( id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_COMPILATION_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))    IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
+#define IOCMD_COMPARE_DATA_DEBUG_LO_1( id, data1, size1, data2, size2, description, a1)               if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1)
+#define IOCMD_COMPARE_DATA_DEBUG_LO_2( id, data1, size1, data2, size2, description, a1, a2)           if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2)
+#define IOCMD_COMPARE_DATA_DEBUG_LO_3( id, data1, size1, data2, size2, description, a1, a2, a3)       if(IOCMD_SWITCH_LOG(id, IOCMD_LOG_LEVEL_DEBUG_LO))                IOCMD_Log_Data_Comparision(id, IOCMD__LINE__LOCAL, IOCMD_LOG_LEVEL_DEBUG_LO,    IOCMD__FILE__LOCAL, data1, size1, data2, size2, description, a1, a2, a3)
 
 #else
 
@@ -1536,16 +2305,63 @@ typedef uint32_t IOCMD_Time_DT;
 extern const uint_fast8_t *IOCMD_Os_Critical_Switch;
 #endif
 
+#if(IOCMD_LOG_INLINE_LEVEL_CHECK)
+/** for every log ID - highest level (IOCMD_Log_Level_ET) of logs which are stored in main or quiet buffer; read-only */
+extern uint8_t IOCMD_Log_Effective_Levels[IOCMD_LOG_ID_LAST];
+#endif
+
 /**
  * Functions
  */
 
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY)
+/**
+ * Initializes logs module with main and quiet buffers placed in memory given by the application.
+ *
+ * @param mem pointer to memory of size main_buf_size + quiet_buf_size; main buffer is placed on its begining,
+ * quiet buffer just after it (with IOCMD_LOG_SINGLE_STORAGE whole memory is one common buffer).
+ * Memory must stay valid until IOCMD_Logs_Deinit or until it is replaced by IOCMD_Logs_Change_Memory.
+ * @param main_buf_size size of main buffer; must not be bigger than IOCMD_LOG_MAIN_BUF_SIZE and not smaller than
+ * 2 * (IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH) - free space kept for the next logs
+ * @param quiet_buf_size size of quiet buffer; limits the same as for main buffer with IOCMD_LOG_QUIET_BUF_SIZE
+ *
+ * @result IOCMD_TRUE if initialization succeeded, IOCMD_FALSE otherwise
+ */
+IOCMD_Bool_DT IOCMD_Logs_Init_With_Memory(void *mem, size_t main_buf_size, size_t quiet_buf_size);
+
+/**
+ * Moves buffered logs to new memory; can be called while other threads are logging and processing buffered logs.
+ * When new buffer is smaller than logs kept in it then the oldest logs are removed.
+ * Maximal used sizes of the buffers are counted again from this moment.
+ *
+ * @param mem pointer to new memory, layout and sizes the same as for IOCMD_Logs_Init_With_Memory;
+ * must not overlap currently used memory
+ * @param main_buf_size new size of main buffer
+ * @param quiet_buf_size new size of quiet buffer
+ * @param old_mem pointer to variable to which previously used memory is returned; it can be released by the application
+ * after this function returned IOCMD_TRUE; not changed when IOCMD_FALSE is returned
+ *
+ * @result IOCMD_TRUE if logs were moved, IOCMD_FALSE if params are invalid, logs module is not initialized
+ * or new buffers cannot be initialized - then logs stay in currently used memory
+ */
+IOCMD_Bool_DT IOCMD_Logs_Change_Memory(void *mem, size_t main_buf_size, size_t quiet_buf_size, void **old_mem);
+#else
 IOCMD_Bool_DT IOCMD_Logs_Init(void);
+#endif
 
 
 void IOCMD_Logs_Deinit(void);
 
 
+/**
+ * Must be called by thread which logged, just before the thread finishes. When IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS
+ * is bigger than 0, staging ring owned by the thread is given back and can be taken by next thread which logs first time.
+ * Logs still waiting in the ring are moved to main / quiet buffer same as before. If the thread logs again then it
+ * takes a ring again. In other configurations this function does nothing.
+ */
+void IOCMD_Log_Thread_Exit(void);
+
+
 void IOCMD_Clear_All_Logs(IOCMD_Bool_DT clear_quiet_buf);
 
 
@@ -1560,6 +2376,29 @@ void IOCMD_Logs_Resume(void);
 void IOCMD_Log(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, const char *file, const char *format, ...);
 
 
+#if(IOCMD_LOG_HIGH_RES_TIME)
+/**
+ * Returns current time in ticks of time source used by library (TSC or nanoseconds of CLOCK_MONOTONIC).
+ */
+IOCMD_Time_DT IOCMD_Log_Get_Time(void);
+#endif
+
+
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+/**
+ * Function used by IOCMD_EMERG - IOCMD_DEBUG_LO macros instead of IOCMD_Log. Format is the same as in call site descriptor.
+ */
+void IOCMD_Log_Call_Site(const IOCMD_Log_Call_Site_XT *call_site, const char *format, ...);
+
+
+/**
+ * Returns pointer to table of call site descriptors of all logs in the program and their number in num_call_sites.
+ * Index of descriptor in this table is the value stored in logs buffer.
+ */
+const IOCMD_Log_Call_Site_XT *IOCMD_Log_Get_Call_Sites(uint_fast32_t *num_call_sites);
+#endif
+
+
 #if(IOCMD_SUPPORT_DATA_LOGGING)
 void IOCMD_Log_Data_Context(
    IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, const char *file,
@@ -1576,6 +2415,11 @@ void IOCMD_Log_Data_Comparision(
 
 #if(IOCMD_SUPPORT_ENTRANCE_LOGGING)
 void IOCMD_Enter_Exit(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t enter_exit, const char *file, const char *func_name);
+
+/**
+ * Function called automatically by IOCMD_ENTER_FUNC_SCOPE when the scope is left; logs exit of function.
+ */
+void IOCMD_Exit_Scope(const IOCMD_Log_Scope_XT *scope);
 #endif
 
 
@@ -1611,6 +2455,24 @@ void IOCMD_Os_Switch_Context(IOCMD_Context_ID_DT previous_service, IOCMD_Context
 void IOCMD_Proc_Buffered_Logs(IOCMD_Bool_DT print_silent_logs, const IOCMD_Print_Exe_Params_XT *exe, uint8_t *working_buf, uint_fast16_t working_buf_size);
 
 
+#if(IOCMD_LOG_TRACE_EXPORT)
+/**
+ * @brief processes reading logs from buffer same as IOCMD_Proc_Buffered_Logs but prints them as Chrome trace-event JSON
+ * (JSON array format - every event is followed by comma and closing bracket is not printed, which is accepted by viewers).
+ *
+ * @param print_silent_logs if true then quite logs will be exported too
+ * @param begin_trace if true then beginning of the trace is printed before events - shall be true for first call
+ * for output file, false for next calls which only append events
+ * @param exe pointer to structure with execution methods
+ * @working_buf pointer to working buffer into which function will read temporarily one log.
+ * This buffer size shall be at least IOCMD_WORKING_BUF_RECOMMENDED_SIZE
+ * @param working_buf_size size of working_buf. This buffer size shall be at least IOCMD_WORKING_BUF_RECOMMENDED_SIZE
+ */
+void IOCMD_Proc_Buffered_Logs_Trace(
+   IOCMD_Bool_DT print_silent_logs, IOCMD_Bool_DT begin_trace, const IOCMD_Print_Exe_Params_XT *exe, uint8_t *working_buf, uint_fast16_t working_buf_size);
+#endif
+
+
 void IOCMD_Install_Immediate_Logs_Processor(const IOCMD_Print_Exe_Params_XT *exe, uint8_t *working_buf, uint_fast16_t working_buf_size);
 
 
@@ -0,0 +1,84 @@
+/** ---------------------------------------- LICENSE SECTION -------------------------------------------------------------------
+ *
+ * Copyright (c) 2018 Piotr Wojtowicz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * -----------------------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef IOCMD_LOG_HPP_
+#define IOCMD_LOG_HPP_
+
+/**
+ * C++ version of IOCMD_LOG_CALL_SITE_ARG_TYPES used when IOCMD_LOG_CALL_SITE_DESCRIPTORS is enabled.
+ * Shall be included by C++ sources instead of iocmd.h; types of log arguments are captured by templates below
+ * instead of C11 _Generic.
+ */
+
+#include <stdint.h>
+#include <atomic>
+#include <type_traits>
+
+#define IOCMD_LOG_CALL_SITE_ARG_TYPES(...)      (decltype(IOCMD_Log_Get_Arg_Types(__VA_ARGS__))::value)
+
+/* same size and representation as atomic_uint_least8_t used by the library for IOCMD_LOG_TYPED_ARGUMENTS */
+typedef std::atomic<uint_least8_t> IOCMD_Log_Arg_Types_Check_DT;
+
+extern "C"
+{
+#include "iocmd.h"
+}
+
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+
+template<typename T>
+struct IOCMD_Log_Arg_Type : std::integral_constant<uint64_t,
+   (std::is_integral<T>::value || std::is_enum<T>::value)
+      ? ((sizeof(T) <= sizeof(int)) ? IOCMD_LOG_ARG_INT : ((sizeof(T) <= sizeof(long)) ? IOCMD_LOG_ARG_LONG : IOCMD_LOG_ARG_LONG_LONG))
+   : std::is_same<T, long double>::value ? IOCMD_LOG_ARG_LONG_DOUBLE
+   : std::is_floating_point<T>::value ? IOCMD_LOG_ARG_DOUBLE
+   : (std::is_pointer<T>::value
+      && std::is_same<typename std::remove_cv<typename std::remove_pointer<T>::type>::type, char>::value)
+      ? IOCMD_LOG_ARG_STRING
+   : (std::is_pointer<T>::value
+      && (std::is_void<typename std::remove_cv<typename std::remove_pointer<T>::type>::type>::value
+         || std::is_same<typename std::remove_cv<typename std::remove_pointer<T>::type>::type, signed char>::value
+         || std::is_same<typename std::remove_cv<typename std::remove_pointer<T>::type>::type, unsigned char>::value))
+      ? IOCMD_LOG_ARG_POINTER
+   : IOCMD_LOG_ARG_UNKNOWN>
+{};
+
+/** 4 bits per argument, first argument in the lowest bits - same as IOCMD_Log_Call_Site_XT.arg_types */
+template<typename... Args>
+struct IOCMD_Log_Arg_Types : std::integral_constant<uint64_t, 0U>
+{};
+
+template<typename First, typename... Rest>
+struct IOCMD_Log_Arg_Types<First, Rest...> : std::integral_constant<uint64_t,
+   IOCMD_Log_Arg_Type<typename std::decay<First>::type>::value | (IOCMD_Log_Arg_Types<Rest...>::value << 4U)>
+{};
+
+/* used only inside of decltype - arguments are never evaluated */
+template<typename Format, typename... Args>
+IOCMD_Log_Arg_Types<Args...> IOCMD_Log_Get_Arg_Types(const Format &format, const Args&... args);
+
+#endif
+
+#endif
@@ -74,6 +74,23 @@
 #define IOCMD_OUT_USE_OPRINTF                   IOCMD_FEATURE_ENABLED
 #endif
 
+/**
+ * Definition to enable / disable implementation of buffered output adapter: IOCMD_Buffered_Exe_Init and IOCMD_Buffered_Exe_Flush.
+ * Adapter provides IOCMD_Print_Exe_Params_XT which collects all pieces of text printed by "printf" functions
+ * (literal parts, padding, parameters) in staging buffer and passes them to output device as one contiguous block per line.
+ */
+#ifndef IOCMD_OUT_USE_BUFFERED_EXE
+#define IOCMD_OUT_USE_BUFFERED_EXE              IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * Definition to enable / disable implementation of IOCMD_Buffered_Exe_Init_Fd - buffered output adapter which writes
+ * collected text to POSIX file descriptor. Can be enabled only on systems which provide unistd.h.
+ */
+#ifndef IOCMD_OUT_BUFFERED_EXE_SUPPORT_POSIX_FD
+#define IOCMD_OUT_BUFFERED_EXE_SUPPORT_POSIX_FD IOCMD_FEATURE_DISABLED
+#endif
+
 /**
  * Definition to enable / disable implementation of IOCMD_Utoa64 and support 64-bit int/uint in printf format
  */
@@ -81,6 +98,26 @@
 #define IOCMD_OUT_SUPPORT_U64                   IOCMD_FEATURE_ENABLED
 #endif
 
+/**
+ * Definition to enable / disable support for floating point parameters %f, %F, %e, %E, %g, %G, %a and %A in printf format.
+ * Conversion uses only integer arithmetic and prints exactly the same digits as standard library (type double
+ * must be IEEE-754 binary64, long double parameters are printed after conversion to double).
+ * When disabled, floating point parameters are consumed from argument list and printed as "%".
+ */
+#ifndef IOCMD_OUT_SUPPORT_FLOATING_POINT
+#define IOCMD_OUT_SUPPORT_FLOATING_POINT        IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * Definition to enable / disable printing of the shortest representation by %g / %G used without precision.
+ * When enabled, instead of 6 significant digits, %g prints the smallest number of digits which is converted back
+ * to the same value (for example 1234567.5 instead of 1.23457e+06 or 0.30000000000000004 instead of 0.3 for 0.1 + 0.2)
+ * and exponent form is used only for exponent lower than -4 or bigger than 16.
+ */
+#ifndef IOCMD_OUT_FLOATING_POINT_SHORTEST_G
+#define IOCMD_OUT_FLOATING_POINT_SHORTEST_G     IOCMD_FEATURE_DISABLED
+#endif
+
 /**
  * Definition to enable / disable implementation of parameter %n (returning current position in output string).
  * This parameter might be useful in reduction of program memory of LOG module and time of storing log to buffer
@@ -122,6 +159,27 @@
 #define IOCMD_HEX_TO_BCD_DONT_USE_DIV           IOCMD_FEATURE_ENABLED
 #endif
 
+/**
+ * If IOCMD_FEATURE_ENABLED then IOCMD_Utoa64 / IOCMD_Utoa32 / IOCMD_Utoa16 / IOCMD_Utoa8 use conversion engine dedicated
+ * for 32/64-bit CPUs with fast multiplication instead of the one selected by IOCMD_HEX_TO_BCD_DONT_USE_DIV:
+ * length of result is calculated before conversion from number of significant bits (count leading zeros)
+ * and decimal digits are generated two at a time using table of digit pairs. Result is identical, except value 0
+ * without pads which this engine prints as "0" in every base, as sprintf does.
+ */
+#ifndef IOCMD_UTOA_USE_DIGIT_PAIRS
+#define IOCMD_UTOA_USE_DIGIT_PAIRS              IOCMD_FEATURE_DISABLED
+#endif
+
+/**
+ * If IOCMD_FEATURE_ENABLED then literal text of the format is scanned for '%', '\0', '\n' and '\r' whole CPU word at a time.
+ * Words are read only from aligned addresses, so a read never crosses page boundary, but it can read bytes
+ * placed after the end of the format string (in the same word). With GCC / clang this function is excluded from
+ * AddressSanitizer checks; disable this feature when library is checked by other memory checkers which report such reads.
+ */
+#ifndef IOCMD_OUT_SCAN_FORMAT_BY_WORDS
+#define IOCMD_OUT_SCAN_FORMAT_BY_WORDS          IOCMD_FEATURE_DISABLED
+#endif
+
 
 /* ----------------------------------------- MEMORY CONFIGURATION / LIMITATION ------------------------------------------------- */
 
@@ -147,6 +205,60 @@
 #define IOCMD_MAX_STRING_LENGTH                 1024
 #endif
 
+/**
+ * Defines number of entries in cache of pre-compiled format strings. Every entry keeps format string already split
+ * to list of literal parts and parsed parameters, so next call of "printf" / log function with the same format
+ * doesn't need to parse it again. Entries are identified by format pointer and are never released,
+ * so cache shall be used only if format strings are constant (not modified during program execution).
+ * If defined to 0 then cache is not used.
+ */
+#ifndef IOCMD_OUT_FORMAT_CACHE_SIZE
+#define IOCMD_OUT_FORMAT_CACHE_SIZE             0
+#endif
+
+/**
+ * Defines maximum number of operations (literal parts, parameters, end of lines) kept in one entry of format strings cache.
+ * Format strings which need more operations are not cached and are parsed on every call.
+ */
+#ifndef IOCMD_OUT_FORMAT_CACHE_MAX_OPS
+#define IOCMD_OUT_FORMAT_CACHE_MAX_OPS          16
+#endif
+
+/**
+ * Defines maximum number of cache entries checked for one format string. If none of them keeps the format and none of them
+ * is free then format is parsed without cache, so lookup cost stays constant also when cache is full.
+ */
+#ifndef IOCMD_OUT_FORMAT_CACHE_MAX_PROBES
+#define IOCMD_OUT_FORMAT_CACHE_MAX_PROBES       8
+#endif
+
+/**
+ * Decides if format string provided to "printf" functions can be stored in format strings cache.
+ * By default only format strings located in program memory (see IOCMD_IS_PTR_IN_PROGRAM_MEMORY) are cached,
+ * so formats built in RAM buffers (for example by IOCMD_Snprintf) are always parsed again. Without LOG module
+ * program memory range is not known, so by default only format strings of logs are cached.
+ * Format strings of logs are always cached because LOG module requires them to be constant anyway.
+ */
+#ifndef IOCMD_OUT_IS_FORMAT_CACHEABLE
+#ifdef IOCMD_USE_LOG
+#define IOCMD_OUT_IS_FORMAT_CACHEABLE(_format)  IOCMD_IS_PTR_IN_PROGRAM_MEMORY(_format)
+#else
+#define IOCMD_OUT_IS_FORMAT_CACHEABLE(_format)  IOCMD_FALSE
+#endif
+#endif
+
+/**
+ * Protection of format strings cache used only when new format string is being added to the cache.
+ * Shall be re-defined if "printf" / log functions are used from more than one context.
+ */
+#ifndef IOCMD_OUT_FORMAT_CACHE_LOCK
+#define IOCMD_OUT_FORMAT_CACHE_LOCK()
+#endif
+
+#ifndef IOCMD_OUT_FORMAT_CACHE_UNLOCK
+#define IOCMD_OUT_FORMAT_CACHE_UNLOCK()
+#endif
+
 
 /* ----------------------------------------- TERMINAL SETTINGS ----------------------------------------------------------------- */
 
@@ -196,6 +308,47 @@
    #endif
 #endif
 
+/**
+ * @brief structure used to read statistics of format strings cache.
+ */
+typedef struct IOCMD_Format_Cache_Stats_eXtendedTag
+{
+   uint32_t       hits;
+   uint32_t       misses;
+   uint_fast16_t  used_entries;
+   uint_fast16_t  size;
+}IOCMD_Format_Cache_Stats_XT;
+
+/**
+ * @brief Function used by buffered output adapter to pass collected text to output device.
+ *
+ * @result number of characters which function wrote to output device.
+ *
+ * @param sink pointer with device params provided to IOCMD_Buffered_Exe_Init
+ * @param data pointer to collected text (NOT NULL terminated)
+ * @param size number of characters in "data"
+ */
+typedef int (*IOCMD_Buffered_Exe_Write)(void *sink, const char *data, int size);
+
+/**
+ * @brief structure of buffered output adapter. Field "exe" is the one which shall be provided to "printf" functions
+ * (or IOCMD_Install_Standard_Output). Other fields are internal and shall not be modified by the application
+ * except "num_writes" which counts calls of "output" function and can be cleared at any time.
+ */
+typedef struct IOCMD_Buffered_Exe_eXtendedTag
+{
+   IOCMD_Print_Exe_Params_XT  exe;
+   char                      *buf;
+   int                        buf_size;
+   int                        used;
+   void                      *sink;
+   IOCMD_Buffered_Exe_Write   output;
+#if(IOCMD_OUT_BUFFERED_EXE_SUPPORT_POSIX_FD)
+   int                        fd;
+#endif
+   uint32_t                   num_writes;
+}IOCMD_Buffered_Exe_XT;
+
 
 /**
  * -----------------------------------------------------------------------------------------------------------------------------
@@ -227,12 +380,20 @@
 #if(IOCMD_OUT_USE_SNPRINTF)
 /**
  * @brief function identical to snprintf standard function but without support for floating point variables
+ * if IOCMD_OUT_SUPPORT_FLOATING_POINT is disabled
+ *
+ * Like in C99, returned value is length of whole output (without terminating '\0'), even if it was truncated to buf_size.
+ * If buf_size is 0 then buf can be NULL - nothing is written and only the needed length is returned,
+ * so buffer for the output can be sized by calling this function twice.
  */
 int IOCMD_Snprintf(char *buf, size_t buf_size, const char *format, ...);
 
 
 /**
  * @brief function identical to vsnprintf standard function but without support for floating point variables
+ * if IOCMD_OUT_SUPPORT_FLOATING_POINT is disabled
+ *
+ * Returned value and behavior for buf_size 0 are the same as for IOCMD_Snprintf.
  */
 int IOCMD_Vsnprintf(char *buf, size_t buf_size, const char *format, va_list arg);
 #endif
@@ -251,14 +412,16 @@ void IOCMD_Install_Standard_Output(const IOCMD_Print_Exe_Params_XT *exe);
 
 
 /**
- * @brief function identical to printf standard function but with 1 difference: NO support for floating point variables.
+ * @brief function identical to printf standard function but with 1 difference: NO support for floating point variables
+ * if IOCMD_OUT_SUPPORT_FLOATING_POINT is disabled.
  * This function needs to have IOCMD_Print_Exe_Params_XT structure installed before (or on startup) by IOCMD_Install_Standard_Output.
  */
 int IOCMD_Printf(const char *format, ...);
 
 
 /**
- * @brief function identical to vprintf standard function but with 1 difference: NO support for floating point variables.
+ * @brief function identical to vprintf standard function but with 1 difference: NO support for floating point variables
+ * if IOCMD_OUT_SUPPORT_FLOATING_POINT is disabled.
  * This function needs to have IOCMD_Print_Exe_Params_XT structure installed before (or on startup) by IOCMD_Install_Standard_Output.
  */
 int IOCMD_Vprintf(const char *format, va_list arg);
@@ -266,6 +429,7 @@ int IOCMD_Vprintf(const char *format, va_list arg);
 
 /**
  * @brief function identical to printf standard function but with 2 differencies: NO support for floating point variables
+ * if IOCMD_OUT_SUPPORT_FLOATING_POINT is disabled
  * and every call of this function prints result in separated line.
  * This function needs to have IOCMD_Print_Exe_Params_XT structure installed before (or on startup) by IOCMD_Install_Standard_Output.
  */
@@ -274,6 +438,7 @@ int IOCMD_Printf_Line(const char *format, ...);
 
 /**
  * @brief function identical to vprintf standard function but with 2 differencies: NO support for floating point variables
+ * if IOCMD_OUT_SUPPORT_FLOATING_POINT is disabled
  * and every call of this function prints result in separated line.
  * This function needs to have IOCMD_Print_Exe_Params_XT structure installed before (or on startup) by IOCMD_Install_Standard_Output.
  */
@@ -284,6 +449,7 @@ int IOCMD_Vprintf_Line(const char *format, va_list arg);
 #if(IOCMD_OUT_USE_OPRINTF || defined(IOCMD_USE_LOG))
 /**
  * @brief function identical to printf standard function but with 2 differences: NO support for floating point variables
+ * if IOCMD_OUT_SUPPORT_FLOATING_POINT is disabled
  * and output is directed to place specified by first, additional parameter of the function instead of standard output
  * connected by function IOCMD_Install_Standard_Output.
  */
@@ -294,6 +460,7 @@ int IOCMD_Oprintf(const IOCMD_Print_Exe_Params_XT *exe, const char *format, ...)
 #if(IOCMD_OUT_USE_OPRINTF)
 /**
  * @brief function identical to vprintf standard function but with 2 differences: NO support for floating point variables
+ * if IOCMD_OUT_SUPPORT_FLOATING_POINT is disabled
  * and output is directed to place specified by first, additional parameter of the function instead of standard output
  * connected by function IOCMD_Install_Standard_Output.
  */
@@ -303,7 +470,8 @@ int IOCMD_Voprintf(const IOCMD_Print_Exe_Params_XT *exe, const char *format, va_
 
 #if(IOCMD_OUT_USE_OPRINTF || defined(IOCMD_USE_LOG))
 /**
- * @brief function identical to printf standard function but with 3 differences: NO support for floating point variables,
+ * @brief function identical to printf standard function but with 3 differences: NO support for floating point variables
+ * if IOCMD_OUT_SUPPORT_FLOATING_POINT is disabled,
  * output is directed to place specified by first, additional parameter of the function instead of standard output
  * connected by function IOCMD_Install_Standard_Output and every call of this function prints result in separated line.
  */
@@ -313,7 +481,8 @@ int IOCMD_Oprintf_Line(const IOCMD_Print_Exe_Params_XT *exe, const char *format,
 
 #if(IOCMD_OUT_USE_OPRINTF)
 /**
- * @brief function identical to vprintf standard function but with 3 differences: NO support for floating point variables,
+ * @brief function identical to vprintf standard function but with 3 differences: NO support for floating point variables
+ * if IOCMD_OUT_SUPPORT_FLOATING_POINT is disabled,
  * output is directed to place specified by first, additional parameter of the function instead of standard output
  * connected by function IOCMD_Install_Standard_Output and every call of this function prints result in separated line.
  */
@@ -321,6 +490,57 @@ int IOCMD_Voprintf_Line(const IOCMD_Print_Exe_Params_XT *exe, const char *format
 #endif
 
 
+#if(IOCMD_OUT_FORMAT_CACHE_SIZE > 0)
+/**
+ * @brief function reads statistics of format strings cache.
+ *
+ * @param stats pointer to structure to which statistics will be copied:
+ * number of calls which used pre-compiled format (hits), number of calls which had to parse format (misses),
+ * number of used cache entries and total number of cache entries.
+ */
+void IOCMD_Get_Format_Cache_Stats(IOCMD_Format_Cache_Stats_XT *stats);
+#endif
+
+
+#if(IOCMD_OUT_USE_BUFFERED_EXE)
+/**
+ * @brief function initializes buffered output adapter. After initialization bexe->exe can be used as output
+ * of any "printf" function. Text is passed to "output" function when end of line is printed, when staging buffer is full
+ * or when IOCMD_Buffered_Exe_Flush is called, so printing without end of line must be followed by IOCMD_Buffered_Exe_Flush.
+ *
+ * @param bexe pointer to adapter structure to be initialized
+ * @param buf pointer to staging buffer
+ * @param buf_size size of staging buffer; should be at least as long as the longest printed line
+ * @param output function which passes collected text to output device
+ * @param sink pointer with device params provided as first parameter of "output" function
+ */
+void IOCMD_Buffered_Exe_Init(IOCMD_Buffered_Exe_XT *bexe, char *buf, size_t buf_size, IOCMD_Buffered_Exe_Write output, void *sink);
+
+
+/**
+ * @brief function passes all text collected in staging buffer to output device.
+ *
+ * @result number of characters written to output device
+ *
+ * @param bexe pointer to adapter structure
+ */
+int IOCMD_Buffered_Exe_Flush(IOCMD_Buffered_Exe_XT *bexe);
+
+
+#if(IOCMD_OUT_BUFFERED_EXE_SUPPORT_POSIX_FD)
+/**
+ * @brief function initializes buffered output adapter which writes collected text to POSIX file descriptor.
+ *
+ * @param bexe pointer to adapter structure to be initialized
+ * @param buf pointer to staging buffer
+ * @param buf_size size of staging buffer; should be at least as long as the longest printed line
+ * @param fd file descriptor to which text is written
+ */
+void IOCMD_Buffered_Exe_Init_Fd(IOCMD_Buffered_Exe_XT *bexe, char *buf, size_t buf_size, int fd);
+#endif
+#endif
+
+
 /**
  * -----------------------------------------------------------------------------------------------------------------------------
  * ----------------------------------------- END OF LIBRARY INTERFACES ---------------------------------------------------------
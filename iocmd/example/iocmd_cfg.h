@@ -56,6 +56,8 @@
 
 #define IOCMD_LOG_MAIN_BUF_SIZE                 1000000000
 #define IOCMD_LOG_QUIET_BUF_SIZE                40000
+/* memory of buffers is allocated in main.c */
+#define IOCMD_LOG_EXTERNAL_BUF_MEMORY           true
 
 #define IOCMD_LOGS_TREE_OS_CRITICAL_ID          IOCMD_OS_SWITCH
 
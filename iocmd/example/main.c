@@ -52,6 +52,9 @@ typedef union
 
 
 
+/* main buffer can take up to IOCMD_LOG_MAIN_BUF_SIZE but for the example much smaller one is enough */
+#define MAIN_LOG_MAIN_BUF_SIZE   1000000
+
 #if(MAIN_EXE_LOG_TO_FILE)
 FILE *log_file;
 #define MAIN_LOG_OUT    log_file
@@ -1021,6 +1024,7 @@ int main(int argc, const char* argv[])
    uint64_t u64;
    char table[128];
    main_test_data_T data;
+   void *log_memory;
 
    IOCMD_Install_Standard_Output(&main_out);
 
@@ -1459,9 +1463,22 @@ int main(int argc, const char* argv[])
    printf("start IOCMD testing...\n\r");
 
 
-   IOCMD_Logs_Init();
+   log_memory = malloc(MAIN_LOG_MAIN_BUF_SIZE + IOCMD_LOG_QUIET_BUF_SIZE);
+
+   if(NULL == log_memory)
+   {
+      printf("memory for logs cannot be allocated\n\r");
+      return 1;
+   }
+
+   if(IOCMD_BOOL_IS_FALSE(IOCMD_Logs_Init_With_Memory(log_memory, MAIN_LOG_MAIN_BUF_SIZE, IOCMD_LOG_QUIET_BUF_SIZE)))
+   {
+      printf("IOCMD_Logs_Init_With_Memory failed\n\r");
+      free(log_memory);
+      return 1;
+   }
 
-   printf("IOCMD_Logs_Init finished\n\r");
+   printf("IOCMD_Logs_Init_With_Memory finished\n\r");
 
    IOCMD_ENTER_FUNC(MAIN_APP);
 
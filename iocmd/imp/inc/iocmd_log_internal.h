@@ -63,13 +63,47 @@ typedef struct IOCMD_Buff_Params_Readout_eXtended_Tag
    size_t quiet_buf_max_used_size;
    size_t main_buf_current_used_size;
    size_t quiet_buf_current_used_size;
+#if(IOCMD_LOG_LOCK_FREE_STAGING && (IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0))
+   /* number of context staging rings owned by threads at the moment */
+   size_t context_staging_rings_used;
+#endif
 }IOCMD_Buff_Params_Readout_XT;
 
+#if(IOCMD_LOG_PROFILER)
+/* log-linear histogram: (2^precision) linear buckets for every power of 2 of time */
+#define IOCMD_LOG_PROFILER_NUM_BUCKETS \
+   ((65U - IOCMD_LOG_PROFILER_HISTOGRAM_PRECISION) * (1U << IOCMD_LOG_PROFILER_HISTOGRAM_PRECISION))
+
+typedef struct IOCMD_Log_Profiler_Stats_eXtended_Tag
+{
+   const char      *func_name;
+   const char      *file;
+   IOCMD_Log_ID_DT  id;
+   /* times are in units of IOCMD_OS_GET_CURRENT_TIME - see IOCMD_Log_Profiler_Time_To_Ns */
+   uint64_t         num_calls;
+   uint64_t         total_time;
+   uint64_t         min_time;
+   uint64_t         max_time;
+   uint32_t         histogram[IOCMD_LOG_PROFILER_NUM_BUCKETS];
+}IOCMD_Log_Profiler_Stats_XT;
+#endif
+
 const IOCMD_Log_Level_Const_Params_XT *IOCMD_Log_Get_Tree_Config(void);
 IOCMD_Log_Level_Data_Params_XT        *IOCMD_Log_Get_Tree_State(void);
 size_t                                 IOCMD_Log_Get_Tree_Num_Elems(void);
+/* shall be called after changing state returned by IOCMD_Log_Get_Tree_State */
+void                                   IOCMD_Log_Refresh_Tree_State(void);
 const char * const *IOCMD_Log_Get_Levels_Names(void);
 void IOCMD_Log_Get_Buf_Params(IOCMD_Buff_Params_Readout_XT *params);
+#if(IOCMD_LOG_PROFILER)
+/* returns IOCMD_FALSE if no function is profiled in slot "index" (0 .. IOCMD_LOG_PROFILER_NUM_FUNCTIONS - 1) */
+IOCMD_Bool_DT IOCMD_Log_Get_Profiler_Stats(size_t index, IOCMD_Log_Profiler_Stats_XT *stats);
+void          IOCMD_Log_Reset_Profiler_Stats(void);
+/* returns the lowest time which falls into histogram bucket */
+uint64_t      IOCMD_Log_Profiler_Bucket_Begin(uint_fast16_t bucket);
+/* converts time measured by IOCMD_OS_GET_CURRENT_TIME to nanoseconds; without IOCMD_LOG_HIGH_RES_TIME returns time as it is */
+uint64_t      IOCMD_Log_Profiler_Time_To_Ns(uint64_t time);
+#endif
 
 #endif
 
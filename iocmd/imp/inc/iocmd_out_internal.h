@@ -113,6 +113,12 @@ typedef union
    {
       uint64_t    u64;
    }u64_field;
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+   struct
+   {
+      double      d;
+   }double_field;
+#endif
 } IOCMD_Buffer_Convert_UT;
 
 #else
@@ -155,6 +161,12 @@ typedef union
    {
       uint32_t    u32_0;
    }u32_field;
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+   struct
+   {
+      double      d;
+   }double_field;
+#endif
 } IOCMD_Buffer_Convert_UT;
 
 #endif
@@ -176,6 +188,31 @@ typedef union IOCMD_Out_Main_Loop_Params_eXtendedTag
 #endif
 }IOCMD_Out_Main_Loop_Params_XT;
 
+#define IOCMD_FORMAT_OP_END                     0
+#define IOCMD_FORMAT_OP_LITERAL                 1
+#define IOCMD_FORMAT_OP_PARAM                   2
+#define IOCMD_FORMAT_OP_PERCENT                 3
+#define IOCMD_FORMAT_OP_ENDL                    4
+#define IOCMD_FORMAT_OP_CARIAGE_RETURN          5
+
+/**
+ * @brief one element of format string split to operations: literal part of format string (pos, len),
+ * parsed parameter, '%' which is not a parameter, end of line or cariage return.
+ */
+typedef struct IOCMD_Format_Op_eXtendedTag
+{
+   union
+   {
+      struct
+      {
+         uint16_t    pos;
+         uint16_t    len;
+      }literal;
+      IOCMD_Param_Parsing_Result_XT param;
+   }data;
+   uint8_t           type;
+}IOCMD_Format_Op_XT;
+
 typedef const char* IOCMD_Strptr;
 
 IOCMD_Bool_DT IOCMD_Parse_Param(const char *format, IOCMD_Param_Parsing_Result_XT *params);
@@ -185,6 +222,17 @@ int IOCMD_Proc_Param(
    IOCMD_Buffer_Convert_UT         *data,
    const IOCMD_Print_Exe_Params_XT *exe);
 
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+/**
+ * @brief prints floating point parameter (%f, %F, %e, %E, %g, %G, %a, %A).
+ * If exe is invalid pointer then nothing is printed and only length of the result is returned.
+ */
+int IOCMD_Proc_Float_Param(
+   IOCMD_Param_Parsing_Result_XT   *params,
+   double                           value,
+   const IOCMD_Print_Exe_Params_XT *exe);
+#endif
+
 int IOCMD_Proc_Main_Loop(
    const char                      *format,
    IOCMD_Out_Main_Loop_Params_XT   *params,
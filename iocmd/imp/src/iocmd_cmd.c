@@ -46,6 +46,11 @@ static void iocmd_cmd_tmp_quiet_off(IOCMD_Arg_DT *arg);
 static void iocmd_cmd_tmp_ent(IOCMD_Arg_DT *arg);
 static void iocmd_cmd_tmp_ent_off(IOCMD_Arg_DT *arg);
 static void iocmd_cmd_stat(IOCMD_Arg_DT *arg);
+#if(IOCMD_LOG_PROFILER)
+static void iocmd_cmd_prof(IOCMD_Arg_DT *arg);
+static void iocmd_cmd_prof_hist(IOCMD_Arg_DT *arg);
+static void iocmd_cmd_prof_reset(IOCMD_Arg_DT *arg);
+#endif
 
 static const IOCMD_Command_Tree_XT iocmd_cmd_tab[] =
 {
@@ -104,6 +109,13 @@ static const IOCMD_Command_Tree_XT iocmd_cmd_tab[] =
    IOCMD_GROUP_END(),
    IOCMD_GROUP_END(),
    IOCMD_ELEM(          "stat"               , iocmd_cmd_stat        , "prints log module statistics"),
+#if(IOCMD_LOG_PROFILER)
+   IOCMD_GROUP_START(   "prof"                                       , "group of commands for functions profiler"),
+   IOCMD_ELEM(             ""                , iocmd_cmd_prof        , "prints number of calls and times of profiled functions"),
+   IOCMD_ELEM(             "hist"            , iocmd_cmd_prof_hist   , "prints times of profiled functions together with histograms"),
+   IOCMD_ELEM(             "reset"           , iocmd_cmd_prof_reset  , "clears statistics of profiled functions"),
+   IOCMD_GROUP_END(),
+#endif
    IOCMD_GROUP_END()
 };
 
@@ -392,6 +404,8 @@ static void iocmd_cmd_set_actv(IOCMD_Arg_DT *arg)
       state = IOCMD_Log_Get_Tree_State();
 
       state[log_id].level = state_id;
+
+      IOCMD_Log_Refresh_Tree_State();
    }
 } /* iocmd_cmd_set_actv */
 
@@ -417,6 +431,8 @@ static void iocmd_cmd_set_actv_grp(IOCMD_Arg_DT *arg)
          {
             state[log_id].level = state_id;
          }
+
+         IOCMD_Log_Refresh_Tree_State();
       }
    }
 } /* iocmd_cmd_set_actv_grp */
@@ -443,6 +459,8 @@ static void iocmd_cmd_set_actv_mod(IOCMD_Arg_DT *arg)
          {
             state[log_id].level = state_id;
          }
+
+         IOCMD_Log_Refresh_Tree_State();
       }
    }
 } /* iocmd_cmd_set_actv_mod */
@@ -458,6 +476,8 @@ static void iocmd_cmd_set_qt(IOCMD_Arg_DT *arg)
       state = IOCMD_Log_Get_Tree_State();
 
       state[log_id].quiet_level = state_id;
+
+      IOCMD_Log_Refresh_Tree_State();
    }
 } /* iocmd_cmd_set_qt */
 
@@ -483,6 +503,8 @@ static void iocmd_cmd_set_qt_grp(IOCMD_Arg_DT *arg)
          {
             state[log_id].quiet_level = state_id;
          }
+
+         IOCMD_Log_Refresh_Tree_State();
       }
    }
 } /* iocmd_cmd_set_qt_grp */
@@ -509,6 +531,8 @@ static void iocmd_cmd_set_qt_mod(IOCMD_Arg_DT *arg)
          {
             state[log_id].quiet_level = state_id;
          }
+
+         IOCMD_Log_Refresh_Tree_State();
       }
    }
 } /* iocmd_cmd_set_qt_mod */
@@ -524,6 +548,8 @@ static void iocmd_cmd_set_ent(IOCMD_Arg_DT *arg)
       state = IOCMD_Log_Get_Tree_State();
 
       state[log_id].entrance_logging_state = state_id;
+
+      IOCMD_Log_Refresh_Tree_State();
    }
 } /* iocmd_cmd_set_ent */
 
@@ -549,6 +575,8 @@ static void iocmd_cmd_set_ent_grp(IOCMD_Arg_DT *arg)
          {
             state[log_id].entrance_logging_state = state_id;
          }
+
+         IOCMD_Log_Refresh_Tree_State();
       }
    }
 } /* iocmd_cmd_set_ent_grp */
@@ -575,6 +603,8 @@ static void iocmd_cmd_set_ent_mod(IOCMD_Arg_DT *arg)
          {
             state[log_id].entrance_logging_state = state_id;
          }
+
+         IOCMD_Log_Refresh_Tree_State();
       }
    }
 } /* iocmd_cmd_set_ent_mod */
@@ -653,8 +683,95 @@ static void iocmd_cmd_stat(IOCMD_Arg_DT *arg)
    IOCMD_Oprintf_Line(arg->arg_out, "quiet buf %-19s: %d", "size",                  params.quiet_buf_size);
    IOCMD_Oprintf_Line(arg->arg_out, "quiet buf %-19s: %d", "used size currently",   params.quiet_buf_current_used_size);
    IOCMD_Oprintf_Line(arg->arg_out, "quiet buf %-19s: %d", "used size peak",        params.quiet_buf_max_used_size);
+#if(IOCMD_LOG_LOCK_FREE_STAGING && (IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0))
+   IOCMD_Oprintf_Line(arg->arg_out, "context staging rings used: %d of %d",
+      params.context_staging_rings_used, IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS);
+#endif
 } /* iocmd_cmd_stat */
 
+#if(IOCMD_LOG_PROFILER)
+static uint64_t iocmd_cmd_prof_percentile(const IOCMD_Log_Profiler_Stats_XT *stats, uint_fast16_t percent)
+{
+   uint64_t num_calls = 0U;
+   uint64_t limit = ((stats->num_calls * percent) + 99U) / 100U;
+   uint_fast16_t bucket;
+   uint64_t result = stats->max_time;
+
+   /* end of bucket in which percentile falls - never more than max time */
+   for(bucket = 0U; (bucket < (IOCMD_LOG_PROFILER_NUM_BUCKETS - 1U)) && (num_calls < limit); bucket++)
+   {
+      num_calls += stats->histogram[bucket];
+
+      if((num_calls >= limit) && (IOCMD_Log_Profiler_Bucket_Begin(bucket + 1U) - 1U < result))
+      {
+         result = IOCMD_Log_Profiler_Bucket_Begin(bucket + 1U) - 1U;
+      }
+   }
+
+   return result;
+} /* iocmd_cmd_prof_percentile */
+
+static void iocmd_cmd_prof_print(IOCMD_Arg_DT *arg, IOCMD_Bool_DT print_histogram)
+{
+   IOCMD_Log_Profiler_Stats_XT stats;
+   size_t index;
+   uint_fast16_t bucket;
+
+#if(IOCMD_LOG_HIGH_RES_TIME)
+   IOCMD_Oprintf_Line(arg->arg_out, "times in ns");
+#else
+   IOCMD_Oprintf_Line(arg->arg_out, "times in units of IOCMD_OS_GET_CURRENT_TIME");
+#endif
+   IOCMD_Oprintf_Line(arg->arg_out, "%-32s %-20s %10s %10s %10s %10s %10s %10s",
+      "function", "log", "calls", "avg", "min", "p50", "p99", "max");
+
+   for(index = 0U; index < IOCMD_LOG_PROFILER_NUM_FUNCTIONS; index++)
+   {
+      if(IOCMD_Log_Get_Profiler_Stats(index, &stats) && (stats.num_calls > 0U))
+      {
+         IOCMD_Oprintf_Line(arg->arg_out, "%-32s %-20s %10llu %10llu %10llu %10llu %10llu %10llu",
+            stats.func_name,
+            (stats.id < IOCMD_Log_Get_Tree_Num_Elems()) ? IOCMD_logs_names[stats.id] : "",
+            (unsigned long long)stats.num_calls,
+            (unsigned long long)IOCMD_Log_Profiler_Time_To_Ns(stats.total_time / stats.num_calls),
+            (unsigned long long)IOCMD_Log_Profiler_Time_To_Ns(stats.min_time),
+            (unsigned long long)IOCMD_Log_Profiler_Time_To_Ns(iocmd_cmd_prof_percentile(&stats, 50U)),
+            (unsigned long long)IOCMD_Log_Profiler_Time_To_Ns(iocmd_cmd_prof_percentile(&stats, 99U)),
+            (unsigned long long)IOCMD_Log_Profiler_Time_To_Ns(stats.max_time));
+
+         if(IOCMD_BOOL_IS_TRUE(print_histogram))
+         {
+            for(bucket = 0U; bucket < IOCMD_LOG_PROFILER_NUM_BUCKETS; bucket++)
+            {
+               if(stats.histogram[bucket] > 0U)
+               {
+                  IOCMD_Oprintf_Line(arg->arg_out, "   >= %10llu: %10u",
+                     (unsigned long long)IOCMD_Log_Profiler_Time_To_Ns(IOCMD_Log_Profiler_Bucket_Begin(bucket)),
+                     (unsigned)stats.histogram[bucket]);
+               }
+            }
+         }
+      }
+   }
+} /* iocmd_cmd_prof_print */
+
+static void iocmd_cmd_prof(IOCMD_Arg_DT *arg)
+{
+   iocmd_cmd_prof_print(arg, IOCMD_FALSE);
+} /* iocmd_cmd_prof */
+
+static void iocmd_cmd_prof_hist(IOCMD_Arg_DT *arg)
+{
+   iocmd_cmd_prof_print(arg, IOCMD_TRUE);
+} /* iocmd_cmd_prof_hist */
+
+static void iocmd_cmd_prof_reset(IOCMD_Arg_DT *arg)
+{
+   IOCMD_Log_Reset_Profiler_Stats();
+   IOCMD_Oprintf_Line(arg->arg_out, "profiler statistics cleared");
+} /* iocmd_cmd_prof_reset */
+#endif
+
 IOCMD_Bool_DT IOCMD_Parse_Lib_Commands(
    int argc, const char* argv[], const /*IOCMD_Print_Exe_Params_XT*/ void *arg_out, IOCMD_Bool_DT is_last_branch)
 {
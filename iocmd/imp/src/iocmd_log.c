@@ -28,6 +28,19 @@
 #include "iocmd_out_internal.h"
 #include "iocmd_log_internal.h"
 #include "buff.h"
+#if(IOCMD_LOG_LOCK_FREE_STAGING || IOCMD_LOG_PROFILER || IOCMD_LOG_HIGH_RES_TIME)
+#include <stdatomic.h>
+#endif
+#if(IOCMD_LOG_HIGH_RES_TIME)
+#include <time.h>
+#if(IOCMD_LOG_HIGH_RES_TIME_TSC && (defined(__x86_64__) || defined(__i386__)))
+#include <x86intrin.h>
+#include <cpuid.h>
+#define IOCMD_LOG_TSC_SUPPORTED              1
+#else
+#define IOCMD_LOG_TSC_SUPPORTED              0
+#endif
+#endif
 
 #define IOCMD_LOG_BUF_DATA_TYPE_STRING       0U
 #define IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B    1U
@@ -57,22 +70,52 @@
 #define IOCMD_LOG_BUF_DATA_TYPE_PTAB_6B     25U
 #define IOCMD_LOG_BUF_DATA_TYPE_PTAB_7B     26U
 #define IOCMD_LOG_BUF_DATA_TYPE_PTAB_8B     27U
+#define IOCMD_LOG_BUF_DATA_TYPE_DOUBLE      28U
+/* data1 / data2 of comparison stored as rows which differ - placed in data2 table */
+#define IOCMD_LOG_BUF_DATA_TYPE_DIFF        29U
+/* data compressed by IOCMD_pack_data - followed by size of compressed data */
+#define IOCMD_LOG_BUF_DATA_TYPE_PACKED      30U
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+/* set in type of main string when integer arguments of the log are stored as LEB128 varints (without type byte) */
+#define IOCMD_LOG_BUF_DATA_TYPE_VARINT_ARGS 0x80U
+#define IOCMD_LOG_BUF_DATA_TYPE_MASK        0x7FU
+#else
+#define IOCMD_LOG_BUF_DATA_TYPE_MASK        0xFFU
+#endif
 
 #define IOCMD_LOG_DATA_DESC_SIZE                (1 /* flags */ + 1 /* data size type */ + sizeof(uint_fast16_t) /* data size */ + 1 /* data pointer type */ + sizeof(void*)/* data pointer if in program memory */)
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+#define IOCMD_LOG_DATA_FRAGMENT_DESC_SIZE       (1 /* flags */ + (3 * (1 + sizeof(uint_fast16_t))) /* fragment size, offset, whole data size */ + 1 /* data type */)
+/* flags of data: bit2 - log is fragment of data log; offset and size of whole data follow size of fragment */
+#define IOCMD_LOG_DATA_FLAG_FRAGMENT            0x04U
+#endif
 #define IOCMD_LOG_OS_SWITCH_CONTEXT_DESC_SIZE   (1/*size*/ + IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_HEADER_TIME_PART_SIZE + 1/*level*/ + sizeof(IOCMD_Context_ID_DT) + sizeof(IOCMD_Context_ID_DT))
 
+#define IOCMD_LOG_IS_SIGNED_SPECIFIER(specifier)   ((('d' == (specifier)) || ('i' == (specifier))) ? IOCMD_TRUE : IOCMD_FALSE)
+
 #ifndef MAX
 #define MAX(a,b)     (((a) > (b)) ? (a) : (b))
 #endif
 
+/* one column of data: 8 bytes printed as "XX," followed by space */
+#define IOCMD_DATA_COLUMN_HEX_LENGTH               25
+/* hex part, "-> " and ASCII part of one line of IOCMD_LOG_DATA_xxxxx */
+#define IOCMD_LOG_DATA_ROW_SIZE                    ((IOCMD_LOG_DATA_NUM_COLUMNS_TO_PRINT * (IOCMD_DATA_COLUMN_HEX_LENGTH + 8)) + 3 + 1)
+/* IOCMD_COMPARE_DATA_xxxxx line is printed in parts - the longest one is hex part of single context */
+#define IOCMD_COMPARE_DATA_ROW_SIZE                ((IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT * IOCMD_DATA_COLUMN_HEX_LENGTH) + 1)
+
 #if(IOCMD_SUPPORT_DATA_COMPARISON && IOCMD_SUPPORT_DATA_LOGGING)
-#define IOCMD_PROC_ONE_BUFFERED_LOG_TEMP_BUF_SIZE  (MAX(25, (MAX(IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT, IOCMD_LOG_DATA_NUM_COLUMNS_TO_PRINT) * 8)) + 1)
+#define IOCMD_PROC_ONE_BUFFERED_LOG_TEMP_BUF_SIZE  MAX(IOCMD_COMPARE_DATA_ROW_SIZE, IOCMD_LOG_DATA_ROW_SIZE)
 #elif(IOCMD_SUPPORT_DATA_COMPARISON)
-#define IOCMD_PROC_ONE_BUFFERED_LOG_TEMP_BUF_SIZE  (MAX(25, (IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT * 8)) + 1)
+#define IOCMD_PROC_ONE_BUFFERED_LOG_TEMP_BUF_SIZE  IOCMD_COMPARE_DATA_ROW_SIZE
 #else
-#define IOCMD_PROC_ONE_BUFFERED_LOG_TEMP_BUF_SIZE  (MAX(25, (IOCMD_LOG_DATA_NUM_COLUMNS_TO_PRINT * 8)) + 1)
+#define IOCMD_PROC_ONE_BUFFERED_LOG_TEMP_BUF_SIZE  IOCMD_LOG_DATA_ROW_SIZE
 #endif
 
+/* every byte of the word is processed in parallel - with no carries between bytes */
+#define IOCMD_ROW_WORD_NUM_BYTES                   sizeof(IOCMD_Row_Word_DT)
+#define IOCMD_ROW_WORD_REPEAT(_byte)               ((((IOCMD_Row_Word_DT)(~((IOCMD_Row_Word_DT)0U))) / 0xFFU) * (IOCMD_Row_Word_DT)(_byte))
+
 #define IOCMD_STORE_CONTEXT_ID_IN_BUF(_buf, _pos, _context_id) \
    (_buf)[(_pos)++] = ((uint8_t*)(&_context_id))[0];           \
    if(sizeof(IOCMD_Context_ID_DT) > 1U)                        \
@@ -129,6 +172,21 @@ typedef uint16_t IOCMD_global_cntr_DT;
 typedef uint32_t IOCMD_global_cntr_DT;
 #endif
 
+#if(IOCMD_SUPPORT_DATA_COMPARISON || IOCMD_SUPPORT_DATA_LOGGING)
+/* native word of the CPU used for rendering data rows; must have 4 or 8 bytes */
+typedef uint_fast32_t IOCMD_Row_Word_DT;
+#endif
+
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+#if(((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) > 0xFFFFFFFF) || IOCMD_OUT_SUPPORT_U64)
+typedef uint64_t IOCMD_Varint_DT;
+#else
+typedef uint32_t IOCMD_Varint_DT;
+#endif
+/* 7 bits of value per byte */
+#define IOCMD_LOG_VARINT_MAX_SIZE            (((sizeof(IOCMD_Varint_DT) * 8U) + 6U) / 7U)
+#endif
+
 
 typedef struct IOCMD_Immediate_Logs_Processor_Params_eXtendedTag
 {
@@ -138,6 +196,235 @@ typedef struct IOCMD_Immediate_Logs_Processor_Params_eXtendedTag
 }IOCMD_Immediate_Logs_Processor_Params_XT;
 
 
+#if(IOCMD_LOG_LOCK_FREE_STAGING || IOCMD_LOG_COMPRESS_OUTSIDE_LOCK || IOCMD_LOG_SINGLE_STORAGE)
+#define IOCMD_LOG_TARGET_MAIN                0x01U
+#define IOCMD_LOG_TARGET_QUIET               0x02U
+#endif
+
+#if(IOCMD_LOG_SINGLE_STORAGE)
+#if((0 == IOCMD_LOG_MAIN_BUF_SIZE) || (0 == IOCMD_LOG_QUIET_BUF_SIZE))
+#error "IOCMD_LOG_SINGLE_STORAGE requires IOCMD_LOG_MAIN_BUF_SIZE and IOCMD_LOG_QUIET_BUF_SIZE bigger than 0"
+#endif
+
+/* targets of the log are stored in 2 highest bits of level byte - all levels / log types are lower than 64 */
+#define IOCMD_LOG_TARGETS_IN_LEVEL_SHIFT     6
+#define IOCMD_LOG_TARGETS_IN_LEVEL_MASK      0xC0U
+/* position of level byte counted from the first byte after log length */
+#define IOCMD_LOG_LEVEL_POS                  (IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_HEADER_TIME_PART_SIZE)
+#endif
+
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY && (0 == (IOCMD_LOG_MAIN_BUF_SIZE + IOCMD_LOG_QUIET_BUF_SIZE)))
+#error "IOCMD_LOG_EXTERNAL_BUF_MEMORY requires IOCMD_LOG_MAIN_BUF_SIZE or IOCMD_LOG_QUIET_BUF_SIZE bigger than 0"
+#endif
+
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY)
+/* buffer given by the application must keep free space which is reserved for the next logs */
+#define IOCMD_LOG_MIN_BUF_SIZE               (2U * (IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH))
+#endif
+
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+#if(!IOCMD_SUPPORT_VARIADIC_MACROS)
+#error "IOCMD_LOG_CALL_SITE_DESCRIPTORS requires IOCMD_SUPPORT_VARIADIC_MACROS"
+#endif
+
+/* index of call site descriptor is stored on 2 bytes; logs of further call sites are stored with line, file and format */
+#define IOCMD_LOG_MAX_NUM_CALL_SITES         0x10000U
+/* used by IOCMD_Log - log without call site descriptor */
+#define IOCMD_LOG_NO_CALL_SITE               IOCMD_LOG_MAX_NUM_CALL_SITES
+#endif
+
+#if(IOCMD_LOG_TYPED_ARGUMENTS && (!IOCMD_LOG_CALL_SITE_DESCRIPTORS))
+#error "IOCMD_LOG_TYPED_ARGUMENTS requires IOCMD_LOG_CALL_SITE_DESCRIPTORS"
+#endif
+
+#if(IOCMD_LOG_HIGH_RES_TIME)
+#if(!IOCMD_LOG_PRINT_TIME)
+#error "IOCMD_LOG_HIGH_RES_TIME requires IOCMD_LOG_PRINT_TIME"
+#endif
+/* TSC frequency is measured by IOCMD_Logs_Init on interval of this number of nanoseconds */
+#define IOCMD_LOG_TSC_MIN_CALIBRATION_TIME   1000000U
+#endif
+
+#if(IOCMD_LOG_TRACE_EXPORT && (!IOCMD_LOG_PRINT_TIME))
+#error "IOCMD_LOG_TRACE_EXPORT requires IOCMD_LOG_PRINT_TIME"
+#endif
+
+#if(IOCMD_LOG_DATA_COMPARE_DIFF_ONLY)
+#if(!IOCMD_SUPPORT_DATA_COMPARISON)
+#error "IOCMD_LOG_DATA_COMPARE_DIFF_ONLY requires IOCMD_SUPPORT_DATA_COMPARISON"
+#endif
+#if((IOCMD_LOG_DATA_COMPARE_DIFF_MAX_SIZE > IOCMD_MAX_LOG__DATA_1_LENGTH) || (IOCMD_LOG_DATA_COMPARE_DIFF_MAX_SIZE > 0xFFFF))
+#error "IOCMD_LOG_DATA_COMPARE_DIFF_MAX_SIZE is too big"
+#endif
+#if(IOCMD_LOG_DATA_COMPARE_DIFF_MAX_SIZE < 2)
+#error "IOCMD_LOG_DATA_COMPARE_DIFF_MAX_SIZE is too small"
+#endif
+#if(IOCMD_LOG_DATA_COMPARE_DIFF_CONTEXT_ROWS < 0)
+#error "IOCMD_LOG_DATA_COMPARE_DIFF_CONTEXT_ROWS must not be negative"
+#endif
+/* number of bytes compared at once when searching for difference - memcmp of constant size is vectorized by compiler */
+#define IOCMD_LOG_DATA_COMPARE_DIFF_BLOCK_SIZE   32U
+#endif
+
+#if(IOCMD_LOG_DATA_COMPRESSION)
+#if(!IOCMD_SUPPORT_DATA_LOGGING)
+#error "IOCMD_LOG_DATA_COMPRESSION requires IOCMD_SUPPORT_DATA_LOGGING"
+#endif
+#if((IOCMD_LOG_DATA_COMPRESSION_HASH_BITS < 4) || (IOCMD_LOG_DATA_COMPRESSION_HASH_BITS > 16))
+#error "IOCMD_LOG_DATA_COMPRESSION_HASH_BITS must be in range 4 - 16"
+#endif
+#if(IOCMD_MAX_LOG__DATA_1_LENGTH > 0xFFFF)
+#error "IOCMD_LOG_DATA_COMPRESSION requires IOCMD_MAX_LOG__DATA_1_LENGTH not bigger than 0xFFFF"
+#endif
+#if(IOCMD_LOG_DATA_COMPRESSION_THRESHOLD < 16)
+#error "IOCMD_LOG_DATA_COMPRESSION_THRESHOLD is too small"
+#endif
+/* minimum length of repeated sequence encoded as match */
+#define IOCMD_LOG_DATA_COMPRESSION_MIN_MATCH     4U
+#endif
+
+#if(IOCMD_LOG_DATA_FRAGMENTATION && (!IOCMD_SUPPORT_DATA_LOGGING))
+#error "IOCMD_LOG_DATA_FRAGMENTATION requires IOCMD_SUPPORT_DATA_LOGGING"
+#endif
+
+#if(IOCMD_LOG_PROFILER)
+#if(!IOCMD_SUPPORT_ENTRANCE_LOGGING)
+#error "IOCMD_LOG_PROFILER requires IOCMD_SUPPORT_ENTRANCE_LOGGING"
+#endif
+#if(!IOCMD_LOG_PRINT_TIME)
+#error "IOCMD_LOG_PROFILER requires IOCMD_LOG_PRINT_TIME"
+#endif
+#ifdef IOCMD_OS_GET_CURRENT_TIME_NOT_PROVIDED
+#error "IOCMD_LOG_PROFILER requires IOCMD_LOG_HIGH_RES_TIME or IOCMD_OS_GET_CURRENT_TIME defined by the application"
+#endif
+#if((IOCMD_LOG_PROFILER_HISTOGRAM_PRECISION < 0) || (IOCMD_LOG_PROFILER_HISTOGRAM_PRECISION > 8))
+#error "IOCMD_LOG_PROFILER_HISTOGRAM_PRECISION must be in range 0 - 8"
+#endif
+#define IOCMD_LOG_PROFILER_SUB_BUCKETS       (1U << IOCMD_LOG_PROFILER_HISTOGRAM_PRECISION)
+#endif
+
+#if(IOCMD_LOG_COMPACT_HEADER)
+#if((!IOCMD_LOG_COMPRESS_OUTSIDE_LOCK) && (!IOCMD_LOG_LOCK_FREE_STAGING))
+#error "IOCMD_LOG_COMPACT_HEADER requires IOCMD_LOG_COMPRESS_OUTSIDE_LOCK or IOCMD_LOG_LOCK_FREE_STAGING"
+#endif
+#if((IOCMD_LOG_COMPACT_HEADER_KEYFRAME_PERIOD < 1) || (IOCMD_LOG_COMPACT_HEADER_KEYFRAME_PERIOD > 255))
+#error "IOCMD_LOG_COMPACT_HEADER_KEYFRAME_PERIOD must be in range 1 - 255"
+#endif
+
+/* flags - first byte of compact header; second byte is level */
+#define IOCMD_LOG_COMPACT_KEYFRAME           0x01U
+#define IOCMD_LOG_COMPACT_CONTEXT            0x02U
+#define IOCMD_LOG_COMPACT_FILE               0x04U
+/* flags, level, counters and time as varints, line, context, file name pointer with its type */
+#define IOCMD_LOG_COMPACT_HEADER_MAX_SIZE    (2 + 5 + 5 + 10 + 2 + IOCMD_LOG_HEADER_CONTEXT_PART_SIZE + 9)
+/* data comparison log - header, 2 data descriptions, 2 data tables and "printf" arguments */
+#define IOCMD_LOG_MAX_NUM_VECTORS            6
+
+#if(IOCMD_LOG_SINGLE_STORAGE)
+#define IOCMD_LOG_COMPACT_LEVEL_MASK         ((uint8_t)(~IOCMD_LOG_TARGETS_IN_LEVEL_MASK))
+#else
+#define IOCMD_LOG_COMPACT_LEVEL_MASK         0xFFU
+#endif
+
+/* logs which have line, context and file name after level */
+#define IOCMD_LOG_HAS_STANDARD_HEADER(level) \
+   (((level) <= IOCMD_LOG_LEVEL_EXT_EXIT) \
+   || (((level) >= IOCMD_LOG_DATA_PRINT_CONTEXT_BEGIN) && ((level) <= IOCMD_LOG_DATA_COMPARE_CONTEXT_END)))
+
+typedef struct IOCMD_Compact_Header_eXtendedTag
+{
+   IOCMD_global_cntr_DT                   global_cntr;
+   IOCMD_global_cntr_DT                   main_cntr;
+#if (IOCMD_LOG_PRINT_TIME)
+   IOCMD_Time_DT                          time;
+#endif
+#if (IOCMD_LOG_PRINT_OS_CONTEXT)
+   uint8_t                                context[IOCMD_LOG_HEADER_CONTEXT_PART_SIZE];
+#endif
+   /* file name pointer with its type, same as in full header */
+   uint8_t                                file[9];
+   uint8_t                                file_size;
+   uint8_t                                level;
+   uint8_t                                line[2];
+   /* size of compact header of this log */
+   uint8_t                                size;
+   /* number of logs which may be stored before next keyframe; 0 - next log has to be a keyframe */
+   uint8_t                                logs_to_keyframe;
+   IOCMD_Bool_DT                          valid;
+}IOCMD_Compact_Header_XT;
+
+typedef struct IOCMD_Compact_Headers_eXtendedTag
+{
+   /* header of the newest log in the buffer - base for compact header of the next stored log */
+   IOCMD_Compact_Header_XT                writer;
+   /* header of the last log read from the buffer - base for decoding compact header of the next read log */
+   IOCMD_Compact_Header_XT                reader;
+}IOCMD_Compact_Headers_XT;
+#endif
+
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+#if(0 != (IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE & (IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE - 1)))
+#error "IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE must be power of 2"
+#endif
+
+/**
+ * Positions of logs in main / quiet buffer counted from initialization of logs module (modulo range of Buff_Size_DT);
+ * position of the oldest log in the buffer is "written" - busy size of the buffer. Positions of logs which were already
+ * read or removed from the buffer are dropped when they are found.
+ */
+typedef struct IOCMD_Log_Index_eXtendedTag
+{
+   /* number of bytes written to the buffer - position of the next log */
+   Buff_Size_DT                           written;
+   /* number of bytes to be written to the buffer before position of next log is kept */
+   Buff_Size_DT                           to_next_mark;
+   /* positions of logs, the oldest one on index "first" */
+   Buff_Size_DT                           marks[IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE];
+   uint_fast16_t                          first;
+   uint_fast16_t                          num;
+}IOCMD_Log_Index_XT;
+#endif
+
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+#if(0 != (IOCMD_LOG_STAGING_NUM_SLOTS & (IOCMD_LOG_STAGING_NUM_SLOTS - 1)))
+#error "IOCMD_LOG_STAGING_NUM_SLOTS must be power of 2"
+#endif
+#if(0 != (IOCMD_LOG_CONTEXT_STAGING_NUM_SLOTS & (IOCMD_LOG_CONTEXT_STAGING_NUM_SLOTS - 1)))
+#error "IOCMD_LOG_CONTEXT_STAGING_NUM_SLOTS must be power of 2"
+#endif
+#if((IOCMD_LOG_STAGING_TRANSFER_THRESHOLD < 1) || (IOCMD_LOG_STAGING_TRANSFER_THRESHOLD > IOCMD_LOG_STAGING_NUM_SLOTS))
+#error "IOCMD_LOG_STAGING_TRANSFER_THRESHOLD must be in range 1 - IOCMD_LOG_STAGING_NUM_SLOTS"
+#endif
+
+#define IOCMD_STAGING_CACHE_LINE_SIZE        64
+
+typedef struct IOCMD_Staging_Slot_eXtendedTag
+{
+   /**
+    * Slot may be reserved for staging ring position "pos" when sequence == pos,
+    * contains published log when sequence == pos + 1 and is free for next round when sequence == pos + number of slots in ring.
+    */
+   _Alignas(IOCMD_STAGING_CACHE_LINE_SIZE) atomic_size_t sequence;
+   /* publishing order of the log among all staging rings */
+   size_t                                 order;
+   uint_fast16_t                          length;
+   uint8_t                                targets;
+   uint8_t                                record[IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH];
+}IOCMD_Staging_Slot_XT;
+
+typedef struct IOCMD_Staging_Ring_eXtendedTag
+{
+   /* next position to be reserved by writers */
+   _Alignas(IOCMD_STAGING_CACHE_LINE_SIZE) atomic_size_t head;
+   /* next position to be moved to log buffers; modified only under IOCMD_PROTECTION_LOCK */
+   _Alignas(IOCMD_STAGING_CACHE_LINE_SIZE) atomic_size_t tail;
+   /* set by writer which moves published logs so other writers don't wait for the lock */
+   atomic_flag                            transferring;
+   IOCMD_Staging_Slot_XT                 *slots;
+   size_t                                 slots_mask;
+}IOCMD_Staging_Ring_XT;
+#endif
+
 typedef struct IOCMD_Params_eXtendedTag
 {
    const IOCMD_Log_Level_Const_Params_XT *levels_tab;
@@ -148,19 +435,33 @@ typedef struct IOCMD_Params_eXtendedTag
       IOCMD_global_cntr_DT                main_cntr;
    }global_cntr;
    IOCMD_PROTECTION_DECLARE()
-#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE))
    Buff_Ring_XT                           main_ring_buf;
 #endif
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
    Buff_Ring_XT                           quiet_ring_buf;
 #endif
-#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
-   uint8_t                                main_buf[IOCMD_LOG_MAIN_BUF_SIZE];
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY)
+   /* memory given by the application; main buffer on its begining, quiet buffer just after it */
+   uint8_t                               *buf_memory;
+#elif((IOCMD_LOG_MAIN_BUF_SIZE + IOCMD_LOG_QUIET_BUF_SIZE) > 0)
+   /* main buffer on the begining, quiet buffer just after it */
+   uint8_t                                buf_memory[IOCMD_LOG_MAIN_BUF_SIZE + IOCMD_LOG_QUIET_BUF_SIZE];
+#endif
+#if(IOCMD_LOG_SINGLE_STORAGE)
+   /* quiet_ring_buf keeps main and quiet logs, every log only once */
+   /* number of bytes from the begining of quiet_ring_buf which were already processed as main logs */
+   Buff_Size_DT                           main_read_pos;
+#if(IOCMD_LOG_COMPACT_HEADER)
+   /* reader - header of the last log processed from main_read_pos */
+   IOCMD_Compact_Headers_XT               main_compact;
 #endif
-#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
-   uint8_t                                quiet_buf[IOCMD_LOG_QUIET_BUF_SIZE];
 #endif
    IOCMD_Log_Level_Data_Params_XT         levels_tab_data[IOCMD_LOG_ID_LAST];
+   /* levels_tab_data with applied temporary levels, updated by IOCMD_Log_Refresh_Tree_State - read on every log */
+   /* main level on bits 0 - 3, quiet level on bits 4 - 7 */
+   uint8_t                                levels_tab_effective[IOCMD_LOG_ID_LAST];
+   uint8_t                                entrances_tab_effective[IOCMD_LOG_ID_LAST];
 #if(IOCMD_SUPPORT_LOGS_POSPONING)
    uint_fast8_t                           logging_not_posponed;
 #endif
@@ -171,6 +472,33 @@ typedef struct IOCMD_Params_eXtendedTag
    uint_fast8_t                           temporary_quiet_level;
 #endif
    uint_fast8_t                           temporary_entrance_level;
+#if(IOCMD_LOG_COMPACT_HEADER)
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE))
+   IOCMD_Compact_Headers_XT               main_compact;
+#endif
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+   IOCMD_Compact_Headers_XT               quiet_compact;
+#endif
+#endif
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE))
+   IOCMD_Log_Index_XT                     main_index;
+#endif
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+   IOCMD_Log_Index_XT                     quiet_index;
+#endif
+#endif
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+   IOCMD_Staging_Ring_XT                  staging;
+   IOCMD_Staging_Slot_XT                  staging_slots[IOCMD_LOG_STAGING_NUM_SLOTS];
+#if(IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0)
+   IOCMD_Staging_Ring_XT                  context_staging[IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS];
+   IOCMD_Staging_Slot_XT                  context_staging_slots[IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS][IOCMD_LOG_CONTEXT_STAGING_NUM_SLOTS];
+   /* set while ring is owned by a thread; not cleared by IOCMD_Logs_Init - threads keep their rings */
+   atomic_bool                            context_staging_taken[IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS];
+#endif
+   _Alignas(IOCMD_STAGING_CACHE_LINE_SIZE) atomic_size_t staging_order;
+#endif
 }IOCMD_Params_XT;
 
 typedef struct IOCMD_standard_header_and_main_string_eXtended_Tag
@@ -190,12 +518,94 @@ typedef struct IOCMD_standard_header_and_main_string_eXtended_Tag
 #endif
    const char             *file;
    const char             *main_string;
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+   IOCMD_Bool_DT           varint_args;
+#endif
+#if(IOCMD_LOG_TYPED_ARGUMENTS)
+   IOCMD_Bool_DT           typed_args;
+#endif
 }IOCMD_standard_header_and_main_string_XT;
 
+#if(IOCMD_LOG_HIGH_RES_TIME)
+typedef struct IOCMD_Time_Params_eXtended_Tag
+{
+   /* IOCMD_TRUE if ticks are read from TSC, otherwise ticks are nanoseconds of CLOCK_MONOTONIC */
+   IOCMD_Bool_DT           tsc;
+   /* ticks, CLOCK_MONOTONIC and CLOCK_REALTIME nanoseconds read by IOCMD_Logs_Init */
+   uint64_t                start_ticks;
+   uint64_t                start_ns;
+   uint64_t                start_realtime_ns;
+   /* TSC period measured by IOCMD_Logs_Init, then on longer intervals when logs are printed */
+   _Atomic double          ns_per_tick;
+   /* ticks from start_ticks after which TSC is measured again - doubled by every measurement */
+   _Atomic uint64_t        next_calibration_ticks;
+}IOCMD_Time_Params_XT;
+#endif
+
+#if(IOCMD_LOG_TRACE_EXPORT)
+typedef struct IOCMD_Trace_Escape_eXtended_Tag
+{
+   /* exe given to printing functions - escapes everything printed through it as JSON string */
+   IOCMD_Print_Exe_Params_XT        exe;
+   const IOCMD_Print_Exe_Params_XT *out;
+   /* ends of lines are printed only if some text follows them - last end of line of log is not part of the string */
+   int                              pending_endl;
+}IOCMD_Trace_Escape_XT;
+#endif
+
+#if(IOCMD_LOG_PROFILER)
+typedef struct IOCMD_Profiler_Frame_eXtended_Tag
+{
+   const char             *func_name;
+   IOCMD_Time_DT           enter_time;
+}IOCMD_Profiler_Frame_XT;
+
+typedef struct IOCMD_Profiler_Stack_eXtended_Tag
+{
+   IOCMD_Profiler_Frame_XT frames[IOCMD_LOG_PROFILER_STACK_DEPTH];
+   /* number of entered and not exited functions - can be bigger than IOCMD_LOG_PROFILER_STACK_DEPTH */
+   size_t                  depth;
+}IOCMD_Profiler_Stack_XT;
+
+typedef struct IOCMD_Profiler_Function_eXtended_Tag
+{
+   /* slot is taken by the first thread which exits the function; never released */
+   _Atomic(const char*)    func_name;
+   /* set by the thread which took the slot, file after id (release) - id is valid when file is */
+   _Atomic(const char*)    file;
+   _Atomic IOCMD_Log_ID_DT id;
+   /* number of calls is not counted separately - it is sum of histogram */
+   _Atomic uint64_t        total_time;
+   _Atomic uint64_t        min_time;
+   _Atomic uint64_t        max_time;
+   _Atomic uint32_t        histogram[IOCMD_LOG_PROFILER_NUM_BUCKETS];
+}IOCMD_Profiler_Function_XT;
+#endif
+
 static IOCMD_Params_XT IOCMD_Params;
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+/* position (+1) of the newest log published by current thread in common staging ring */
+static _Thread_local size_t IOCMD_staging_published;
+#if(IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0)
+/* staging ring used by current thread - own context ring or common one if all context rings were taken */
+static _Thread_local IOCMD_Staging_Ring_XT *IOCMD_context_staging_ring;
+#endif
+#endif
 #if(IOCMD_SUPPORT_IMMEDIATE_LOGS_PRINTING)
 static IOCMD_Immediate_Logs_Processor_Params_XT IOCMD_ILP;
 #endif
+#if(IOCMD_LOG_HIGH_RES_TIME)
+static IOCMD_Time_Params_XT IOCMD_time;
+#endif
+#if(IOCMD_LOG_PROFILER)
+static _Thread_local IOCMD_Profiler_Stack_XT IOCMD_profiler_stack;
+static IOCMD_Profiler_Function_XT IOCMD_profiler_functions[IOCMD_LOG_PROFILER_NUM_FUNCTIONS];
+#endif
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+/* begin and end of call sites section; weak - program without any log macro has no such section */
+extern const IOCMD_Log_Call_Site_XT IOCMD_LOG_CALL_SITES_BEGIN[] __attribute__((weak));
+extern const IOCMD_Log_Call_Site_XT IOCMD_LOG_CALL_SITES_END[] __attribute__((weak));
+#endif
 
 static const char * const IOCMD_level_strings[] =
 {
@@ -249,73 +659,172 @@ static const uint_fast8_t iocmd_os_critical_switch_const = IOCMD_ENTRANCE_DISABL
 const uint_fast8_t *IOCMD_Os_Critical_Switch = &iocmd_os_critical_switch_const;
 #endif
 
+#if(IOCMD_LOG_INLINE_LEVEL_CHECK)
+uint8_t IOCMD_Log_Effective_Levels[IOCMD_LOG_ID_LAST];
+#endif
+
 #if(IOCMD_SUPPORT_DATA_COMPARISON || IOCMD_SUPPORT_DATA_LOGGING)
-static uint8_t IOCMD_debug_format_u8(char *buf, const uint8_t *data, size_t data_size)
+static IOCMD_Row_Word_DT IOCMD_row_word_load(const uint8_t *data, uint_fast8_t num_bytes)
 {
-   int cntr = 0;
-   size_t result;
+   IOCMD_Row_Word_DT result = 0U;
 
-   for(result = 0U; result < 8U; ++result)
-   {
-      if(data_size > result)
-      {
-         cntr += IOCMD_Utoa8(&buf[cntr], data[result], 16U, 2U, '0', IOCMD_TRUE);
-         buf[cntr++] = ',';
-      }
-      else
-      {
-         break;
-      }
-   }
-   buf[cntr++] = ' ';
-   if(cntr < 25)
+   while(num_bytes > 0U)
    {
-      memset(&buf[cntr], ' ', 25 - cntr);
+      num_bytes--;
+      result = (result << 8) | data[num_bytes];
    }
-   buf[25] = '\0';
 
    return result;
-} /* IOCMD_debug_format_u8 */
-#endif
+} /* IOCMD_row_word_load */
 
-#if(IOCMD_SUPPORT_DATA_COMPARISON)
-static uint8_t IOCMD_debug_format_dif8(
-   char *buf, const uint8_t *data1, uint_fast16_t data1_size, const uint8_t *data2, uint_fast16_t data2_size)
+static IOCMD_Row_Word_DT IOCMD_row_word_equal_bytes(IOCMD_Row_Word_DT word1, IOCMD_Row_Word_DT word2)
+{
+   IOCMD_Row_Word_DT dif = word1 ^ word2;
+
+   /* 0x80 in every byte which is not 0 */
+   dif = (((dif & IOCMD_ROW_WORD_REPEAT(0x7FU)) + IOCMD_ROW_WORD_REPEAT(0x7FU)) | dif) & IOCMD_ROW_WORD_REPEAT(0x80U);
+
+   /* 0xFF in every byte which is equal */
+   return ((dif >> 7) ^ IOCMD_ROW_WORD_REPEAT(0x01U)) * 0xFFU;
+} /* IOCMD_row_word_equal_bytes */
+
+static IOCMD_Row_Word_DT IOCMD_row_word_printable_bytes(IOCMD_Row_Word_DT word)
+{
+   IOCMD_Row_Word_DT low7 = word & IOCMD_ROW_WORD_REPEAT(0x7FU);
+
+   /* 0x80 in every byte which is not lower than ' ', not higher than '~' and has no highest bit set */
+   low7 = (low7 + IOCMD_ROW_WORD_REPEAT(0x80U - ' ')) & (~(low7 + IOCMD_ROW_WORD_REPEAT(0x01U))) & (~word) & IOCMD_ROW_WORD_REPEAT(0x80U);
+
+   /* 0xFF in every printable byte */
+   return (low7 >> 7) * 0xFFU;
+} /* IOCMD_row_word_printable_bytes */
+
+static IOCMD_Row_Word_DT IOCMD_row_word_nibbles_to_hex(IOCMD_Row_Word_DT nibbles)
+{
+   /* bit 4 of (nibble + 6) is set only for nibbles 'A' - 'F' which are 7 characters away from '9' + 1 */
+   return nibbles + IOCMD_ROW_WORD_REPEAT('0')
+      + ((((nibbles + IOCMD_ROW_WORD_REPEAT(0x06U)) >> 4) & IOCMD_ROW_WORD_REPEAT(0x01U)) * 7U);
+} /* IOCMD_row_word_nibbles_to_hex */
+
+/**
+ * Renders hex part of data row: every byte as "XX," and space after every 8 bytes (one column).
+ * Bytes out of data_size are replaced by spaces. If ref is valid then bytes equal to ref are rendered as "==,".
+ * Returns pointer to the first character after rendered part; string is not terminated.
+ */
+static char *IOCMD_render_hex_row(
+   char *row, const uint8_t *data, const uint8_t *ref, uint_fast16_t data_size, uint_fast16_t num_bytes_to_print)
 {
-   int cntr = 0;
-   uint_fast16_t result;
-   uint_fast16_t data_size = (data1_size > data2_size) ? data2_size : data1_size;
+   IOCMD_Row_Word_DT word;
+   IOCMD_Row_Word_DT high;
+   IOCMD_Row_Word_DT low;
+   IOCMD_Row_Word_DT equal;
+   uint_fast16_t cntr;
+   uint_fast8_t num_bytes;
+   uint_fast8_t byte;
 
-   for(result = 0U; result < 8U; ++result)
+   for(cntr = 0U; cntr < num_bytes_to_print; cntr += IOCMD_ROW_WORD_NUM_BYTES)
    {
-      if(data_size > result)
+      if(data_size <= cntr)
+      {
+         num_bytes = 0U;
+      }
+      else if((data_size - cntr) >= IOCMD_ROW_WORD_NUM_BYTES)
+      {
+         num_bytes = IOCMD_ROW_WORD_NUM_BYTES;
+      }
+      else
+      {
+         num_bytes = (uint_fast8_t)(data_size - cntr);
+      }
+
+      if(num_bytes > 0U)
       {
-         if(data1[result] != data2[result])
+         word = IOCMD_row_word_load(&data[cntr], num_bytes);
+         high = IOCMD_row_word_nibbles_to_hex((word >> 4) & IOCMD_ROW_WORD_REPEAT(0x0FU));
+         low  = IOCMD_row_word_nibbles_to_hex(word & IOCMD_ROW_WORD_REPEAT(0x0FU));
+
+         if(IOCMD_CHECK_PTR(const uint8_t, ref))
          {
-            cntr += IOCMD_Utoa8(&buf[cntr], data2[result], 16U, 2U, '0', IOCMD_TRUE);
-            buf[cntr++] = ',';
+            equal = IOCMD_row_word_equal_bytes(word, IOCMD_row_word_load(&ref[cntr], num_bytes));
+            high  = (high & (~equal)) | (IOCMD_ROW_WORD_REPEAT('=') & equal);
+            low   = (low  & (~equal)) | (IOCMD_ROW_WORD_REPEAT('=') & equal);
          }
-         else
+
+         for(byte = 0U; byte < num_bytes; ++byte)
          {
-            buf[cntr++] = '=';
-            buf[cntr++] = '=';
-            buf[cntr++] = ',';
+            row[0] = (char)((uint8_t)(high >> (8U * byte)));
+            row[1] = (char)((uint8_t)(low  >> (8U * byte)));
+            row[2] = ',';
+            row   += 3;
          }
       }
-      else
+
+      if(num_bytes < IOCMD_ROW_WORD_NUM_BYTES)
       {
-         break;
+         memset(row, ' ', 3U * (IOCMD_ROW_WORD_NUM_BYTES - num_bytes));
+         row += 3U * (IOCMD_ROW_WORD_NUM_BYTES - num_bytes);
+      }
+
+      if(0U == ((cntr + IOCMD_ROW_WORD_NUM_BYTES) % 8U))
+      {
+         *row = ' ';
+         row++;
       }
    }
-   buf[cntr++] = ' ';
-   if(cntr < 25)
+
+   return row;
+} /* IOCMD_render_hex_row */
+
+/**
+ * Renders ASCII part of data row: not printable characters are replaced by '.'.
+ * If ref is valid then bytes equal to ref are rendered as '=' and all other '=' characters as '.'.
+ * Returns pointer to the first character after rendered part; string is not terminated.
+ */
+static char *IOCMD_render_ascii_row(char *row, const uint8_t *data, const uint8_t *ref, uint_fast16_t data_size)
+{
+   IOCMD_Row_Word_DT word;
+   IOCMD_Row_Word_DT printable;
+   IOCMD_Row_Word_DT equal;
+   uint_fast16_t cntr;
+   uint_fast8_t num_bytes;
+   uint_fast8_t byte;
+
+   for(cntr = 0U; cntr < data_size; cntr += num_bytes)
    {
-      memset(&buf[cntr], ' ', 25 - cntr);
+      if((data_size - cntr) >= IOCMD_ROW_WORD_NUM_BYTES)
+      {
+         num_bytes = IOCMD_ROW_WORD_NUM_BYTES;
+      }
+      else
+      {
+         num_bytes = (uint_fast8_t)(data_size - cntr);
+      }
+
+      word      = IOCMD_row_word_load(&data[cntr], num_bytes);
+      printable = IOCMD_row_word_printable_bytes(word);
+
+      if(IOCMD_CHECK_PTR(const uint8_t, ref))
+      {
+         printable &= ~IOCMD_row_word_equal_bytes(word, IOCMD_ROW_WORD_REPEAT('='));
+         equal      = IOCMD_row_word_equal_bytes(word, IOCMD_row_word_load(&ref[cntr], num_bytes));
+      }
+      else
+      {
+         equal      = 0U;
+      }
+
+      word = (word & printable) | (IOCMD_ROW_WORD_REPEAT('.') & (~printable));
+      word = (word & (~equal))  | (IOCMD_ROW_WORD_REPEAT('=') & equal);
+
+      for(byte = 0U; byte < num_bytes; ++byte)
+      {
+         row[byte] = (char)((uint8_t)(word >> (8U * byte)));
+      }
+      row += num_bytes;
    }
-   buf[25] = '\0';
 
-   return result;
-} /* IOCMD_debug_format_dif8 */
+   return row;
+} /* IOCMD_render_ascii_row */
 #endif
 
 static const char *IOCMD_file_name_remove_path(const char* name)
@@ -335,216 +844,1550 @@ static const char *IOCMD_file_name_remove_path(const char* name)
    return(&name[pos]);
 } /* IOCMD_file_name_remove_path */
 
-static void IOCMD_reduce_buf(Buff_Ring_XT *buf, Buff_Size_DT length)
+#if(IOCMD_LOG_HIGH_RES_TIME)
+static uint64_t IOCMD_time_get_ns(clockid_t clock)
 {
-   uint8_t size[2];
-   Buff_Size_DT len;
-   Buff_Size_DT blen8;
+   struct timespec ts;
+   uint64_t result = 0U;
+
+   if(0 == clock_gettime(clock, &ts))
+   {
+      result = ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+   }
+
+   return result;
+} /* IOCMD_time_get_ns */
+
+static void IOCMD_time_init(void)
+{
+#if(IOCMD_LOG_TSC_SUPPORTED)
+   unsigned int eax;
+   unsigned int ebx;
+   unsigned int ecx;
+   unsigned int edx;
+   uint64_t     ns;
+   uint64_t     ticks;
+#endif
 
-   blen8 = buf->size / 8U;
+   IOCMD_time.tsc = IOCMD_FALSE;
 
-   if(BUFF_LIKELY(length < blen8))
+#if(IOCMD_LOG_TSC_SUPPORTED)
+   /* TSC is used only if it is invariant - ticks with constant frequency independent to CPU power states */
+   if((0 != __get_cpuid(0x80000007U, &eax, &ebx, &ecx, &edx)) && (0U != (edx & 0x100U)))
    {
-      length = blen8;
+      IOCMD_time.tsc = IOCMD_TRUE;
    }
+#endif
 
-   do
+   IOCMD_time.start_realtime_ns  = IOCMD_time_get_ns(CLOCK_REALTIME);
+   IOCMD_time.start_ns           = IOCMD_time_get_ns(CLOCK_MONOTONIC);
+   IOCMD_time.start_ticks        = IOCMD_Log_Get_Time();
+
+   atomic_store_explicit(&(IOCMD_time.ns_per_tick), 1.0, memory_order_relaxed);
+   atomic_store_explicit(&(IOCMD_time.next_calibration_ticks), UINT64_MAX, memory_order_relaxed);
+
+#if(IOCMD_LOG_TSC_SUPPORTED)
+   if(IOCMD_BOOL_IS_TRUE(IOCMD_time.tsc) && (0U != IOCMD_time.start_ns))
    {
-      (void)Buff_Ring_Peak(buf, size, sizeof(size), 0U, BUFF_FALSE);
+      /* period is measured once here, on short interval, so time of logs does not depend on when they are printed */
+      do
+      {
+         ns = IOCMD_time_get_ns(CLOCK_MONOTONIC) - IOCMD_time.start_ns;
+      }while(ns < IOCMD_LOG_TSC_MIN_CALIBRATION_TIME);
 
-      len = ((Buff_Size_DT)(size[0])) & 0x7FU;
-      if(0U != (size[0] & 0x80U))
+      ticks = (uint64_t)__rdtsc() - IOCMD_time.start_ticks;
+
+      atomic_store_explicit(&(IOCMD_time.ns_per_tick), (double)ns / (double)ticks, memory_order_relaxed);
+      atomic_store_explicit(&(IOCMD_time.next_calibration_ticks), 2U * ticks, memory_order_relaxed);
+   }
+#endif
+} /* IOCMD_time_init */
+
+/**
+ * Measures TSC period again when interval from IOCMD_Logs_Init doubled since previous measurement -
+ * clock_gettime is called only few times and precision grows with length of the interval.
+ * Can be called by many threads at the same time - only the one which moved next_calibration_ticks measures.
+ */
+static void IOCMD_time_calibrate(void)
+{
+#if(IOCMD_LOG_TSC_SUPPORTED)
+   uint64_t ns;
+   uint64_t ticks;
+   uint64_t next;
+
+   if(IOCMD_BOOL_IS_TRUE(IOCMD_time.tsc))
+   {
+      ticks = (uint64_t)__rdtsc() - IOCMD_time.start_ticks;
+      next  = atomic_load_explicit(&(IOCMD_time.next_calibration_ticks), memory_order_relaxed);
+
+      if((ticks >= next)
+         && atomic_compare_exchange_strong_explicit(
+            &(IOCMD_time.next_calibration_ticks), &next, 2U * ticks, memory_order_relaxed, memory_order_relaxed))
       {
-         len = IOCMD_MUL_BY_POWER_OF_2(len, 8);
-         len += size[1];
+         ns    = IOCMD_time_get_ns(CLOCK_MONOTONIC) - IOCMD_time.start_ns;
+         ticks = (uint64_t)__rdtsc() - IOCMD_time.start_ticks;
+
+         atomic_store_explicit(&(IOCMD_time.ns_per_tick), (double)ns / (double)ticks, memory_order_relaxed);
       }
+   }
+#endif
+} /* IOCMD_time_calibrate */
 
-      (void)Buff_Ring_Remove(buf, len, BUFF_FALSE);
-   }while(BUFF_RING_GET_FREE_SIZE(buf) < length);
-} /* IOCMD_reduce_buf */
+/**
+ * Converts time of the log to nanoseconds from IOCMD_Logs_Init. Logs stored before it (time from previous initialization,
+ * or read by other CPU just before start_ticks) get 0.
+ */
+static uint64_t IOCMD_time_since_start_ns(IOCMD_Time_DT time)
+{
+   int64_t  ticks;
+   uint64_t ns = 0U;
 
-static uint_fast16_t IOCMD_add_u32_to_buf(IOCMD_Buffer_Convert_UT *data, uint8_t *buf, uint_fast16_t buf_size, uint_fast16_t result, uint8_t base_type)
+   IOCMD_time_calibrate();
+
+   ticks = (int64_t)(time - IOCMD_time.start_ticks);
+
+   if(ticks > 0)
+   {
+      ns = (uint64_t)((double)ticks * atomic_load_explicit(&(IOCMD_time.ns_per_tick), memory_order_relaxed));
+   }
+
+   return ns;
+} /* IOCMD_time_since_start_ns */
+
+static void IOCMD_print_time(const IOCMD_Print_Exe_Params_XT *exe, IOCMD_Time_DT time)
 {
-   if(0U == data->u16_field.u16_1)
+   uint64_t us;
+
+   us = IOCMD_time_since_start_ns(time) / 1000U;
+
+#if(IOCMD_LOG_HIGH_RES_TIME_WALL_CLOCK)
+   us = (us + (IOCMD_time.start_realtime_ns / 1000U)) % (24ULL * 3600ULL * 1000000ULL);
+
+   IOCMD_Oprintf(exe, " [%02u:%02u:%02u.%06u]",
+      (unsigned)(us / (3600ULL * 1000000ULL)),
+      (unsigned)((us / 60000000U) % 60U),
+      (unsigned)((us / 1000000U) % 60U),
+      (unsigned)(us % 1000000U));
+#else
+   IOCMD_Oprintf(exe, " [%6u.%06u]", (unsigned)(us / 1000000U), (unsigned)(us % 1000000U));
+#endif
+} /* IOCMD_print_time */
+#endif
+
+#if(IOCMD_LOG_PROFILER)
+static uint_fast16_t IOCMD_profiler_get_bucket(uint64_t time)
+{
+   uint_fast16_t shift = 0U;
+
+   /* time is shifted right until it fits in range SUB_BUCKETS .. 2 * SUB_BUCKETS - 1; linear buckets inside each range */
+   while(time >= (2U * IOCMD_LOG_PROFILER_SUB_BUCKETS))
    {
-      if(0U == data->u8_field.u8_1)
+      time = IOCMD_DIV_BY_POWER_OF_2(time, 1);
+      shift++;
+   }
+
+   return (uint_fast16_t)((shift * IOCMD_LOG_PROFILER_SUB_BUCKETS) + (uint_fast16_t)time);
+} /* IOCMD_profiler_get_bucket */
+
+static IOCMD_Profiler_Function_XT *IOCMD_profiler_get_function(IOCMD_Log_ID_DT id, const char *file, const char *func_name)
+{
+   IOCMD_Profiler_Function_XT *result = IOCMD_MAKE_INVALID_PTR(IOCMD_Profiler_Function_XT);
+   IOCMD_Profiler_Function_XT *function;
+   const char *expected;
+   size_t index = (size_t)(IOCMD_DIV_BY_POWER_OF_2((uintptr_t)func_name, 3) % IOCMD_LOG_PROFILER_NUM_FUNCTIONS);
+   size_t cntr;
+
+   /* open addressing by address of function name - the same string is used by all calls of the function */
+   for(cntr = 0U; (cntr < IOCMD_LOG_PROFILER_NUM_FUNCTIONS) && (!IOCMD_CHECK_PTR(IOCMD_Profiler_Function_XT, result)); cntr++)
+   {
+      function = &IOCMD_profiler_functions[index];
+      expected = atomic_load_explicit(&(function->func_name), memory_order_acquire);
+
+      if(!IOCMD_CHECK_PTR(const char, expected))
       {
-         if(buf_size >= 2U)
+         if(atomic_compare_exchange_strong_explicit(
+            &(function->func_name), &expected, func_name, memory_order_acq_rel, memory_order_acquire))
          {
-            buf[result++] = base_type;
-            buf[result++] = data->u8_field.u8_0;
+            /* until these are set, slot is reported with invalid file and id 0 */
+            atomic_store_explicit(&(function->id),   id,   memory_order_relaxed);
+            atomic_store_explicit(&(function->file), file, memory_order_release);
+            result = function;
          }
       }
-      else if(buf_size >= 3U)
+
+      /* slot could be taken by other thread in the meantime - for the same or other function */
+      if(expected == func_name)
       {
-         buf[result++] = base_type + 1U;
-         buf[result++] = data->u8_field.u8_0;
-         buf[result++] = data->u8_field.u8_1;
+         result = function;
       }
+
+      index = (index + 1U) % IOCMD_LOG_PROFILER_NUM_FUNCTIONS;
    }
-   else
-   {
-      if(0U == data->u8_field.u8_3)
+
+   return result;
+} /* IOCMD_profiler_get_function */
+
+static void IOCMD_profiler_record(IOCMD_Profiler_Function_XT *function, uint64_t time)
+{
+   uint64_t prev;
+
+   (void)atomic_fetch_add_explicit(&(function->total_time), time, memory_order_relaxed);
+   (void)atomic_fetch_add_explicit(&(function->histogram[IOCMD_profiler_get_bucket(time)]), 1U, memory_order_relaxed);
+
+   prev = atomic_load_explicit(&(function->min_time), memory_order_relaxed);
+   while((time < prev)
+      && (!atomic_compare_exchange_weak_explicit(&(function->min_time), &prev, time, memory_order_relaxed, memory_order_relaxed)))
+   {
+      /* prev updated by failed exchange, try again */
+   }
+
+   prev = atomic_load_explicit(&(function->max_time), memory_order_relaxed);
+   while((time > prev)
+      && (!atomic_compare_exchange_weak_explicit(&(function->max_time), &prev, time, memory_order_relaxed, memory_order_relaxed)))
+   {
+      /* prev updated by failed exchange, try again */
+   }
+} /* IOCMD_profiler_record */
+
+static void IOCMD_profiler_enter_exit(IOCMD_Log_ID_DT id, uint_fast8_t enter_exit, const char *file, const char *func_name)
+{
+   IOCMD_Profiler_Stack_XT    *stack = &IOCMD_profiler_stack;
+   IOCMD_Profiler_Function_XT *function;
+   IOCMD_Time_DT               time = (IOCMD_Time_DT)IOCMD_OS_GET_CURRENT_TIME();
+   size_t                      pos;
+
+   if(IOCMD_LOG_LEVEL_EXT_ENTER == enter_exit)
+   {
+      if(stack->depth < IOCMD_LOG_PROFILER_STACK_DEPTH)
       {
-         if(buf_size >= 4U)
-         {
-            buf[result++] = base_type + 2U;
-            buf[result++] = data->u8_field.u8_0;
-            buf[result++] = data->u8_field.u8_1;
-            buf[result++] = data->u8_field.u8_2;
-         }
+         stack->frames[stack->depth].func_name  = func_name;
+         stack->frames[stack->depth].enter_time = time;
       }
-      else if(buf_size >= 5U)
+      stack->depth++;
+   }
+   else if(stack->depth > IOCMD_LOG_PROFILER_STACK_DEPTH)
+   {
+      /* function entered too deep to be profiled */
+      stack->depth--;
+   }
+   else
+   {
+      /**
+       * function is searched from the top of the stack - if exits of functions called by it were missed
+       * then their frames are dropped; exit without matching enter (e.g. entered before profiling was enabled) is ignored
+       */
+      pos = stack->depth;
+      while((pos > 0U) && (stack->frames[pos - 1U].func_name != func_name))
       {
-         buf[result++] = base_type + 3U;
-         buf[result++] = data->u8_field.u8_0;
-         buf[result++] = data->u8_field.u8_1;
-         buf[result++] = data->u8_field.u8_2;
-         buf[result++] = data->u8_field.u8_3;
+         pos--;
+      }
+
+      if(pos > 0U)
+      {
+         stack->depth = pos - 1U;
+
+         function = IOCMD_profiler_get_function(id, file, func_name);
+
+         if(IOCMD_CHECK_PTR(IOCMD_Profiler_Function_XT, function))
+         {
+            IOCMD_profiler_record(function, (uint64_t)((IOCMD_Time_DT)(time - stack->frames[pos - 1U].enter_time)));
+         }
       }
    }
+} /* IOCMD_profiler_enter_exit */
+#endif
+
+#if(IOCMD_LOG_COMPACT_HEADER)
+static IOCMD_Compact_Headers_XT *IOCMD_get_compact_headers(const Buff_Ring_XT *buf)
+{
+   IOCMD_Compact_Headers_XT *result;
+
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE))
+   result = (buf == &(IOCMD_Params.main_ring_buf)) ? &(IOCMD_Params.main_compact) : &(IOCMD_Params.quiet_compact);
+#elif((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE))
+   IOCMD_UNUSED_PARAM(buf);
+   result = &(IOCMD_Params.main_compact);
+#else
+   /* in single storage mode writer and reader of quiet_compact are used for the whole buffer */
+   IOCMD_UNUSED_PARAM(buf);
+   result = &(IOCMD_Params.quiet_compact);
+#endif
 
    return result;
-} /* IOCMD_add_u32_to_buf */
+} /* IOCMD_get_compact_headers */
 
-#if (((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) > 0xFFFFFFFF) || IOCMD_OUT_SUPPORT_U64)
-static uint_fast16_t IOCMD_add_u64_to_buf(IOCMD_Buffer_Convert_UT *data, uint8_t *buf, uint_fast16_t buf_size, uint_fast16_t result, uint8_t base_type)
+static uint_fast8_t IOCMD_compact_add_varint(uint8_t *buf, uint_fast8_t pos, uint64_t value)
 {
-   uint8_t *ptr;
+   while(value >= 0x80U)
+   {
+      buf[pos++] = (uint8_t)(value & 0x7FU) | 0x80U;
+      value = IOCMD_DIV_BY_POWER_OF_2(value, 7);
+   }
+   buf[pos++] = (uint8_t)value;
 
-   if(0U == data->u32_field.u32_1)
+   return pos;
+} /* IOCMD_compact_add_varint */
+
+static IOCMD_Bool_DT IOCMD_compact_get_varint(const uint8_t *buf, uint_fast8_t size, uint_fast8_t *pos, uint64_t *value)
+{
+   uint64_t     result = 0U;
+   uint_fast8_t shift  = 0U;
+   uint8_t      part   = 0x80U;
+
+   while((0U != (part & 0x80U)) && (*pos < size) && (shift < 64U))
    {
-      result = IOCMD_add_u32_to_buf(data, buf, buf_size, result, base_type);
+      part = buf[(*pos)++];
+      result |= IOCMD_MUL_BY_POWER_OF_2((uint64_t)(part & 0x7FU), shift);
+      shift += 7U;
    }
-   else if((buf_size - result) >= 6U)
+
+   *value = result;
+
+   return (0U == (part & 0x80U)) ? IOCMD_TRUE : IOCMD_FALSE;
+} /* IOCMD_compact_get_varint */
+
+/**
+ * Converts full header of the log (starting from global cntr) to compact one.
+ * Counters and time are stored as differences to the previous log stored in the same buffer, context and file name
+ * only when they changed. Every IOCMD_LOG_COMPACT_HEADER_KEYFRAME_PERIOD log is a keyframe - differences are counted from 0
+ * so it can be decoded without previous logs.
+ */
+static uint_fast8_t IOCMD_compact_header_encode(
+   uint8_t *compact, const uint8_t *full, IOCMD_Compact_Header_XT *writer, uint_fast8_t *full_size)
+{
+   IOCMD_Compact_Header_XT header;
+   IOCMD_Compact_Header_XT base;
+#if (IOCMD_LOG_PRINT_TIME)
+   IOCMD_Time_DT           time;
+#endif
+   uint_fast8_t            pos  = 0U;
+   uint_fast8_t            cntr = 2U;
+   uint8_t                 flags;
+
+   if(IOCMD_BOOL_IS_TRUE(writer->valid) && (writer->logs_to_keyframe > 0U))
    {
-      ptr = &buf[result + 1];
+      flags = 0U;
+      base  = *writer;
+      base.logs_to_keyframe--;
+   }
+   else
+   {
+      flags = IOCMD_LOG_COMPACT_KEYFRAME;
+      memset(&base, 0, sizeof(base));
+      base.logs_to_keyframe = IOCMD_LOG_COMPACT_HEADER_KEYFRAME_PERIOD - 1U;
+   }
 
-      if(0U == data->u16_field.u16_3)
+   /* context and file name of logs without them (OS context switch) are taken from base */
+   header = base;
+
+   memcpy(&(header.global_cntr), &full[pos], sizeof(IOCMD_global_cntr_DT));
+   pos += sizeof(IOCMD_global_cntr_DT);
+   memcpy(&(header.main_cntr), &full[pos], sizeof(IOCMD_global_cntr_DT));
+   pos += sizeof(IOCMD_global_cntr_DT);
+#if (IOCMD_LOG_PRINT_TIME)
+   memcpy(&(header.time), &full[pos], sizeof(IOCMD_Time_DT));
+   pos += sizeof(IOCMD_Time_DT);
+#endif
+   header.level = full[pos++];
+
+   compact[1] = header.level;
+   cntr = IOCMD_compact_add_varint(compact, cntr, (IOCMD_global_cntr_DT)(header.global_cntr - base.global_cntr));
+   cntr = IOCMD_compact_add_varint(compact, cntr, (IOCMD_global_cntr_DT)(header.main_cntr - base.main_cntr));
+#if (IOCMD_LOG_PRINT_TIME)
+   /* zig-zag - time of log compressed outside of the lock can be a bit older than time of previous log */
+   time = (IOCMD_Time_DT)(header.time - base.time);
+   time = (IOCMD_Time_DT)(IOCMD_MUL_BY_POWER_OF_2(time, 1)
+      ^ (IOCMD_Time_DT)(0U - IOCMD_DIV_BY_POWER_OF_2(time, (sizeof(IOCMD_Time_DT) * 8U) - 1U)));
+   cntr = IOCMD_compact_add_varint(compact, cntr, time);
+#endif
+
+   if(IOCMD_LOG_HAS_STANDARD_HEADER(header.level & IOCMD_LOG_COMPACT_LEVEL_MASK))
+   {
+      header.line[0] = full[pos++];
+      header.line[1] = full[pos++];
+      compact[cntr++] = header.line[0];
+      compact[cntr++] = header.line[1];
+
+#if (IOCMD_LOG_PRINT_OS_CONTEXT)
+      memcpy(header.context, &full[pos], sizeof(header.context));
+      pos += sizeof(header.context);
+      if(0 != memcmp(header.context, base.context, sizeof(header.context)))
       {
-         if(0U == data->u8_field.u8_5)
+         flags |= IOCMD_LOG_COMPACT_CONTEXT;
+         memcpy(&compact[cntr], header.context, sizeof(header.context));
+         cntr += sizeof(header.context);
+      }
+#endif
+
+      header.file_size = full[pos] - IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B + 2U;
+      memcpy(header.file, &full[pos], header.file_size);
+      pos += header.file_size;
+      if((header.file_size != base.file_size) || (0 != memcmp(header.file, base.file, header.file_size)))
+      {
+         flags |= IOCMD_LOG_COMPACT_FILE;
+         memcpy(&compact[cntr], header.file, header.file_size);
+         cntr += header.file_size;
+      }
+   }
+
+   compact[0] = flags;
+
+   header.size  = (uint8_t)cntr;
+   header.valid = IOCMD_TRUE;
+   *writer      = header;
+   *full_size   = pos;
+
+   return cntr;
+} /* IOCMD_compact_header_encode */
+
+/**
+ * Decodes compact header basing on header of the previous log read from the same buffer.
+ * Returns FALSE in header->valid if header cannot be decoded (previous log was lost and this one is not a keyframe).
+ */
+static void IOCMD_compact_header_decode(
+   const uint8_t *compact, uint_fast8_t size, const IOCMD_Compact_Header_XT *reader, IOCMD_Compact_Header_XT *header)
+{
+   uint64_t      value;
+#if (IOCMD_LOG_PRINT_TIME)
+   IOCMD_Time_DT time;
+#endif
+   uint_fast8_t  pos = 2U;
+   IOCMD_Bool_DT valid;
+
+   if(size > 2U)
+   {
+      if(0U != (compact[0] & IOCMD_LOG_COMPACT_KEYFRAME))
+      {
+         memset(header, 0, sizeof(IOCMD_Compact_Header_XT));
+         valid = IOCMD_TRUE;
+      }
+      else
+      {
+         *header = *reader;
+         valid = reader->valid;
+      }
+
+      header->level = compact[1];
+
+      if(IOCMD_BOOL_IS_TRUE(valid))
+      {
+         valid = IOCMD_compact_get_varint(compact, size, &pos, &value);
+         header->global_cntr += (IOCMD_global_cntr_DT)value;
+      }
+      if(IOCMD_BOOL_IS_TRUE(valid))
+      {
+         valid = IOCMD_compact_get_varint(compact, size, &pos, &value);
+         header->main_cntr += (IOCMD_global_cntr_DT)value;
+      }
+#if (IOCMD_LOG_PRINT_TIME)
+      if(IOCMD_BOOL_IS_TRUE(valid))
+      {
+         valid = IOCMD_compact_get_varint(compact, size, &pos, &value);
+         time = (IOCMD_Time_DT)value;
+         time = (IOCMD_Time_DT)(IOCMD_DIV_BY_POWER_OF_2(time, 1) ^ (IOCMD_Time_DT)(0U - (time & 1U)));
+         header->time += time;
+      }
+#endif
+      if(IOCMD_BOOL_IS_TRUE(valid) && IOCMD_LOG_HAS_STANDARD_HEADER(header->level & IOCMD_LOG_COMPACT_LEVEL_MASK))
+      {
+         if((pos + 2U) <= size)
          {
-            buf[result]   = base_type + 4U;
-            result       += 5U;
-            buf[result++] = data->u8_field.u8_4;
+            header->line[0] = compact[pos++];
+            header->line[1] = compact[pos++];
          }
-         else if((buf_size - result) >= 7U)
+         else
          {
-            buf[result]   = base_type + 5U;
-            result       += 5U;
-            buf[result++] = data->u8_field.u8_4;
-            buf[result++] = data->u8_field.u8_5;
+            valid = IOCMD_FALSE;
          }
-      }
-      else
-      {
-         if(0U == data->u8_field.u8_7)
+#if (IOCMD_LOG_PRINT_OS_CONTEXT)
+         if(IOCMD_BOOL_IS_TRUE(valid) && (0U != (compact[0] & IOCMD_LOG_COMPACT_CONTEXT)))
          {
-            if((buf_size - result) >= 8U)
+            if((pos + sizeof(header->context)) <= size)
             {
-               buf[result]   = base_type + 6U;
-               result       += 5U;
-               buf[result++] = data->u8_field.u8_4;
-               buf[result++] = data->u8_field.u8_5;
-               buf[result++] = data->u8_field.u8_6;
+               memcpy(header->context, &compact[pos], sizeof(header->context));
+               pos += sizeof(header->context);
+            }
+            else
+            {
+               valid = IOCMD_FALSE;
             }
          }
-         else if((buf_size - result) >= 9U)
+#endif
+         if(IOCMD_BOOL_IS_TRUE(valid) && (0U != (compact[0] & IOCMD_LOG_COMPACT_FILE)) && (pos < size))
          {
-            buf[result]   = base_type + 7U;
-            result       += 5U;
-            buf[result++] = data->u8_field.u8_4;
-            buf[result++] = data->u8_field.u8_5;
-            buf[result++] = data->u8_field.u8_6;
-            buf[result++] = data->u8_field.u8_7;
+            header->file_size = compact[pos] - IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B + 2U;
+            if((header->file_size <= sizeof(header->file)) && ((pos + header->file_size) <= size))
+            {
+               memcpy(header->file, &compact[pos], header->file_size);
+               pos += header->file_size;
+            }
+            else
+            {
+               valid = IOCMD_FALSE;
+            }
          }
       }
 
-      ptr[0] = data->u8_field.u8_0;
-      ptr[1] = data->u8_field.u8_1;
-      ptr[2] = data->u8_field.u8_2;
-      ptr[3] = data->u8_field.u8_3;
+      header->size  = (uint8_t)pos;
+      header->valid = valid;
    }
+   else
+   {
+      header->valid = IOCMD_FALSE;
+   }
+} /* IOCMD_compact_header_decode */
 
-   return result;
-} /* IOCMD_add_u64_to_buf */
-#endif
-
-#if(IOCMD_SUPPORT_DATA_COMPARISON || IOCMD_SUPPORT_DATA_LOGGING)
-static void IOCMD_reduce_int_in_buf(int data, uint8_t *buf, uint_fast16_t pos)
+/**
+ * Reads length of the log and decodes its compact header.
+ * Returns length of the log (0 if there is no log under given offset).
+ */
+static Buff_Size_DT IOCMD_peak_compact_log(
+   Buff_Ring_XT *buf, Buff_Size_DT offset, const IOCMD_Compact_Header_XT *reader, IOCMD_Compact_Header_XT *header, uint8_t *length_size)
 {
-   IOCMD_Buffer_Convert_UT convert;
-   uint8_t type = buf[pos++];
+   uint8_t      temp[2 + IOCMD_LOG_COMPACT_HEADER_MAX_SIZE];
+   Buff_Size_DT size;
+   Buff_Size_DT len = 0U;
+   uint_fast8_t pos = 1U;
 
-   convert.int_field.i = data;
+   header->valid = IOCMD_FALSE;
 
-   if(IOCMD_LOG_BUF_DATA_TYPE_1BYTE == type)
-   {
-      buf[pos] = convert.u8_field.u8_0;
-   }
-   else if(IOCMD_LOG_BUF_DATA_TYPE_2BYTE == type)
+   size = Buff_Ring_Peak(buf, temp, sizeof(temp), offset, BUFF_FALSE);
+
+   if(size >= 2U)
    {
-      buf[pos++] = convert.u8_field.u8_0;
-      buf[pos]   = convert.u8_field.u8_1;
+      len = ((Buff_Size_DT)(temp[0])) & 0x7FU;
+      if(0U != (temp[0] & 0x80U))
+      {
+         len = IOCMD_MUL_BY_POWER_OF_2(len, 8);
+         len += temp[1];
+         pos = 2U;
+      }
+
+      if(size > len)
+      {
+         size = len;
+      }
+
+      if(size > pos)
+      {
+         IOCMD_compact_header_decode(&temp[pos], (uint_fast8_t)(size - pos), reader, header);
+      }
    }
-   else if((IOCMD_LOG_BUF_DATA_TYPE_3BYTE == type) && (sizeof(int) > 2U))
+
+   *length_size = (uint8_t)pos;
+
+   return len;
+} /* IOCMD_peak_compact_log */
+
+/**
+ * Replaces compact header of the log read to working buffer by full one, as expected by IOCMD_proc_one_buffered_log.
+ * Returns new length of the log or 0 if full log doesn't fit into working buffer.
+ */
+static Buff_Size_DT IOCMD_compact_header_expand(
+   uint8_t *buf, Buff_Size_DT len, uint_fast8_t offset, uint_fast16_t buf_size, const IOCMD_Compact_Header_XT *header)
+{
+   Buff_Size_DT result = 0U;
+   uint_fast8_t level  = header->level & IOCMD_LOG_COMPACT_LEVEL_MASK;
+   uint_fast8_t size   = IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_HEADER_TIME_PART_SIZE + 1U;
+   uint_fast8_t pos    = offset;
+
+   if(IOCMD_LOG_HAS_STANDARD_HEADER(level))
    {
-      buf[pos++] = convert.u8_field.u8_0;
-      buf[pos++] = convert.u8_field.u8_1;
-      buf[pos]   = convert.u8_field.u8_2;
+      size += 2U + IOCMD_LOG_HEADER_CONTEXT_PART_SIZE + header->file_size;
    }
-   else if((IOCMD_LOG_BUF_DATA_TYPE_4BYTE == type) && (sizeof(int) > 2U))
+
+   if(IOCMD_BOOL_IS_TRUE(header->valid) && (len >= (offset + header->size)) && ((len - header->size + size) <= buf_size))
    {
-      buf[pos++] = convert.u8_field.u8_0;
-      buf[pos++] = convert.u8_field.u8_1;
-      buf[pos++] = convert.u8_field.u8_2;
-      buf[pos]   = convert.u8_field.u8_3;
+      memmove(&buf[offset + size], &buf[offset + header->size], len - offset - header->size);
+
+      memcpy(&buf[pos], &(header->global_cntr), sizeof(IOCMD_global_cntr_DT));
+      pos += sizeof(IOCMD_global_cntr_DT);
+      memcpy(&buf[pos], &(header->main_cntr), sizeof(IOCMD_global_cntr_DT));
+      pos += sizeof(IOCMD_global_cntr_DT);
+#if (IOCMD_LOG_PRINT_TIME)
+      memcpy(&buf[pos], &(header->time), sizeof(IOCMD_Time_DT));
+      pos += sizeof(IOCMD_Time_DT);
+#endif
+      /* targets of the log in single storage mode are not part of level */
+      buf[pos++] = (uint8_t)level;
+
+      if(IOCMD_LOG_HAS_STANDARD_HEADER(level))
+      {
+         buf[pos++] = header->line[0];
+         buf[pos++] = header->line[1];
+#if (IOCMD_LOG_PRINT_OS_CONTEXT)
+         memcpy(&buf[pos], header->context, sizeof(header->context));
+         pos += sizeof(header->context);
+#endif
+         memcpy(&buf[pos], header->file, header->file_size);
+      }
+
+      result = len - header->size + size;
    }
-} /* IOCMD_reduce_int_in_buf */
+
+   return result;
+} /* IOCMD_compact_header_expand */
 #endif
 
-static IOCMD_Bool_DT IOCMD_get_u64(IOCMD_Buffer_Convert_UT *data, uint_fast16_t *ppos, const uint8_t *buf, uint_fast16_t buf_size, uint8_t type_base)
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+static IOCMD_Log_Index_XT *IOCMD_get_log_index(const Buff_Ring_XT *buf)
 {
-   uint_fast16_t pos = *ppos;
-   uint_fast8_t  data_type;
-   IOCMD_Bool_DT result = IOCMD_FALSE;
+   IOCMD_Log_Index_XT *result;
 
-#if(((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) > 0xFFFFFFFF) || IOCMD_OUT_SUPPORT_U64)
-   data->u64_field.u64 = 0U;
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE))
+   result = (buf == &(IOCMD_Params.main_ring_buf)) ? &(IOCMD_Params.main_index) : &(IOCMD_Params.quiet_index);
+#elif((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE))
+   IOCMD_UNUSED_PARAM(buf);
+   result = &(IOCMD_Params.main_index);
 #else
-   data->u32_field.u32_0 = 0U;
+   IOCMD_UNUSED_PARAM(buf);
+   result = &(IOCMD_Params.quiet_index);
 #endif
 
-   if(buf_size > pos)
+   return result;
+} /* IOCMD_get_log_index */
+
+/**
+ * Called before log of size "length" is written to the buffer. Position of the log is kept when at least
+ * 1 / IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE of the buffer was written after previously kept position;
+ * "can_be_oldest" is IOCMD_FALSE for log which must not be the oldest one in the buffer - then next log is checked.
+ * Must be called with IOCMD_PROTECTION_LOCK taken.
+ */
+static void IOCMD_index_log(const Buff_Ring_XT *buf, Buff_Size_DT length, IOCMD_Bool_DT can_be_oldest)
+{
+   IOCMD_Log_Index_XT *index = IOCMD_get_log_index(buf);
+   Buff_Size_DT        oldest;
+
+   if((0U == index->to_next_mark) && IOCMD_BOOL_IS_TRUE(can_be_oldest))
    {
-      data_type = (uint_fast8_t)buf[pos] & 0xFFU;
+      oldest = index->written - BUFF_RING_GET_BUSY_SIZE(buf);
 
-      if((data_type >= type_base) && (data_type <= (type_base + 7U))
-         && ((buf_size - pos) > (data_type - type_base + 1U)))
+      /* positions of logs which are not in the buffer anymore */
+      while((index->num > 0U)
+         && ((Buff_Size_DT)(index->marks[index->first] - oldest) > BUFF_RING_GET_BUSY_SIZE(buf)))
       {
-         pos++;
+         index->first = (index->first + 1U) & (IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE - 1U);
+         index->num--;
+      }
 
-         data->u8_field.u8_0 = buf[pos++];
-         if(data_type > type_base)
-         {
-            data->u8_field.u8_1 = buf[pos++];
-            if(data_type > (type_base + 1U))
-            {
-               data->u8_field.u8_2 = buf[pos++];
-               if(data_type > (type_base + 2U))
-               {
-                  data->u8_field.u8_3 = buf[pos++];
-#if(((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) > 0xFFFFFFFF) || IOCMD_OUT_SUPPORT_U64)
-                  if(data_type > (type_base + 3U))
-                  {
-                     data->u8_field.u8_4 = buf[pos++];
-                     if(data_type > (type_base + 4U))
-                     {
-                        data->u8_field.u8_5 = buf[pos++];
-                        if(data_type > (type_base + 5U))
-                        {
-                           data->u8_field.u8_6 = buf[pos++];
-                           if(data_type > (type_base + 6U))
+      /* index full - the oldest position is the least useful one */
+      if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE == index->num)
+      {
+         index->first = (index->first + 1U) & (IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE - 1U);
+         index->num--;
+      }
+
+      index->marks[(index->first + index->num) & (IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE - 1U)] = index->written;
+      index->num++;
+      index->to_next_mark = buf->size / IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE;
+   }
+
+   index->to_next_mark = (index->to_next_mark > length) ? (index->to_next_mark - length) : 0U;
+   index->written += length;
+} /* IOCMD_index_log */
+#endif
+
+static void IOCMD_reduce_buf(Buff_Ring_XT *buf, Buff_Size_DT length)
+{
+#if(IOCMD_LOG_COMPACT_HEADER)
+   IOCMD_Compact_Headers_XT *compact;
+#endif
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+   IOCMD_Log_Index_XT *index;
+   Buff_Size_DT distance;
+#else
+#if(IOCMD_LOG_COMPACT_HEADER)
+   uint8_t size[3];
+   IOCMD_Bool_DT keyframe = IOCMD_FALSE;
+#else
+   uint8_t size[2];
+#endif
+   Buff_Size_DT len;
+#endif
+   Buff_Size_DT free_size;
+   Buff_Size_DT busy_size;
+   Buff_Size_DT removed = 0U;
+
+   free_size = BUFF_RING_GET_FREE_SIZE(buf);
+   busy_size = BUFF_RING_GET_BUSY_SIZE(buf);
+
+#if(IOCMD_LOG_REMOVE_LOGS_IN_BATCHES)
+   /**
+    * 1/8 of the buffer is released above requested size - otherwise, when requested size is bigger than 1/8 of the buffer,
+    * every following log would have to remove oldest log again
+    */
+   length += buf->size / 8U;
+#else
+   if(BUFF_LIKELY(length < (buf->size / 8U)))
+   {
+      length = buf->size / 8U;
+   }
+#endif
+
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+   /**
+    * logs are removed up to the first kept position which frees requested size, whole buffer if there is no such position;
+    * with IOCMD_LOG_COMPACT_HEADER only positions of keyframes are kept
+    */
+   index   = IOCMD_get_log_index(buf);
+   removed = busy_size;
+
+   while(index->num > 0U)
+   {
+      distance = (Buff_Size_DT)(index->marks[index->first] - (index->written - busy_size));
+
+      if((distance <= busy_size) && ((free_size + distance) >= length))
+      {
+         removed = distance;
+         break;
+      }
+
+      index->first = (index->first + 1U) & (IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE - 1U);
+      index->num--;
+   }
+#elif(IOCMD_LOG_COMPACT_HEADER)
+   /* only lengths of the oldest logs are read here; all of them are removed at once */
+   /* compact headers depend on previous logs - the oldest log left in the buffer must be a keyframe */
+   do
+   {
+      (void)Buff_Ring_Peak(buf, size, sizeof(size), removed, BUFF_FALSE);
+
+      len = ((Buff_Size_DT)(size[0])) & 0x7FU;
+      if(0U != (size[0] & 0x80U))
+      {
+         len = IOCMD_MUL_BY_POWER_OF_2(len, 8);
+         len += size[1];
+         keyframe = (0U != (size[2] & IOCMD_LOG_COMPACT_KEYFRAME)) ? IOCMD_TRUE : IOCMD_FALSE;
+      }
+      else
+      {
+         keyframe = (0U != (size[1] & IOCMD_LOG_COMPACT_KEYFRAME)) ? IOCMD_TRUE : IOCMD_FALSE;
+      }
+
+      if(((free_size + removed) < length) || IOCMD_BOOL_IS_FALSE(keyframe))
+      {
+         removed += len;
+         keyframe = IOCMD_FALSE;
+      }
+   }while(IOCMD_BOOL_IS_FALSE(keyframe) && (removed < busy_size));
+#else
+   /* only lengths of the oldest logs are read here; all of them are removed at once */
+   do
+   {
+      (void)Buff_Ring_Peak(buf, size, sizeof(size), removed, BUFF_FALSE);
+
+      len = ((Buff_Size_DT)(size[0])) & 0x7FU;
+      if(0U != (size[0] & 0x80U))
+      {
+         len = IOCMD_MUL_BY_POWER_OF_2(len, 8);
+         len += size[1];
+      }
+
+      removed += len;
+   }while(((free_size + removed) < length) && (removed < busy_size));
+#endif
+
+   (void)Buff_Ring_Remove(buf, removed, BUFF_FALSE);
+
+#if(IOCMD_LOG_COMPACT_HEADER)
+   compact = IOCMD_get_compact_headers(buf);
+   compact->reader.valid = IOCMD_FALSE;
+   if(removed >= busy_size)
+   {
+      /* buffer is empty - next log must be a keyframe */
+      compact->writer.valid = IOCMD_FALSE;
+   }
+#endif
+
+#if(IOCMD_LOG_SINGLE_STORAGE)
+   /* removed logs could be not processed as main logs yet - they are lost for both views */
+   if(IOCMD_Params.main_read_pos > removed)
+   {
+      IOCMD_Params.main_read_pos -= removed;
+   }
+   else
+   {
+      IOCMD_Params.main_read_pos = 0U;
+#if(IOCMD_LOG_COMPACT_HEADER)
+      IOCMD_Params.main_compact.reader.valid = IOCMD_FALSE;
+#endif
+   }
+#endif
+} /* IOCMD_reduce_buf */
+
+#if(IOCMD_LOG_SINGLE_STORAGE)
+static void IOCMD_set_log_targets(uint8_t *record, uint8_t targets)
+{
+   uint_fast8_t pos = 1U;
+
+   if(0U != (record[0] & 0x80U))
+   {
+      pos = 2U;
+   }
+
+   record[pos + IOCMD_LOG_LEVEL_POS] |= (uint8_t)IOCMD_MUL_BY_POWER_OF_2(targets, IOCMD_LOG_TARGETS_IN_LEVEL_SHIFT);
+} /* IOCMD_set_log_targets */
+
+#if(!IOCMD_LOG_COMPACT_HEADER)
+static Buff_Size_DT IOCMD_peak_log_targets(Buff_Size_DT offset, uint8_t *targets)
+{
+   uint8_t      temp[2 + IOCMD_LOG_LEVEL_POS + 1];
+   Buff_Size_DT len = 0U;
+   uint_fast8_t pos = 1U;
+
+   *targets = 0U;
+
+   if(sizeof(temp) == Buff_Ring_Peak(&(IOCMD_Params.quiet_ring_buf), temp, sizeof(temp), offset, BUFF_FALSE))
+   {
+      len = ((Buff_Size_DT)(temp[0])) & 0x7FU;
+      if(0U != (temp[0] & 0x80U))
+      {
+         len = IOCMD_MUL_BY_POWER_OF_2(len, 8);
+         len += temp[1];
+         pos = 2U;
+      }
+
+      *targets = (uint8_t)IOCMD_DIV_BY_POWER_OF_2(temp[pos + IOCMD_LOG_LEVEL_POS], IOCMD_LOG_TARGETS_IN_LEVEL_SHIFT);
+   }
+
+   return len;
+} /* IOCMD_peak_log_targets */
+#endif
+
+static void IOCMD_remove_processed_main_logs(void)
+{
+#if(IOCMD_LOG_COMPACT_HEADER)
+   IOCMD_Compact_Header_XT header;
+   uint8_t      offset;
+#endif
+   Buff_Size_DT len = 1U;
+   uint8_t      targets;
+
+   /* oldest logs which are already processed as main logs and are not quiet logs are not needed anymore */
+   while((IOCMD_Params.main_read_pos > 0U) && (len > 0U))
+   {
+#if(IOCMD_LOG_COMPACT_HEADER)
+      len = IOCMD_peak_compact_log(
+         &(IOCMD_Params.quiet_ring_buf), 0U, &(IOCMD_Params.quiet_compact.reader), &header, &offset);
+      targets = (uint8_t)IOCMD_DIV_BY_POWER_OF_2(header.level, IOCMD_LOG_TARGETS_IN_LEVEL_SHIFT);
+#else
+      len = IOCMD_peak_log_targets(0U, &targets);
+#endif
+
+      if(0U != (targets & IOCMD_LOG_TARGET_QUIET))
+      {
+         len = 0U;
+      }
+      else
+      {
+         (void)Buff_Ring_Remove(&(IOCMD_Params.quiet_ring_buf), len, BUFF_FALSE);
+         IOCMD_Params.main_read_pos -= len;
+#if(IOCMD_LOG_COMPACT_HEADER)
+         IOCMD_Params.quiet_compact.reader = header;
+#endif
+      }
+   }
+} /* IOCMD_remove_processed_main_logs */
+#endif
+
+/**
+ * Writes log (complete record, with length and full header in the first vector) to the buffer.
+ * If IOCMD_LOG_COMPACT_HEADER is enabled the header is replaced by compact one on the way.
+ * Must be called with IOCMD_PROTECTION_LOCK taken.
+ */
+static void IOCMD_write_log(Buff_Ring_XT *buf, const Buff_Readable_Vector_XT *vectors, uint_fast8_t num_vectors, Buff_Size_DT size)
+{
+#if(IOCMD_LOG_COMPACT_HEADER)
+   Buff_Readable_Vector_XT   compact_vectors[IOCMD_LOG_MAX_NUM_VECTORS + 1];
+   uint8_t                   header[2 + IOCMD_LOG_COMPACT_HEADER_MAX_SIZE];
+   const uint8_t            *log = (const uint8_t*)(vectors[0].data);
+   uint_fast8_t              header_size;
+   uint_fast8_t              full_size;
+   uint_fast8_t              pos = 1U;
+   uint_fast8_t              cntr;
+
+   if(0U != (log[0] & 0x80U))
+   {
+      pos = 2U;
+   }
+
+   /* keyframe can be a bit longer than full header */
+   if(BUFF_UNLIKELY(BUFF_RING_GET_FREE_SIZE(buf) < (size + IOCMD_LOG_COMPACT_HEADER_MAX_SIZE)))
+   {
+      IOCMD_reduce_buf(buf, size + IOCMD_LOG_COMPACT_HEADER_MAX_SIZE);
+   }
+
+   header_size = IOCMD_compact_header_encode(&header[2], &log[pos], &(IOCMD_get_compact_headers(buf)->writer), &full_size);
+
+   size = size - pos - full_size + header_size;
+
+   if(size < 127U)
+   {
+      size++;
+      header[1] = (uint8_t)size;
+      compact_vectors[0].data = &header[1];
+      compact_vectors[0].size = 1U + header_size;
+   }
+   else
+   {
+      size += 2U;
+      /* exception in library - length is big endian!!! */
+      header[1] = (uint8_t)size;
+      header[0] = (uint8_t)(IOCMD_DIV_BY_POWER_OF_2(size, 8) | 0x80U);
+      compact_vectors[0].data = header;
+      compact_vectors[0].size = 2U + header_size;
+   }
+
+   compact_vectors[1].data = &log[pos + full_size];
+   compact_vectors[1].size = vectors[0].size - pos - full_size;
+
+   for(cntr = 1U; cntr < num_vectors; cntr++)
+   {
+      compact_vectors[cntr + 1U] = vectors[cntr];
+   }
+
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+   IOCMD_index_log(buf, size, (0U != (header[2] & IOCMD_LOG_COMPACT_KEYFRAME)) ? IOCMD_TRUE : IOCMD_FALSE);
+#endif
+   (void)Buff_Ring_Write_From_Vector(buf, compact_vectors, num_vectors + 1U, size, 0U, BUFF_FALSE, BUFF_FALSE);
+#else
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+   IOCMD_index_log(buf, size, IOCMD_TRUE);
+#endif
+   (void)Buff_Ring_Write_From_Vector(buf, vectors, num_vectors, size, 0U, BUFF_FALSE, BUFF_FALSE);
+#endif
+} /* IOCMD_write_log */
+
+#if(IOCMD_LOG_LOCK_FREE_STAGING || IOCMD_LOG_COMPRESS_OUTSIDE_LOCK)
+/**
+ * Adds global counters to log already compressed outside of the lock and stores it in main / quiet buffer.
+ * Must be called with IOCMD_PROTECTION_LOCK taken.
+ */
+static void IOCMD_store_log(uint8_t *record, uint_fast16_t length, uint8_t targets)
+{
+   Buff_Readable_Vector_XT vector;
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE))
+   Buff_Size_DT            reserved_size;
+#endif
+   uint_fast16_t           pos = 1U;
+
+   if(0U != (record[0] & 0x80U))
+   {
+      pos = 2U;
+   }
+
+   /* global cntr */
+   record[pos++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.global_cntr)) )[0];
+#if(IOCMD_LOG_GLOBAL_CNTR_SIZE > 1)
+   record[pos++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.global_cntr)) )[1];
+#endif
+#if(IOCMD_LOG_GLOBAL_CNTR_SIZE > 2)
+   record[pos++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.global_cntr)) )[2];
+   record[pos++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.global_cntr)) )[3];
+#endif
+   IOCMD_Params.global_cntr.global_cntr++;
+
+   /* main cntr */
+   record[pos++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.main_cntr)) )[0];
+#if(IOCMD_LOG_GLOBAL_CNTR_SIZE > 1)
+   record[pos++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.main_cntr)) )[1];
+#endif
+#if(IOCMD_LOG_GLOBAL_CNTR_SIZE > 2)
+   record[pos++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.main_cntr)) )[2];
+   record[pos++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.main_cntr)) )[3];
+#endif
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+   if(0U != (targets & IOCMD_LOG_TARGET_MAIN))
+#endif
+   {
+      IOCMD_Params.global_cntr.main_cntr++;
+   }
+
+   vector.data = record;
+   vector.size = (Buff_Size_DT)length;
+
+#if(IOCMD_LOG_SINGLE_STORAGE)
+   IOCMD_set_log_targets(record, targets);
+
+   if(BUFF_UNLIKELY(BUFF_RING_GET_FREE_SIZE(&(IOCMD_Params.quiet_ring_buf)) < (2U * (IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH))))
+   {
+      IOCMD_reduce_buf(&(IOCMD_Params.quiet_ring_buf), (Buff_Size_DT)(2U * (IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH)));
+   }
+
+   IOCMD_write_log(&(IOCMD_Params.quiet_ring_buf), &vector, 1U, vector.size);
+#else
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+   if(0U != (targets & IOCMD_LOG_TARGET_MAIN))
+   {
+      /**
+       * same free space margins as used by IOCMD_Log when log is compressed directly in the buffer - for log stored
+       * in both buffers main buffer is the second one and only has to fit the log
+       */
+      reserved_size = (Buff_Size_DT)(2U * (IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH));
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+      if(0U != (targets & IOCMD_LOG_TARGET_QUIET))
+      {
+         reserved_size = vector.size;
+      }
+#endif
+
+      if(BUFF_UNLIKELY(BUFF_RING_GET_FREE_SIZE(&(IOCMD_Params.main_ring_buf)) < reserved_size))
+      {
+         IOCMD_reduce_buf(&(IOCMD_Params.main_ring_buf), reserved_size);
+      }
+
+      IOCMD_write_log(&(IOCMD_Params.main_ring_buf), &vector, 1U, vector.size);
+   }
+#endif
+
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+   if(0U != (targets & IOCMD_LOG_TARGET_QUIET))
+   {
+      if(BUFF_UNLIKELY(BUFF_RING_GET_FREE_SIZE(&(IOCMD_Params.quiet_ring_buf)) < (2U * (IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH))))
+      {
+         IOCMD_reduce_buf(&(IOCMD_Params.quiet_ring_buf), (Buff_Size_DT)(2U * (IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH)));
+      }
+
+      IOCMD_write_log(&(IOCMD_Params.quiet_ring_buf), &vector, 1U, vector.size);
+   }
+#endif
+#endif
+} /* IOCMD_store_log */
+#endif
+
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+static void IOCMD_staging_ring_init(IOCMD_Staging_Ring_XT *ring, IOCMD_Staging_Slot_XT *slots, size_t num_slots)
+{
+   size_t cntr;
+
+   for(cntr = 0U; cntr < num_slots; cntr++)
+   {
+      atomic_init(&(slots[cntr].sequence), cntr);
+   }
+
+   ring->slots      = slots;
+   ring->slots_mask = num_slots - 1U;
+
+   atomic_init(&(ring->head), 0U);
+   atomic_init(&(ring->tail), 0U);
+   atomic_flag_clear(&(ring->transferring));
+} /* IOCMD_staging_ring_init */
+
+static void IOCMD_staging_init(void)
+{
+#if(IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0)
+   size_t cntr;
+#endif
+
+   IOCMD_staging_ring_init(&(IOCMD_Params.staging), IOCMD_Params.staging_slots, IOCMD_LOG_STAGING_NUM_SLOTS);
+
+#if(IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0)
+   for(cntr = 0U; cntr < IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS; cntr++)
+   {
+      IOCMD_staging_ring_init(
+         &(IOCMD_Params.context_staging[cntr]), IOCMD_Params.context_staging_slots[cntr], IOCMD_LOG_CONTEXT_STAGING_NUM_SLOTS);
+   }
+#endif
+
+   atomic_init(&(IOCMD_Params.staging_order), 0U);
+} /* IOCMD_staging_init */
+
+/**
+ * Returns oldest log of the ring if it is already published, invalid pointer otherwise.
+ */
+static IOCMD_Staging_Slot_XT *IOCMD_staging_get_published(IOCMD_Staging_Ring_XT *ring)
+{
+   IOCMD_Staging_Slot_XT *slot;
+   size_t                 tail;
+
+   tail = atomic_load_explicit(&(ring->tail), memory_order_relaxed);
+   slot = &(ring->slots[tail & ring->slots_mask]);
+
+   if((tail + 1U) != atomic_load_explicit(&(slot->sequence), memory_order_acquire))
+   {
+      slot = IOCMD_MAKE_INVALID_PTR(IOCMD_Staging_Slot_XT);
+   }
+
+   return slot;
+} /* IOCMD_staging_get_published */
+
+/**
+ * Returns IOCMD_TRUE if any log published to common ring waits there (also behind the log which is still being filled
+ * by other writer); "order" is set to the lowest publishing order of such logs.
+ */
+static IOCMD_Bool_DT IOCMD_staging_get_blocked(size_t *order)
+{
+   IOCMD_Staging_Slot_XT *slot;
+   size_t                 pos;
+   size_t                 head;
+   IOCMD_Bool_DT          result = IOCMD_FALSE;
+
+   head = atomic_load_explicit(&(IOCMD_Params.staging.head), memory_order_relaxed);
+
+   for(pos = atomic_load_explicit(&(IOCMD_Params.staging.tail), memory_order_relaxed); pos != head; pos++)
+   {
+      slot = &(IOCMD_Params.staging.slots[pos & IOCMD_Params.staging.slots_mask]);
+
+      if((pos + 1U) == atomic_load_explicit(&(slot->sequence), memory_order_acquire))
+      {
+         if(IOCMD_BOOL_IS_FALSE(result) || ((ptrdiff_t)(slot->order - *order) < 0))
+         {
+            *order = slot->order;
+         }
+         result = IOCMD_TRUE;
+      }
+   }
+
+   return result;
+} /* IOCMD_staging_get_blocked */
+
+/**
+ * Moves published logs from staging rings to main / quiet buffer. Every ring is emptied in order of reservation and logs of different
+ * rings are merged by their publishing order. Ring is not processed further than its first slot which is still being filled by its writer;
+ * logs of other rings published after log which waits behind such slot are not moved either.
+ * Must be called with IOCMD_PROTECTION_LOCK taken.
+ */
+static void IOCMD_staging_transfer(void)
+{
+   IOCMD_Staging_Ring_XT *oldest_ring;
+   IOCMD_Staging_Slot_XT *oldest;
+#if(IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0)
+   IOCMD_Staging_Slot_XT *previous;
+   IOCMD_Staging_Slot_XT *slot;
+   size_t                 cntr;
+   size_t                 blocked_order;
+   IOCMD_Bool_DT          blocked;
+#endif
+   size_t                 tail;
+
+   do
+   {
+#if(IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0)
+      oldest = IOCMD_MAKE_INVALID_PTR(IOCMD_Staging_Slot_XT);
+
+      /**
+       * log published in a ring which was already checked could be written by thread which saw a log chosen from next ring;
+       * it is visible after the chosen log is read, so rings are checked again until the same log is chosen
+       */
+      do
+      {
+         previous    = oldest;
+         oldest_ring = &(IOCMD_Params.staging);
+         oldest      = IOCMD_staging_get_published(oldest_ring);
+         /**
+          * logs of common ring leave it in order of reservation, so log of context ring is moved before them
+          * only if it was published before all of them - also before these ones which are not first in common ring
+          */
+         blocked     = IOCMD_staging_get_blocked(&blocked_order);
+
+         for(cntr = 0U; cntr < IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS; cntr++)
+         {
+            slot = IOCMD_staging_get_published(&(IOCMD_Params.context_staging[cntr]));
+
+            if(IOCMD_CHECK_PTR(IOCMD_Staging_Slot_XT, slot)
+               && (IOCMD_BOOL_IS_FALSE(blocked) || ((ptrdiff_t)(slot->order - blocked_order) < 0)))
+            {
+               if((oldest_ring == &(IOCMD_Params.staging)) || ((ptrdiff_t)(slot->order - oldest->order) < 0))
+               {
+                  oldest_ring = &(IOCMD_Params.context_staging[cntr]);
+                  oldest      = slot;
+               }
+            }
+         }
+      }while(previous != oldest);
+#else
+      oldest_ring = &(IOCMD_Params.staging);
+      oldest      = IOCMD_staging_get_published(oldest_ring);
+#endif
+
+      if(IOCMD_CHECK_PTR(IOCMD_Staging_Slot_XT, oldest))
+      {
+         IOCMD_store_log(oldest->record, oldest->length, oldest->targets);
+
+         /* give slot back to writers for next round */
+         tail = atomic_load_explicit(&(oldest_ring->tail), memory_order_relaxed);
+         atomic_store_explicit(&(oldest->sequence), tail + oldest_ring->slots_mask + 1U, memory_order_release);
+         atomic_store_explicit(&(oldest_ring->tail), tail + 1U, memory_order_relaxed);
+      }
+   }while(IOCMD_CHECK_PTR(IOCMD_Staging_Slot_XT, oldest));
+} /* IOCMD_staging_transfer */
+
+/**
+ * Called under the lock by logging functions which store their log directly in log buffers. All published logs must be
+ * moved before - also these ones which wait behind log being filled by other writer; then the lock is released for a moment
+ * until that log is published. Thanks to that logs of one thread are never reordered and log stored after other thread's
+ * log was published is never placed before it.
+ */
+static void IOCMD_staging_transfer_all(void)
+{
+   size_t order;
+
+   IOCMD_staging_transfer();
+
+   while(IOCMD_BOOL_IS_TRUE(IOCMD_staging_get_blocked(&order)))
+   {
+      IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
+      IOCMD_PROTECTION_LOCK(IOCMD_Params);
+      IOCMD_staging_transfer();
+   }
+} /* IOCMD_staging_transfer_all */
+
+/**
+ * Reserves free slot in staging ring. Returns invalid pointer when all slots are busy and none of them can be freed
+ * because the oldest one is still being filled (its writer was preempted) - then the log must be stored directly.
+ * It is done only if all previous logs of current thread are already in log buffers, so logs of one thread are never reordered;
+ * otherwise writer waits for the oldest slot.
+ */
+static IOCMD_Staging_Slot_XT *IOCMD_staging_reserve(IOCMD_Staging_Ring_XT *ring, size_t *reserved_pos)
+{
+   IOCMD_Staging_Slot_XT *slot;
+   IOCMD_Staging_Slot_XT *result = IOCMD_MAKE_INVALID_PTR(IOCMD_Staging_Slot_XT);
+   size_t                 pos;
+   size_t                 published;
+   ptrdiff_t              dif;
+   IOCMD_Bool_DT          full = IOCMD_FALSE;
+
+   pos = atomic_load_explicit(&(ring->head), memory_order_relaxed);
+
+   do
+   {
+      slot = &(ring->slots[pos & ring->slots_mask]);
+      dif  = (ptrdiff_t)(atomic_load_explicit(&(slot->sequence), memory_order_acquire) - pos);
+
+      if(0 == dif)
+      {
+         /* on failure pos is updated to current head */
+         if(atomic_compare_exchange_weak_explicit(
+            &(ring->head), &pos, pos + 1U, memory_order_relaxed, memory_order_relaxed))
+         {
+            result = slot;
+         }
+      }
+      else if(dif < 0)
+      {
+         /* all slots are busy - move published logs to log buffers to free some of them */
+         IOCMD_PROTECTION_LOCK(IOCMD_Params);
+         IOCMD_staging_transfer();
+         IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
+
+         /* position (+1) of the newest log of current thread in this ring */
+         published = IOCMD_staging_published;
+#if(IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0)
+         if(&(IOCMD_Params.staging) != ring)
+         {
+            /* context ring has single writer - all its logs were published by current thread or by previous owner of the ring */
+            published = atomic_load_explicit(&(ring->head), memory_order_relaxed);
+         }
+#endif
+
+         if(((ptrdiff_t)(atomic_load_explicit(&(slot->sequence), memory_order_acquire) - pos) < 0)
+            && ((ptrdiff_t)(atomic_load_explicit(&(ring->tail), memory_order_relaxed) - published) >= 0))
+         {
+            full = IOCMD_TRUE;
+         }
+         else
+         {
+            pos = atomic_load_explicit(&(ring->head), memory_order_relaxed);
+         }
+      }
+      else
+      {
+         /* slot was taken by other writer */
+         pos = atomic_load_explicit(&(ring->head), memory_order_relaxed);
+      }
+   }while((!IOCMD_CHECK_PTR(IOCMD_Staging_Slot_XT, result)) && IOCMD_BOOL_IS_FALSE(full));
+
+   *reserved_pos = pos;
+
+   return result;
+} /* IOCMD_staging_reserve */
+
+/**
+ * Called by writer of common ring which published log number IOCMD_LOG_STAGING_TRANSFER_THRESHOLD (or more) waiting in the ring.
+ * If other writer is moving logs at the moment then nothing is done - logs published meanwhile are taken by next batch
+ * or by IOCMD_Proc_Buffered_Logs, so writers never queue on the lock.
+ */
+static void IOCMD_staging_try_transfer(void)
+{
+   if(!atomic_flag_test_and_set_explicit(&(IOCMD_Params.staging.transferring), memory_order_acquire))
+   {
+      IOCMD_PROTECTION_LOCK(IOCMD_Params);
+      IOCMD_staging_transfer();
+      IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
+
+      atomic_flag_clear_explicit(&(IOCMD_Params.staging.transferring), memory_order_release);
+   }
+} /* IOCMD_staging_try_transfer */
+
+/**
+ * Returns staging ring of current thread. Threads which log first time take free context rings (single writer each,
+ * so their logs are not moved to log buffers on every log) until all of them are owned, other threads share one common ring.
+ */
+static IOCMD_Staging_Ring_XT *IOCMD_staging_get_ring(void)
+{
+#if(IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0)
+   size_t cntr;
+
+   if(IOCMD_UNLIKELY(!IOCMD_CHECK_PTR(IOCMD_Staging_Ring_XT, IOCMD_context_staging_ring)))
+   {
+      IOCMD_context_staging_ring = &(IOCMD_Params.staging);
+
+      for(cntr = 0U; cntr < IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS; cntr++)
+      {
+         /* acquire - slots written by previous owner of the ring are visible */
+         if(!atomic_exchange_explicit(&(IOCMD_Params.context_staging_taken[cntr]), true, memory_order_acquire))
+         {
+            IOCMD_context_staging_ring = &(IOCMD_Params.context_staging[cntr]);
+            break;
+         }
+      }
+   }
+
+   return IOCMD_context_staging_ring;
+#else
+   return &(IOCMD_Params.staging);
+#endif
+} /* IOCMD_staging_get_ring */
+#endif
+
+static uint_fast16_t IOCMD_add_u32_to_buf(IOCMD_Buffer_Convert_UT *data, uint8_t *buf, uint_fast16_t buf_size, uint_fast16_t result, uint8_t base_type)
+{
+   if(0U == data->u16_field.u16_1)
+   {
+      if(0U == data->u8_field.u8_1)
+      {
+         if(buf_size >= 2U)
+         {
+            buf[result++] = base_type;
+            buf[result++] = data->u8_field.u8_0;
+         }
+      }
+      else if(buf_size >= 3U)
+      {
+         buf[result++] = base_type + 1U;
+         buf[result++] = data->u8_field.u8_0;
+         buf[result++] = data->u8_field.u8_1;
+      }
+   }
+   else
+   {
+      if(0U == data->u8_field.u8_3)
+      {
+         if(buf_size >= 4U)
+         {
+            buf[result++] = base_type + 2U;
+            buf[result++] = data->u8_field.u8_0;
+            buf[result++] = data->u8_field.u8_1;
+            buf[result++] = data->u8_field.u8_2;
+         }
+      }
+      else if(buf_size >= 5U)
+      {
+         buf[result++] = base_type + 3U;
+         buf[result++] = data->u8_field.u8_0;
+         buf[result++] = data->u8_field.u8_1;
+         buf[result++] = data->u8_field.u8_2;
+         buf[result++] = data->u8_field.u8_3;
+      }
+   }
+
+   return result;
+} /* IOCMD_add_u32_to_buf */
+
+#if (((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) > 0xFFFFFFFF) || IOCMD_OUT_SUPPORT_U64)
+static uint_fast16_t IOCMD_add_u64_to_buf(IOCMD_Buffer_Convert_UT *data, uint8_t *buf, uint_fast16_t buf_size, uint_fast16_t result, uint8_t base_type)
+{
+   uint8_t *ptr;
+
+   if(0U == data->u32_field.u32_1)
+   {
+      result = IOCMD_add_u32_to_buf(data, buf, buf_size, result, base_type);
+   }
+   else if((buf_size - result) >= 6U)
+   {
+      ptr = &buf[result + 1];
+
+      if(0U == data->u16_field.u16_3)
+      {
+         if(0U == data->u8_field.u8_5)
+         {
+            buf[result]   = base_type + 4U;
+            result       += 5U;
+            buf[result++] = data->u8_field.u8_4;
+         }
+         else if((buf_size - result) >= 7U)
+         {
+            buf[result]   = base_type + 5U;
+            result       += 5U;
+            buf[result++] = data->u8_field.u8_4;
+            buf[result++] = data->u8_field.u8_5;
+         }
+      }
+      else
+      {
+         if(0U == data->u8_field.u8_7)
+         {
+            if((buf_size - result) >= 8U)
+            {
+               buf[result]   = base_type + 6U;
+               result       += 5U;
+               buf[result++] = data->u8_field.u8_4;
+               buf[result++] = data->u8_field.u8_5;
+               buf[result++] = data->u8_field.u8_6;
+            }
+         }
+         else if((buf_size - result) >= 9U)
+         {
+            buf[result]   = base_type + 7U;
+            result       += 5U;
+            buf[result++] = data->u8_field.u8_4;
+            buf[result++] = data->u8_field.u8_5;
+            buf[result++] = data->u8_field.u8_6;
+            buf[result++] = data->u8_field.u8_7;
+         }
+      }
+
+      ptr[0] = data->u8_field.u8_0;
+      ptr[1] = data->u8_field.u8_1;
+      ptr[2] = data->u8_field.u8_2;
+      ptr[3] = data->u8_field.u8_3;
+   }
+
+   return result;
+} /* IOCMD_add_u64_to_buf */
+#endif
+
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+static uint_fast16_t IOCMD_add_varint_to_buf(
+   IOCMD_Buffer_Convert_UT *data, uint8_t *buf, uint_fast16_t buf_size, uint_fast16_t result, uint_fast8_t length, IOCMD_Bool_DT is_signed)
+{
+   uint8_t         encoded[IOCMD_LOG_VARINT_MAX_SIZE];
+   IOCMD_Varint_DT value;
+   IOCMD_Varint_DT sign;
+   uint_fast8_t    size = 0U;
+
+#if(((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) > 0xFFFFFFFF) || IOCMD_OUT_SUPPORT_U64)
+   value = (length > 4U) ? data->u64_field.u64 : data->u32_field.u32_0;
+#else
+   value = data->u32_field.u32_0;
+#endif
+
+   if(0U == length)
+   {
+      /* no significant byte - shift below would be out of range */
+      value = 0U;
+   }
+   else if(length < sizeof(IOCMD_Varint_DT))
+   {
+      /* only "length" bytes are printed - skip the rest and extend sign of signed parameters to full varint width */
+      sign   = ((IOCMD_Varint_DT)1U) << ((length * 8U) - 1U);
+      value &= (sign << 1) - 1U;
+      if(IOCMD_BOOL_IS_TRUE(is_signed))
+      {
+         value = (value ^ sign) - sign;
+      }
+   }
+
+   if(IOCMD_BOOL_IS_TRUE(is_signed))
+   {
+      /* zig-zag: small negative numbers take as few bytes as small positive ones */
+      sign  = (IOCMD_Varint_DT)0U - (value >> ((sizeof(IOCMD_Varint_DT) * 8U) - 1U));
+      value = (value << 1) ^ sign;
+   }
+
+   do
+   {
+      encoded[size++] = (uint8_t)(value & 0x7FU) | 0x80U;
+      value >>= 7;
+   }while(0U != value);
+
+   encoded[size - 1U] &= 0x7FU;
+
+   if(buf_size >= size)
+   {
+      memcpy(&buf[result], encoded, size);
+      result += size;
+   }
+
+   return result;
+} /* IOCMD_add_varint_to_buf */
+#endif
+
+#if(IOCMD_SUPPORT_DATA_COMPARISON || IOCMD_SUPPORT_DATA_LOGGING)
+static void IOCMD_reduce_int_in_buf(int data, uint8_t *buf, uint_fast16_t pos)
+{
+   IOCMD_Buffer_Convert_UT convert;
+   uint8_t type = buf[pos++];
+
+   convert.int_field.i = data;
+
+   if(IOCMD_LOG_BUF_DATA_TYPE_1BYTE == type)
+   {
+      buf[pos] = convert.u8_field.u8_0;
+   }
+   else if(IOCMD_LOG_BUF_DATA_TYPE_2BYTE == type)
+   {
+      buf[pos++] = convert.u8_field.u8_0;
+      buf[pos]   = convert.u8_field.u8_1;
+   }
+   else if((IOCMD_LOG_BUF_DATA_TYPE_3BYTE == type) && (sizeof(int) > 2U))
+   {
+      buf[pos++] = convert.u8_field.u8_0;
+      buf[pos++] = convert.u8_field.u8_1;
+      buf[pos]   = convert.u8_field.u8_2;
+   }
+   else if((IOCMD_LOG_BUF_DATA_TYPE_4BYTE == type) && (sizeof(int) > 2U))
+   {
+      buf[pos++] = convert.u8_field.u8_0;
+      buf[pos++] = convert.u8_field.u8_1;
+      buf[pos++] = convert.u8_field.u8_2;
+      buf[pos]   = convert.u8_field.u8_3;
+   }
+} /* IOCMD_reduce_int_in_buf */
+#endif
+
+static IOCMD_Bool_DT IOCMD_get_u64(IOCMD_Buffer_Convert_UT *data, uint_fast16_t *ppos, const uint8_t *buf, uint_fast16_t buf_size, uint8_t type_base)
+{
+   uint_fast16_t pos = *ppos;
+   uint_fast8_t  data_type;
+   IOCMD_Bool_DT result = IOCMD_FALSE;
+
+#if(((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) > 0xFFFFFFFF) || IOCMD_OUT_SUPPORT_U64)
+   data->u64_field.u64 = 0U;
+#else
+   data->u32_field.u32_0 = 0U;
+#endif
+
+   if(buf_size > pos)
+   {
+      data_type = (uint_fast8_t)buf[pos] & IOCMD_LOG_BUF_DATA_TYPE_MASK;
+
+      if((data_type >= type_base) && (data_type <= (type_base + 7U))
+         && ((buf_size - pos) > (data_type - type_base + 1U)))
+      {
+         pos++;
+
+         data->u8_field.u8_0 = buf[pos++];
+         if(data_type > type_base)
+         {
+            data->u8_field.u8_1 = buf[pos++];
+            if(data_type > (type_base + 1U))
+            {
+               data->u8_field.u8_2 = buf[pos++];
+               if(data_type > (type_base + 2U))
+               {
+                  data->u8_field.u8_3 = buf[pos++];
+#if(((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) > 0xFFFFFFFF) || IOCMD_OUT_SUPPORT_U64)
+                  if(data_type > (type_base + 3U))
+                  {
+                     data->u8_field.u8_4 = buf[pos++];
+                     if(data_type > (type_base + 4U))
+                     {
+                        data->u8_field.u8_5 = buf[pos++];
+                        if(data_type > (type_base + 5U))
+                        {
+                           data->u8_field.u8_6 = buf[pos++];
+                           if(data_type > (type_base + 6U))
                            {
                               data->u8_field.u8_7 = buf[pos++];
                            }
@@ -556,235 +2399,1143 @@ static IOCMD_Bool_DT IOCMD_get_u64(IOCMD_Buffer_Convert_UT *data, uint_fast16_t
             }
          }
 
-         result = IOCMD_TRUE;
-      }
+         result = IOCMD_TRUE;
+      }
+
+      *ppos = pos;
+   }
+   return result;
+} /* IOCMD_get_u64 */
+
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+static IOCMD_Bool_DT IOCMD_get_varint(
+   IOCMD_Buffer_Convert_UT *data, uint_fast16_t *ppos, const uint8_t *buf, uint_fast16_t buf_size, IOCMD_Bool_DT is_signed)
+{
+   IOCMD_Varint_DT value = 0U;
+   uint_fast16_t   pos   = *ppos;
+   uint_fast8_t    shift = 0U;
+   uint8_t         part  = 0x80U;
+   IOCMD_Bool_DT   result = IOCMD_FALSE;
+
+   while((0U != (part & 0x80U)) && (pos < buf_size) && (shift < (sizeof(IOCMD_Varint_DT) * 8U)))
+   {
+      part   = buf[pos++];
+      value |= ((IOCMD_Varint_DT)(part & 0x7FU)) << shift;
+      shift += 7U;
+   }
+
+   if(0U == (part & 0x80U))
+   {
+      if(IOCMD_BOOL_IS_TRUE(is_signed))
+      {
+         value = (value >> 1) ^ ((IOCMD_Varint_DT)0U - (value & 1U));
+      }
+
+#if(((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) > 0xFFFFFFFF) || IOCMD_OUT_SUPPORT_U64)
+      data->u64_field.u64 = value;
+#else
+      data->u32_field.u32_0 = value;
+#endif
+
+      result = IOCMD_TRUE;
+   }
+
+   *ppos = pos;
+
+   return result;
+} /* IOCMD_get_varint */
+#endif
+
+static IOCMD_Bool_DT IOCMD_get_int_param(
+   IOCMD_Buffer_Convert_UT *data,
+   uint_fast16_t *ppos,
+   const uint8_t *buf,
+   uint_fast16_t buf_size,
+   const IOCMD_standard_header_and_main_string_XT *header,
+   IOCMD_Bool_DT is_signed)
+{
+   IOCMD_Bool_DT result;
+
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+   if(IOCMD_BOOL_IS_TRUE(header->varint_args))
+   {
+      result = IOCMD_get_varint(data, ppos, buf, buf_size, is_signed);
+   }
+   else
+#else
+   IOCMD_UNUSED_PARAM(header);
+   IOCMD_UNUSED_PARAM(is_signed);
+#endif
+   {
+      result = IOCMD_get_u64(data, ppos, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+   }
+
+   return result;
+} /* IOCMD_get_int_param */
+
+static uint_fast8_t IOCMD_get_char(IOCMD_Buffer_Convert_UT *data, const uint8_t *buf, uint_fast16_t *ppos)
+{
+   uint_fast16_t pos = *ppos;
+   uint_fast8_t data_type;
+   uint_fast8_t cntr = 0xFFU;
+
+#if(IOCMD_OUT_SUPPORT_U64)
+      data->u64_field.u64 = 0U;
+#else
+      data->u32_field.u32_0 = 0U;
+#endif
+
+   data_type = (uint_fast8_t)buf[pos] & 0xFFU;
+
+   if(IOCMD_LOG_BUF_DATA_TYPE_CHAR == data_type)
+   {
+      pos++;
+      data->char_field.c = (char)(buf[pos++]);
+      cntr = 1U;
+   }
+
+   *ppos = pos;
+
+   return cntr;
+} /* IOCMD_get_char */
+
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+static IOCMD_Bool_DT IOCMD_get_double(IOCMD_Buffer_Convert_UT *data, uint_fast16_t *ppos, const uint8_t *buf, uint_fast16_t buf_size)
+{
+   uint_fast16_t pos = *ppos;
+   IOCMD_Bool_DT result = IOCMD_FALSE;
+
+   if((buf_size > pos) && ((buf_size - pos) > sizeof(double)) && (IOCMD_LOG_BUF_DATA_TYPE_DOUBLE == buf[pos]))
+   {
+      pos++;
+      memcpy(&(data->double_field.d), &buf[pos], sizeof(double));
+      pos += sizeof(double);
+
+      result = IOCMD_TRUE;
+   }
+
+   *ppos = pos;
+
+   return result;
+} /* IOCMD_get_double */
+#endif
+
+static const char *IOCMD_get_string_ptr(IOCMD_Buffer_Convert_UT *convert, uint_fast16_t *ppos, const uint8_t *buf, uint_fast16_t buf_size)
+{
+   const char *result = IOCMD_MAKE_INVALID_PTR(const char);
+   uint_fast16_t pos = *ppos;
+
+   if(IOCMD_BOOL_IS_TRUE(IOCMD_get_u64(convert, ppos, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B)))
+   {
+      result = &(convert->ptr_field.ptr.string[IOCMD_PROGRAM_MEMORY_BEGIN]);
+   }
+   else if(IOCMD_LOG_BUF_DATA_TYPE_STRING == (buf[pos] & IOCMD_LOG_BUF_DATA_TYPE_MASK))
+   {
+      pos++;
+
+      result = (const char*)(&buf[pos]);
+      while(pos < buf_size)
+      {
+         if('\0' == buf[pos])
+         {
+            pos++;
+            break;
+         }
+         pos++;
+      }
+
+      *ppos = pos;
+   }
+
+   return result;
+} /* IOCMD_get_string_ptr */
+
+#if(IOCMD_SUPPORT_DATA_COMPARISON || IOCMD_SUPPORT_DATA_LOGGING)
+static const uint8_t *IOCMD_get_tab_ptr(
+   IOCMD_Buffer_Convert_UT *convert, uint_fast16_t *ppos, const uint8_t *buf, uint_fast16_t buf_size, uint_fast16_t tab_size)
+{
+   const uint8_t *result = IOCMD_MAKE_INVALID_PTR(const uint8_t);
+   uint_fast16_t pos = *ppos;
+
+   if(IOCMD_BOOL_IS_TRUE(IOCMD_get_u64(convert, ppos, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_PTAB_1B)))
+   {
+      result = &(convert->ptr_field.ptr.cu8[IOCMD_PROGRAM_MEMORY_BEGIN]);
+   }
+   else if(IOCMD_LOG_BUF_DATA_TYPE_TAB == buf[pos])
+   {
+      pos++;
+
+      result = (const uint8_t*)(&buf[pos]);
+
+      pos   += tab_size;
+
+      *ppos  = pos;
+   }
+
+   return result;
+} /* IOCMD_get_tab_ptr */
+#endif
+
+#if(IOCMD_LOG_DATA_COMPRESSION)
+/**
+ * Reads length of literals / match: 4 bits from token, extended by following bytes while they are equal to 255.
+ */
+static IOCMD_Bool_DT IOCMD_unpack_length(
+   uint_fast16_t *length, const uint8_t *packed, uint_fast16_t *ppos, uint_fast16_t packed_size)
+{
+   uint_fast16_t pos = *ppos;
+   uint8_t ext;
+   IOCMD_Bool_DT result = IOCMD_TRUE;
+
+   if(15U == *length)
+   {
+      do
+      {
+         if(pos >= packed_size)
+         {
+            result = IOCMD_FALSE;
+            break;
+         }
+         ext = packed[pos++];
+         *length += ext;
+      } while(255U == ext);
+   }
+
+   *ppos = pos;
+
+   return result;
+} /* IOCMD_unpack_length */
+
+/**
+ * Decompresses data compressed by IOCMD_pack_data. Returns IOCMD_FALSE if data is broken or its size is different than data_size.
+ */
+static IOCMD_Bool_DT IOCMD_unpack_data(
+   const uint8_t *packed, uint_fast16_t packed_size, uint8_t *data, uint_fast16_t data_size)
+{
+   uint_fast16_t in  = 0U;
+   uint_fast16_t out = 0U;
+   uint_fast16_t length;
+   uint_fast16_t match_length;
+   uint_fast16_t offset;
+   IOCMD_Bool_DT result = IOCMD_TRUE;
+
+   while(IOCMD_BOOL_IS_TRUE(result) && (in < packed_size))
+   {
+      /* literals */
+      length       = IOCMD_DIV_BY_POWER_OF_2(packed[in], 4);
+      match_length = packed[in] & 0xFU;
+      in++;
+
+      if(IOCMD_BOOL_IS_FALSE(IOCMD_unpack_length(&length, packed, &in, packed_size))
+         || (length > (packed_size - in)) || (length > (data_size - out)))
+      {
+         result = IOCMD_FALSE;
+         break;
+      }
+
+      memcpy(&data[out], &packed[in], length);
+      in  += length;
+      out += length;
+
+      /* last sequence contains only literals */
+      if(in >= packed_size)
+      {
+         break;
+      }
+
+      /* match - offset in following 2 bytes, length in token */
+      length = match_length;
+
+      if((packed_size - in) < 2U)
+      {
+         result = IOCMD_FALSE;
+         break;
+      }
+
+      offset = (uint_fast16_t)(packed[in]) | IOCMD_MUL_BY_POWER_OF_2((uint_fast16_t)(packed[in + 1U]), 8);
+      in += 2U;
+
+      if(IOCMD_BOOL_IS_FALSE(IOCMD_unpack_length(&length, packed, &in, packed_size)))
+      {
+         result = IOCMD_FALSE;
+         break;
+      }
+
+      length += IOCMD_LOG_DATA_COMPRESSION_MIN_MATCH;
+
+      if((0U == offset) || (offset > out) || (length > (data_size - out)))
+      {
+         result = IOCMD_FALSE;
+         break;
+      }
+
+      /**
+       * match may overlap with its own output (runs of equal bytes) - it is copied in parts not bigger than offset;
+       * every copied part repeats the pattern so offset can be doubled after each of them
+       */
+      while(length > 0U)
+      {
+         match_length = (length > offset) ? offset : length;
+
+         memcpy(&data[out], &data[out - offset], match_length);
+
+         out    += match_length;
+         length -= match_length;
+         offset += match_length;
+      }
+   }
+
+   if(out != data_size)
+   {
+      result = IOCMD_FALSE;
+   }
+
+   return result;
+} /* IOCMD_unpack_data */
+
+static const uint8_t *IOCMD_get_packed_tab_ptr(
+   IOCMD_Buffer_Convert_UT *convert, uint_fast16_t *ppos, const uint8_t *buf, uint_fast16_t buf_size,
+   uint8_t *data, uint_fast16_t data_size)
+{
+   const uint8_t *result = IOCMD_MAKE_INVALID_PTR(const uint8_t);
+   uint_fast16_t pos = *ppos + 1U;
+   uint_fast16_t packed_size;
+
+   if(IOCMD_BOOL_IS_TRUE(IOCMD_get_u64(convert, &pos, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_1BYTE)))
+   {
+      packed_size = (uint_fast16_t)(convert->int_field.i);
+
+      if((packed_size <= (buf_size - pos))
+         && IOCMD_BOOL_IS_TRUE(IOCMD_unpack_data(&buf[pos], packed_size, data, data_size)))
+      {
+         result = data;
+         *ppos  = pos + packed_size;
+      }
+   }
+
+   return result;
+} /* IOCMD_get_packed_tab_ptr */
+#endif
+
+static uint_fast16_t IOCMD_add_standard_header_and_main_string_to_buf(
+   uint8_t      *buf,
+   uint_fast16_t buf_size,
+   uint_fast16_t pos,
+   uint_fast16_t line,
+   uint_fast8_t  level,
+   const char   *file,
+   const char   *main_string)
+{
+   IOCMD_Buffer_Convert_UT convert;
+#if (IOCMD_LOG_PRINT_TIME)
+   IOCMD_Time_DT           time;
+#endif
+#if (IOCMD_LOG_PRINT_OS_CONTEXT)
+   IOCMD_Context_ID_DT     context_id;
+   IOCMD_Context_Type_DT   context_type;
+#endif
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+   uint_fast16_t           main_string_pos;
+#endif
+
+   /* global cntr - will be added just before putting to ring buffer */
+#if(1 == IOCMD_LOG_GLOBAL_CNTR_SIZE)
+   /* reserve 1 byte for main cntr and 1 byte for global cntr */
+   pos += 2U;
+#elif (2 == IOCMD_LOG_GLOBAL_CNTR_SIZE)
+   /* reserve 2 byte for main cntr and 2 byte for global cntr */
+   pos += 4U;
+#else
+   /* reserve 4 byte for main cntr and 4 byte for global cntr */
+   pos += 8U;
+#endif
+
+#if (IOCMD_LOG_PRINT_TIME)
+   /* time - 1 to 8 bytes; depend on time size */
+   time = IOCMD_OS_GET_CURRENT_TIME();
+   IOCMD_STORE_TIME_IN_BUF(buf, pos, time);
+#endif
+
+   /* level / log type */
+   buf[pos++] = level;
+
+   /* line - 2 bytes */
+   buf[pos++] = ((uint8_t*)(&(line)))[0];
+   buf[pos++] = ((uint8_t*)(&(line)))[1];
+
+#if (IOCMD_LOG_PRINT_OS_CONTEXT)
+   /* context ID - 1 to 4 bytes, depend on context ID size */
+   context_id = IOCMD_OS_GET_CURRENT_CONTEXT_ID();
+   IOCMD_STORE_CONTEXT_ID_IN_BUF(buf, pos, context_id);
+
+   /* context type - 1 byte */
+   context_type = IOCMD_OS_GET_CURRENT_CONTEXT_TYPE();
+   buf[pos++] = ((uint8_t*)(&context_type))[0];
+#endif
+
+   /* file name - 2-9 bytes, depend on program memory size */
+   convert.ptr_field.ptr.ptr = (const void*)(&file[0 - IOCMD_PROGRAM_MEMORY_BEGIN]);
+
+#if ((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) <= 0xFFFFFFFF)
+   pos = IOCMD_add_u32_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B);
+#else
+   pos = IOCMD_add_u64_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B);
+#endif
+
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+   main_string_pos = pos;
+#endif
+
+   if((!IOCMD_FORCE_STRINGS_COPYING) && IOCMD_IS_PTR_IN_PROGRAM_MEMORY(main_string))
+   {
+      /**
+       * format string pointer if located inside of program memory (read only)
+       * 2-9 bytes, depend on program memory size
+       */
+      convert.ptr_field.ptr.ptr = (const void*)(&main_string[0 - IOCMD_PROGRAM_MEMORY_BEGIN]);
+
+#if ((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) <= 0xFFFFFFFF)
+      pos = IOCMD_add_u32_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B);
+#else
+      pos = IOCMD_add_u64_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B);
+#endif
+   }
+   else
+   {
+      /* format string located inside of RAM memory */
+      buf[pos++] = IOCMD_LOG_BUF_DATA_TYPE_STRING;
+      /* reserve one byte for NULL-terminator */
+      buf_size--;
+      while(('\0' != *main_string) && (pos < buf_size))
+      {
+         buf[pos++] = *main_string;
+         main_string++;
+      }
+      buf[pos++] = '\0';
+   }
+
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+   if(pos > main_string_pos)
+   {
+      buf[main_string_pos] |= IOCMD_LOG_BUF_DATA_TYPE_VARINT_ARGS;
+   }
+#endif
+
+   return pos;
+} /* IOCMD_add_standard_header_and_main_string_to_buf */
+
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+static uint_fast16_t IOCMD_add_call_site_header_to_buf(uint8_t *buf, uint_fast16_t pos, uint_fast32_t call_site)
+{
+#if (IOCMD_LOG_PRINT_TIME)
+   IOCMD_Time_DT           time;
+#endif
+#if (IOCMD_LOG_PRINT_OS_CONTEXT)
+   IOCMD_Context_ID_DT     context_id;
+   IOCMD_Context_Type_DT   context_type;
+#endif
+   uint16_t                index = (uint16_t)call_site;
+
+   /* global cntr and main cntr - will be added just before putting to ring buffer */
+   pos += 2U * IOCMD_LOG_GLOBAL_CNTR_SIZE;
+
+#if (IOCMD_LOG_PRINT_TIME)
+   /* time - 1 to 8 bytes; depend on time size */
+   time = IOCMD_OS_GET_CURRENT_TIME();
+   IOCMD_STORE_TIME_IN_BUF(buf, pos, time);
+#endif
+
+   /* log type - real level, line, file name and format are in call site descriptor */
+   buf[pos++] = IOCMD_LOG_CALL_SITE;
+
+#if (IOCMD_LOG_PRINT_OS_CONTEXT)
+   /* context ID - 1 to 4 bytes, depend on context ID size */
+   context_id = IOCMD_OS_GET_CURRENT_CONTEXT_ID();
+   IOCMD_STORE_CONTEXT_ID_IN_BUF(buf, pos, context_id);
+
+   /* context type - 1 byte */
+   context_type = IOCMD_OS_GET_CURRENT_CONTEXT_TYPE();
+   buf[pos++] = ((uint8_t*)(&context_type))[0];
+#endif
+
+   /* index of call site descriptor - 2 bytes */
+   buf[pos++] = ((uint8_t*)(&index))[0];
+   buf[pos++] = ((uint8_t*)(&index))[1];
+
+   return pos;
+} /* IOCMD_add_call_site_header_to_buf */
+#endif
+
+#if(IOCMD_LOG_TYPED_ARGUMENTS)
+static IOCMD_Bool_DT IOCMD_call_site_has_arg_types(const IOCMD_Log_Call_Site_XT *call_site)
+{
+   uint64_t known = call_site->arg_types;
+   uint64_t mask  = 0x1111111111111111ULL;
+
+   /* 4 bits of every argument must be different than IOCMD_LOG_ARG_UNKNOWN */
+   known = (known | IOCMD_DIV_BY_POWER_OF_2(known, 1) | IOCMD_DIV_BY_POWER_OF_2(known, 2) | IOCMD_DIV_BY_POWER_OF_2(known, 3)) & mask;
+
+   if(call_site->num_args < 16U)
+   {
+      mask &= IOCMD_MUL_BY_POWER_OF_2((uint64_t)1U, 4U * call_site->num_args) - 1U;
+   }
+
+   return ((known & mask) == mask) ? IOCMD_TRUE : IOCMD_FALSE;
+} /* IOCMD_call_site_has_arg_types */
+
+/**
+ * Checks that every conversion of the format consumes argument of matching type: %s only char pointer, other conversions
+ * and '*' of width / precision anything else; number of consumed arguments must be equal to number of arguments.
+ */
+static IOCMD_Bool_DT IOCMD_call_site_args_match_format(const IOCMD_Log_Call_Site_XT *call_site)
+{
+   const char   *format    = call_site->format;
+   uint64_t      arg_types = call_site->arg_types;
+   uint_fast8_t  num_args  = 0U;
+   IOCMD_Bool_DT is_string;
+   IOCMD_Bool_DT result    = IOCMD_TRUE;
+
+   while(IOCMD_BOOL_IS_TRUE(result) && ('\0' != *format))
+   {
+      if(('%' == format[0]) && ('%' == format[1]))
+      {
+         format = &format[2];
+      }
+      else if('%' == format[0])
+      {
+         format++;
+
+         /* flags, width, precision and length */
+         while(('\0' != *format) && (NULL != strchr("-+ #0123456789.*hljztL", *format)))
+         {
+            if('*' == *format)
+            {
+               is_string = (IOCMD_LOG_ARG_STRING == (arg_types & 0xFU)) ? IOCMD_TRUE : IOCMD_FALSE;
+               arg_types = IOCMD_DIV_BY_POWER_OF_2(arg_types, 4U);
+
+               if((num_args >= call_site->num_args) || IOCMD_BOOL_IS_TRUE(is_string))
+               {
+                  result = IOCMD_FALSE;
+               }
+               num_args++;
+            }
+            format++;
+         }
+
+         if('\0' != *format)
+         {
+            is_string = (IOCMD_LOG_ARG_STRING == (arg_types & 0xFU)) ? IOCMD_TRUE : IOCMD_FALSE;
+            arg_types = IOCMD_DIV_BY_POWER_OF_2(arg_types, 4U);
+
+            if((num_args >= call_site->num_args) || (('s' == *format) != IOCMD_BOOL_IS_TRUE(is_string)))
+            {
+               result = IOCMD_FALSE;
+            }
+            num_args++;
+            format++;
+         }
+      }
+      else
+      {
+         format++;
+      }
+   }
+
+   return (IOCMD_BOOL_IS_TRUE(result) && (num_args == call_site->num_args)) ? IOCMD_TRUE : IOCMD_FALSE;
+} /* IOCMD_call_site_args_match_format */
+
+/**
+ * Returns IOCMD_TRUE if arguments of the call site can be stored according to types from its descriptor.
+ * Format is checked only once - result is remembered in descriptor's arg_types_check.
+ */
+static IOCMD_Bool_DT IOCMD_call_site_use_arg_types(const IOCMD_Log_Call_Site_XT *call_site)
+{
+   uint_least8_t check = atomic_load_explicit(call_site->arg_types_check, memory_order_relaxed);
+
+   if(IOCMD_LOG_ARG_TYPES_NOT_CHECKED == check)
+   {
+      check = (IOCMD_BOOL_IS_TRUE(IOCMD_call_site_has_arg_types(call_site))
+         && IOCMD_BOOL_IS_TRUE(IOCMD_call_site_args_match_format(call_site)))
+         ? IOCMD_LOG_ARG_TYPES_VALID : IOCMD_LOG_ARG_TYPES_INVALID;
+
+      /* every context computes the same value, so concurrent first logs only repeat the check */
+      atomic_store_explicit(call_site->arg_types_check, check, memory_order_relaxed);
+   }
+
+   return (IOCMD_LOG_ARG_TYPES_VALID == check) ? IOCMD_TRUE : IOCMD_FALSE;
+} /* IOCMD_call_site_use_arg_types */
+
+/**
+ * Copies arguments to the log in the same form as IOCMD_Compress_Param does, but according to types from call site descriptor,
+ * so format is not parsed. Integers are stored without IOCMD_LOG_VARINT_ARGUMENTS encoding - their signedness is known
+ * only from the format.
+ */
+static uint_fast16_t IOCMD_add_typed_args_to_buf(
+   uint8_t *buf, uint_fast16_t buf_size, uint_fast16_t pos, const IOCMD_Log_Call_Site_XT *call_site, va_list arg)
+{
+   IOCMD_Buffer_Convert_UT convert;
+   const char   *pstr;
+   uint64_t      arg_types = call_site->arg_types;
+   uint_fast8_t  num_args  = call_site->num_args;
+   uint_fast8_t  type;
+
+   while(num_args > 0U)
+   {
+      type        = (uint_fast8_t)(arg_types & 0xFU);
+      arg_types   = IOCMD_DIV_BY_POWER_OF_2(arg_types, 4U);
+      num_args--;
+
+      memset(&convert, 0, sizeof(convert));
+
+      if((IOCMD_LOG_ARG_INT == type) || ((IOCMD_LOG_ARG_LONG == type) && (sizeof(long) <= sizeof(uint32_t))))
+      {
+         if(IOCMD_LOG_ARG_INT == type)
+         {
+            convert.u32_field.u32_0 = (uint32_t)va_arg(arg, unsigned int);
+         }
+         else
+         {
+            convert.u32_field.u32_0 = (uint32_t)va_arg(arg, unsigned long);
+         }
+         pos = IOCMD_add_u32_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+      }
+      else if((IOCMD_LOG_ARG_LONG == type) || (IOCMD_LOG_ARG_LONG_LONG == type))
+      {
+#if(IOCMD_OUT_SUPPORT_U64)
+         if(IOCMD_LOG_ARG_LONG == type)
+         {
+            convert.u64_field.u64 = (uint64_t)va_arg(arg, unsigned long);
+         }
+         else
+         {
+            convert.u64_field.u64 = (uint64_t)va_arg(arg, unsigned long long);
+         }
+         pos = IOCMD_add_u64_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#else
+         /* 8-bytes integers are not printed */
+         if(IOCMD_LOG_ARG_LONG == type)
+         {
+            (void)va_arg(arg, unsigned long);
+         }
+         else
+         {
+            (void)va_arg(arg, unsigned long long);
+         }
+#endif
+      }
+      else if((IOCMD_LOG_ARG_DOUBLE == type) || (IOCMD_LOG_ARG_LONG_DOUBLE == type))
+      {
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+         if(IOCMD_LOG_ARG_DOUBLE == type)
+         {
+            convert.double_field.d = va_arg(arg, double);
+         }
+         else
+         {
+            convert.double_field.d = (double)va_arg(arg, long double);
+         }
+         if((buf_size - pos) > sizeof(double))
+         {
+            buf[pos++] = IOCMD_LOG_BUF_DATA_TYPE_DOUBLE;
+            memcpy(&buf[pos], &(convert.double_field.d), sizeof(double));
+            pos += sizeof(double);
+         }
+#else
+         /* floating point numbers are not printed */
+         if(IOCMD_LOG_ARG_DOUBLE == type)
+         {
+            (void)va_arg(arg, double);
+         }
+         else
+         {
+            (void)va_arg(arg, long double);
+         }
+#endif
+      }
+      else if(IOCMD_LOG_ARG_STRING == type)
+      {
+         pstr = va_arg(arg, const char*);
+
+         if((!IOCMD_FORCE_STRINGS_COPYING) && IOCMD_IS_PTR_IN_PROGRAM_MEMORY(pstr))
+         {
+            convert.ptr_field.ptr.ptr = (const void*)(&pstr[0 - IOCMD_PROGRAM_MEMORY_BEGIN]);
+
+#if ((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) <= 0xFFFFFFFF)
+            pos = IOCMD_add_u32_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B);
+#else
+            pos = IOCMD_add_u64_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B);
+#endif
+         }
+         else if((buf_size - pos) >= 2U)
+         {
+            buf[pos++] = IOCMD_LOG_BUF_DATA_TYPE_STRING;
+            /* reserve one byte for NULL terminator */
+            while(('\0' != *pstr) && ((pos + 1U) < buf_size))
+            {
+               buf[pos++] = *pstr;
+               pstr++;
+            }
+            buf[pos++] = '\0';
+         }
+      }
+      else
+      {
+         convert.ptr_field.ptr.ptr = va_arg(arg, const void*);
+#if (((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) > 0xFFFFFFFF) || IOCMD_OUT_SUPPORT_U64)
+         pos = IOCMD_add_u64_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#else
+         pos = IOCMD_add_u32_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#endif
+      }
+   }
+
+   return pos;
+} /* IOCMD_add_typed_args_to_buf */
+#endif
+
+#if(IOCMD_SUPPORT_DATA_COMPARISON || IOCMD_SUPPORT_DATA_LOGGING)
+static void IOCMD_add_data_tab_to_buf(
+   uint8_t *buf, uint_fast16_t buf_size, const void *data, uint_fast16_t data_size, Buff_Readable_Vector_XT *table)
+{
+   IOCMD_Buffer_Convert_UT convert;
+   Buff_Size_DT cntr = 0U;
+
+   /**
+    * flags:
+    * bit0: data was cut
+    * bit1: print addresses as hex
+    * bit2: fragment of data log (see IOCMD_set_data_fragment)
+    */
+   buf[0] = 0U;
+
+   /* data size */
+   convert.int_field.i = (int)data_size;
+   cntr = IOCMD_add_u32_to_buf(&convert, buf, buf_size - 1U, 1U, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+
+   if((!IOCMD_FORCE_STRINGS_COPYING) && IOCMD_IS_PTR_IN_PROGRAM_MEMORY(data))
+   {
+      /**
+       * format string pointer if located inside of program memory (read only)
+       * 2-9 bytes, depend on program memory size
+       */
+      convert.ptr_field.ptr.ptr = (const void*)(&((const uint8_t*)data)[0 - IOCMD_PROGRAM_MEMORY_BEGIN]);
+
+#if ((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) <= 0xFFFFFFFF)
+      cntr = IOCMD_add_u32_to_buf(&convert, buf, buf_size - cntr, cntr, IOCMD_LOG_BUF_DATA_TYPE_PTAB_1B);
+#else
+      cntr = IOCMD_add_u64_to_buf(&convert, buf, buf_size - cntr, cntr, IOCMD_LOG_BUF_DATA_TYPE_PTAB_1B);
+#endif
+
+      table[1].data = IOCMD_MAKE_INVALID_PTR(const void);
+      table[1].size = 0U;
+   }
+   else
+   {
+      buf[cntr++] = IOCMD_LOG_BUF_DATA_TYPE_TAB;
+
+      table[1].data = data;
+      table[1].size = data_size;
+   }
+
+   table[0].data = buf;
+   table[0].size = cntr;
+} /* IOCMD_add_data_tab_to_buf */
+#endif
+
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+/**
+ * Prepares fragment of data log which begins from byte "offset" of data: flags, size of fragment, offset and size of whole data
+ * are put to desc (table[1]), part of data to table[2]. Fragment is as big as possible to fit into IOCMD_WORKING_BUF_RECOMMENDED_SIZE
+ * together with header (table[0]) and arguments (table[3]). Returns size of the log.
+ */
+static uint_fast16_t IOCMD_set_data_fragment(
+   uint8_t *desc, uint_fast16_t desc_size, const uint8_t *data, uint_fast16_t data_size, uint_fast16_t offset, Buff_Readable_Vector_XT *table)
+{
+   IOCMD_Buffer_Convert_UT convert;
+   uint_fast16_t part;
+   uint_fast16_t cntr;
+
+   part = IOCMD_WORKING_BUF_RECOMMENDED_SIZE - table[0].size - table[3].size - IOCMD_LOG_DATA_FRAGMENT_DESC_SIZE;
 
-      *ppos = pos;
+   if(part > (data_size - offset))
+   {
+      part = data_size - offset;
    }
-   return result;
-} /* IOCMD_get_u64 */
 
-static uint_fast8_t IOCMD_get_char(IOCMD_Buffer_Convert_UT *data, const uint8_t *buf, uint_fast16_t *ppos)
+   desc[0] = IOCMD_LOG_DATA_FLAG_FRAGMENT;
+
+   convert.int_field.i = (int)part;
+   cntr = IOCMD_add_u32_to_buf(&convert, desc, desc_size - 1U, 1U, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+
+   convert.int_field.i = (int)offset;
+   cntr = IOCMD_add_u32_to_buf(&convert, desc, desc_size - cntr, cntr, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+
+   convert.int_field.i = (int)data_size;
+   cntr = IOCMD_add_u32_to_buf(&convert, desc, desc_size - cntr, cntr, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+
+   desc[cntr++] = IOCMD_LOG_BUF_DATA_TYPE_TAB;
+
+   table[1].data = desc;
+   table[1].size = cntr;
+   table[2].data = &data[offset];
+   table[2].size = part;
+
+   return table[0].size + table[1].size + table[2].size + table[3].size;
+} /* IOCMD_set_data_fragment */
+#endif
+
+#if(IOCMD_SUPPORT_DATA_COMPARISON)
+/**
+ * Returns number of bytes of data of size "size" which are placed in row beginning from byte "pos".
+ */
+static uint8_t IOCMD_compare_data_row_size(uint_fast16_t pos, uint_fast16_t size)
 {
-   uint_fast16_t pos = *ppos;
-   uint_fast8_t data_type;
-   uint_fast8_t cntr = 0xFFU;
+   uint8_t result = 0U;
 
-#if(IOCMD_OUT_SUPPORT_U64)
-      data->u64_field.u64 = 0U;
-#else
-      data->u32_field.u32_0 = 0U;
+   if(size > pos)
+   {
+      if((size - pos) >= (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT))
+      {
+         result = (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT);
+      }
+      else
+      {
+         result = size - pos;
+      }
+   }
+
+   return result;
+} /* IOCMD_compare_data_row_size */
 #endif
 
-   data_type = (uint_fast8_t)buf[pos] & 0xFFU;
+#if(IOCMD_LOG_DATA_COMPARE_DIFF_ONLY)
+/**
+ * Returns offset of first byte from range pos - (size - 1) which differs between data1 and data2, or size if all are equal.
+ */
+static uint_fast16_t IOCMD_find_data_difference(const uint8_t *data1, const uint8_t *data2, uint_fast16_t pos, uint_fast16_t size)
+{
+   while(((size - pos) >= IOCMD_LOG_DATA_COMPARE_DIFF_BLOCK_SIZE)
+      && (0 == memcmp(&data1[pos], &data2[pos], IOCMD_LOG_DATA_COMPARE_DIFF_BLOCK_SIZE)))
+   {
+      pos += IOCMD_LOG_DATA_COMPARE_DIFF_BLOCK_SIZE;
+   }
 
-   if(IOCMD_LOG_BUF_DATA_TYPE_CHAR == data_type)
+   while((pos < size) && (data1[pos] == data2[pos]))
    {
       pos++;
-      data->char_field.c = (char)(buf[pos++]);
-      cntr = 1U;
    }
 
-   *ppos = pos;
+   return pos;
+} /* IOCMD_find_data_difference */
+
+static uint_fast16_t IOCMD_add_data_diff_desc_to_buf(uint8_t *buf, uint_fast16_t buf_size, uint_fast16_t data_size)
+{
+   IOCMD_Buffer_Convert_UT convert;
+   uint_fast16_t cntr;
+
+   /* flags - data is never cut */
+   buf[0] = 0U;
+
+   convert.int_field.i = (int)data_size;
+   cntr = IOCMD_add_u32_to_buf(&convert, buf, buf_size - 1U, 1U, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+
+   buf[cntr++] = IOCMD_LOG_BUF_DATA_TYPE_DIFF;
 
    return cntr;
-} /* IOCMD_get_char */
+} /* IOCMD_add_data_diff_desc_to_buf */
 
-static const char *IOCMD_get_string_ptr(IOCMD_Buffer_Convert_UT *convert, uint_fast16_t *ppos, const uint8_t *buf, uint_fast16_t buf_size)
+/**
+ * Compares data1 and data2 and stores into diff only rows (8 * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT bytes) which differ,
+ * with IOCMD_LOG_DATA_COMPARE_DIFF_CONTEXT_ROWS rows around them. Rows beyond end of shorter data are always stored.
+ * Format of diff: number of rows (2 bytes), then for every row: row index (2 bytes), part of data1, part of data2.
+ * Diff is placed in data2 table; data1 table is empty.
+ *
+ * Returns IOCMD_FALSE if diff cannot be used (data in program memory or diff bigger than diff_size) - then
+ * IOCMD_add_data_tab_to_buf must be used for both data.
+ */
+static IOCMD_Bool_DT IOCMD_add_data_diff_to_buf(
+   uint8_t *desc1, uint8_t *desc2, uint_fast16_t desc_size, uint8_t *diff, uint_fast16_t diff_size,
+   const uint8_t *data1, uint_fast16_t size1, const uint8_t *data2, uint_fast16_t size2,
+   Buff_Readable_Vector_XT *table)
 {
-   const char *result = IOCMD_MAKE_INVALID_PTR(const char);
-   uint_fast16_t pos = *ppos;
-
-   if(IOCMD_BOOL_IS_TRUE(IOCMD_get_u64(convert, ppos, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B)))
+   uint_fast16_t data_size   = (size1 > size2) ? size1 : size2;
+   uint_fast16_t common_size = (size1 > size2) ? size2 : size1;
+   uint_fast16_t num_rows    = 0U;
+   uint_fast16_t next_row    = 0U;
+   uint_fast16_t pos         = 2U;
+   uint_fast16_t row;
+   uint_fast16_t last_row;
+   uint_fast16_t offset;
+   uint8_t       row_size1;
+   uint8_t       row_size2;
+   IOCMD_Bool_DT result = IOCMD_TRUE;
+
+   if((!IOCMD_FORCE_STRINGS_COPYING) && (IOCMD_IS_PTR_IN_PROGRAM_MEMORY(data1) || IOCMD_IS_PTR_IN_PROGRAM_MEMORY(data2)))
    {
-      result = &(convert->ptr_field.ptr.string[IOCMD_PROGRAM_MEMORY_BEGIN]);
+      result = IOCMD_FALSE;
    }
-   else if(IOCMD_LOG_BUF_DATA_TYPE_STRING == buf[pos])
+
+   for(row = 0U; IOCMD_BOOL_IS_TRUE(result) && ((row * (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT)) < data_size); row++)
    {
-      pos++;
+      offset = row * (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT);
 
-      result = (const char*)(&buf[pos]);
-      while(pos < buf_size)
+      /* part which exists only in one of data is always different */
+      if(offset < common_size)
       {
-         if('\0' == buf[pos])
+         offset = IOCMD_find_data_difference(data1, data2, offset, common_size);
+      }
+
+      if(offset >= data_size)
+      {
+         break;
+      }
+
+      row      = offset / (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT);
+      last_row = (data_size - 1U) / (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT);
+
+      if((row + IOCMD_LOG_DATA_COMPARE_DIFF_CONTEXT_ROWS) < last_row)
+      {
+         last_row = row + IOCMD_LOG_DATA_COMPARE_DIFF_CONTEXT_ROWS;
+      }
+
+      if((next_row + IOCMD_LOG_DATA_COMPARE_DIFF_CONTEXT_ROWS) < row)
+      {
+         next_row = row - IOCMD_LOG_DATA_COMPARE_DIFF_CONTEXT_ROWS;
+      }
+
+      for(; next_row <= last_row; next_row++)
+      {
+         offset    = next_row * (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT);
+         row_size1 = IOCMD_compare_data_row_size(offset, size1);
+         row_size2 = IOCMD_compare_data_row_size(offset, size2);
+
+         if((diff_size - pos) < (2U + row_size1 + row_size2))
          {
-            pos++;
+            result = IOCMD_FALSE;
             break;
          }
-         pos++;
+
+         diff[pos++] = (uint8_t)next_row;
+         diff[pos++] = (uint8_t)IOCMD_DIV_BY_POWER_OF_2(next_row, 8);
+         memcpy(&diff[pos], &data1[offset], row_size1);
+         pos += row_size1;
+         memcpy(&diff[pos], &data2[offset], row_size2);
+         pos += row_size2;
+
+         num_rows++;
       }
+   }
 
-      *ppos = pos;
+   /* diff is used only if it is smaller than copy of both data */
+   if(pos >= (size1 + size2))
+   {
+      result = IOCMD_FALSE;
+   }
+
+   if(IOCMD_BOOL_IS_TRUE(result))
+   {
+      diff[0] = (uint8_t)num_rows;
+      diff[1] = (uint8_t)IOCMD_DIV_BY_POWER_OF_2(num_rows, 8);
+
+      table[1].data = desc1;
+      table[1].size = IOCMD_add_data_diff_desc_to_buf(desc1, desc_size, size1);
+      table[2].data = IOCMD_MAKE_INVALID_PTR(const void);
+      table[2].size = 0U;
+      table[3].data = desc2;
+      table[3].size = IOCMD_add_data_diff_desc_to_buf(desc2, desc_size, size2);
+      table[4].data = diff;
+      table[4].size = pos;
    }
 
    return result;
-} /* IOCMD_get_string_ptr */
+} /* IOCMD_add_data_diff_to_buf */
+#endif
 
-#if(IOCMD_SUPPORT_DATA_COMPARISON || IOCMD_SUPPORT_DATA_LOGGING)
-static const uint8_t *IOCMD_get_tab_ptr(
-   IOCMD_Buffer_Convert_UT *convert, uint_fast16_t *ppos, const uint8_t *buf, uint_fast16_t buf_size, uint_fast16_t tab_size)
+#if(IOCMD_LOG_DATA_COMPRESSION)
+static uint_fast16_t IOCMD_pack_length(uint8_t *packed, uint_fast16_t pos, uint_fast16_t length)
 {
-   const uint8_t *result = IOCMD_MAKE_INVALID_PTR(const uint8_t);
-   uint_fast16_t pos = *ppos;
+   for(length -= 15U; length >= 255U; length -= 255U)
+   {
+      packed[pos++] = 255U;
+   }
+   packed[pos++] = (uint8_t)length;
 
-   if(IOCMD_BOOL_IS_TRUE(IOCMD_get_u64(convert, ppos, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_PTAB_1B)))
+   return pos;
+} /* IOCMD_pack_length */
+
+/**
+ * Writes one sequence: token (4 bits of literals length, 4 bits of match length), literals, match offset.
+ * Sequence without match (match_length == 0) is always the last one.
+ * Returns new position in packed or 0 if sequence doesn't fit into packed_size.
+ */
+static uint_fast16_t IOCMD_pack_sequence(
+   uint8_t *packed, uint_fast16_t packed_size, uint_fast16_t pos,
+   const uint8_t *literals, uint_fast16_t literals_length, uint_fast16_t offset, uint_fast16_t match_length)
+{
+   uint_fast16_t token_pos = pos;
+
+   /* token, length extensions (1 byte per 255), literals, offset and match length extensions */
+   if((packed_size - pos) < (1U + (literals_length / 255U) + 1U + literals_length + 2U + (match_length / 255U) + 1U))
    {
-      result = &(convert->ptr_field.ptr.cu8[IOCMD_PROGRAM_MEMORY_BEGIN]);
+      pos = 0U;
    }
-   else if(IOCMD_LOG_BUF_DATA_TYPE_TAB == buf[pos])
+   else
    {
       pos++;
 
-      result = (const uint8_t*)(&buf[pos]);
+      if(literals_length >= 15U)
+      {
+         packed[token_pos] = 0xF0U;
+         pos = IOCMD_pack_length(packed, pos, literals_length);
+      }
+      else
+      {
+         packed[token_pos] = (uint8_t)IOCMD_MUL_BY_POWER_OF_2(literals_length, 4);
+      }
 
-      pos   += tab_size;
+      memcpy(&packed[pos], literals, literals_length);
+      pos += literals_length;
 
-      *ppos  = pos;
+      if(match_length > 0U)
+      {
+         packed[pos++] = (uint8_t)offset;
+         packed[pos++] = (uint8_t)IOCMD_DIV_BY_POWER_OF_2(offset, 8);
+
+         match_length -= IOCMD_LOG_DATA_COMPRESSION_MIN_MATCH;
+
+         if(match_length >= 15U)
+         {
+            packed[token_pos] |= 0x0FU;
+            pos = IOCMD_pack_length(packed, pos, match_length);
+         }
+         else
+         {
+            packed[token_pos] |= (uint8_t)match_length;
+         }
+      }
    }
 
-   return result;
-} /* IOCMD_get_tab_ptr */
-#endif
+   return pos;
+} /* IOCMD_pack_sequence */
 
-static uint_fast16_t IOCMD_add_standard_header_and_main_string_to_buf(
-   uint8_t      *buf,
-   uint_fast16_t buf_size,
-   uint_fast16_t pos,
-   uint_fast16_t line,
-   uint_fast8_t  level,
-   const char   *file,
-   const char   *main_string)
+/**
+ * Compresses data using greedy LZ77 matcher with hash table of 4-byte sequences.
+ * Returns size of compressed data or 0 if it doesn't fit into packed_size.
+ */
+static uint_fast16_t IOCMD_pack_data(const uint8_t *data, uint_fast16_t data_size, uint8_t *packed, uint_fast16_t packed_size)
 {
-   IOCMD_Buffer_Convert_UT convert;
-#if (IOCMD_LOG_PRINT_TIME)
-   IOCMD_Time_DT           time;
-#endif
-#if (IOCMD_LOG_PRINT_OS_CONTEXT)
-   IOCMD_Context_ID_DT     context_id;
-   IOCMD_Context_Type_DT   context_type;
-#endif
-
-   /* global cntr - will be added just before putting to ring buffer */
-#if(1 == IOCMD_LOG_GLOBAL_CNTR_SIZE)
-   /* reserve 1 byte for main cntr and 1 byte for global cntr */
-   pos += 2U;
-#elif (2 == IOCMD_LOG_GLOBAL_CNTR_SIZE)
-   /* reserve 2 byte for main cntr and 2 byte for global cntr */
-   pos += 4U;
-#else
-   /* reserve 4 byte for main cntr and 4 byte for global cntr */
-   pos += 8U;
-#endif
+   uint16_t      hash_tab[1U << IOCMD_LOG_DATA_COMPRESSION_HASH_BITS];
+   uint32_t      sequence;
+   uint32_t      candidate_sequence;
+   uint_fast16_t pos    = 0U;
+   uint_fast16_t anchor = 0U;
+   uint_fast16_t out    = 0U;
+   uint_fast16_t candidate;
+   uint_fast16_t length;
+   uint_fast16_t hash;
+   IOCMD_Bool_DT fits = IOCMD_TRUE;
+
+   memset(hash_tab, 0, sizeof(hash_tab));
+
+   while(IOCMD_BOOL_IS_TRUE(fits) && ((pos + IOCMD_LOG_DATA_COMPRESSION_MIN_MATCH) <= data_size))
+   {
+      memcpy(&sequence, &data[pos], sizeof(sequence));
 
-#if (IOCMD_LOG_PRINT_TIME)
-   /* time - 1 to 8 bytes; depend on time size */
-   time = IOCMD_OS_GET_CURRENT_TIME();
-   IOCMD_STORE_TIME_IN_BUF(buf, pos, time);
-#endif
+      hash = (uint_fast16_t)((sequence * 2654435761U) >> (32U - IOCMD_LOG_DATA_COMPRESSION_HASH_BITS));
 
-   /* level / log type */
-   buf[pos++] = level;
+      candidate       = hash_tab[hash];
+      hash_tab[hash]  = (uint16_t)pos;
 
-   /* line - 2 bytes */
-   buf[pos++] = ((uint8_t*)(&(line)))[0];
-   buf[pos++] = ((uint8_t*)(&(line)))[1];
+      memcpy(&candidate_sequence, &data[candidate], sizeof(candidate_sequence));
 
-#if (IOCMD_LOG_PRINT_OS_CONTEXT)
-   /* context ID - 1 to 4 bytes, depend on context ID size */
-   context_id = IOCMD_OS_GET_CURRENT_CONTEXT_ID();
-   IOCMD_STORE_CONTEXT_ID_IN_BUF(buf, pos, context_id);
+      if((candidate < pos) && (candidate_sequence == sequence))
+      {
+         length = IOCMD_LOG_DATA_COMPRESSION_MIN_MATCH;
 
-   /* context type - 1 byte */
-   context_type = IOCMD_OS_GET_CURRENT_CONTEXT_TYPE();
-   buf[pos++] = ((uint8_t*)(&context_type))[0];
-#endif
+         /* memcmp of constant size is compiled into single 64-bit comparison */
+         while(((data_size - pos - length) >= 8U) && (0 == memcmp(&data[candidate + length], &data[pos + length], 8U)))
+         {
+            length += 8U;
+         }
 
-   /* file name - 2-9 bytes, depend on program memory size */
-   convert.ptr_field.ptr.ptr = (const void*)(&file[0 - IOCMD_PROGRAM_MEMORY_BEGIN]);
+         while((length < (data_size - pos)) && (data[candidate + length] == data[pos + length]))
+         {
+            length++;
+         }
 
-#if ((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) <= 0xFFFFFFFF)
-   pos = IOCMD_add_u32_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B);
-#else
-   pos = IOCMD_add_u64_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B);
-#endif
+         out = IOCMD_pack_sequence(packed, packed_size, out, &data[anchor], pos - anchor, pos - candidate, length);
 
-   if((!IOCMD_FORCE_STRINGS_COPYING) && IOCMD_IS_PTR_IN_PROGRAM_MEMORY(main_string))
-   {
-      /**
-       * format string pointer if located inside of program memory (read only)
-       * 2-9 bytes, depend on program memory size
-       */
-      convert.ptr_field.ptr.ptr = (const void*)(&main_string[0 - IOCMD_PROGRAM_MEMORY_BEGIN]);
+         if(0U == out)
+         {
+            fits = IOCMD_FALSE;
+         }
 
-#if ((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) <= 0xFFFFFFFF)
-      pos = IOCMD_add_u32_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B);
-#else
-      pos = IOCMD_add_u64_to_buf(&convert, buf, buf_size - pos, pos, IOCMD_LOG_BUF_DATA_TYPE_PSTRING1B);
-#endif
-   }
-   else
-   {
-      /* format string located inside of RAM memory */
-      buf[pos++] = IOCMD_LOG_BUF_DATA_TYPE_STRING;
-      /* reserve one byte for NULL-terminator */
-      buf_size--;
-      while(('\0' != *main_string) && (pos < buf_size))
+         pos   += length;
+         anchor = pos;
+      }
+      else
       {
-         buf[pos++] = *main_string;
-         main_string++;
+         /* step grows with number of bytes without match - incompressible data is skipped faster */
+         pos += 1U + IOCMD_DIV_BY_POWER_OF_2(pos - anchor, 5);
       }
-      buf[pos++] = '\0';
    }
 
-   return pos;
-} /* IOCMD_add_standard_header_and_main_string_to_buf */
+   if(IOCMD_BOOL_IS_TRUE(fits))
+   {
+      out = IOCMD_pack_sequence(packed, packed_size, out, &data[anchor], data_size - anchor, 0U, 0U);
+   }
 
-#if(IOCMD_SUPPORT_DATA_COMPARISON || IOCMD_SUPPORT_DATA_LOGGING)
-static void IOCMD_add_data_tab_to_buf(
-   uint8_t *buf, uint_fast16_t buf_size, const void *data, uint_fast16_t data_size, Buff_Readable_Vector_XT *table)
+   return out;
+} /* IOCMD_pack_data */
+
+/**
+ * Adds data size and compressed data to the log if compression makes data smaller.
+ * Returns IOCMD_FALSE if data was not compressed - then IOCMD_add_data_tab_to_buf must be used.
+ */
+static IOCMD_Bool_DT IOCMD_add_packed_data_tab_to_buf(
+   uint8_t *buf, uint_fast16_t buf_size, uint8_t *packed, uint_fast16_t packed_size,
+   const void *data, uint_fast16_t data_size, Buff_Readable_Vector_XT *table)
 {
    IOCMD_Buffer_Convert_UT convert;
-   Buff_Size_DT cntr = 0U;
-
-   /**
-    * flags:
-    * bit0: data was cut
-    * bit1: print addresses as hex
-    */
-   buf[0] = 0U;
-
-   /* data size */
-   convert.int_field.i = (int)data_size;
-   cntr = IOCMD_add_u32_to_buf(&convert, buf, buf_size - 1U, 1U, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
-
-   if((!IOCMD_FORCE_STRINGS_COPYING) && IOCMD_IS_PTR_IN_PROGRAM_MEMORY(data))
-   {
-      /**
-       * format string pointer if located inside of program memory (read only)
-       * 2-9 bytes, depend on program memory size
-       */
-      convert.ptr_field.ptr.ptr = (const void*)(&((const uint8_t*)data)[0 - IOCMD_PROGRAM_MEMORY_BEGIN]);
-
-#if ((IOCMD_PROGRAM_MEMORY_END - IOCMD_PROGRAM_MEMORY_BEGIN) <= 0xFFFFFFFF)
-      cntr = IOCMD_add_u32_to_buf(&convert, buf, buf_size - cntr, cntr, IOCMD_LOG_BUF_DATA_TYPE_PTAB_1B);
-#else
-      cntr = IOCMD_add_u64_to_buf(&convert, buf, buf_size - cntr, cntr, IOCMD_LOG_BUF_DATA_TYPE_PTAB_1B);
-#endif
+   uint_fast16_t cntr;
+   IOCMD_Bool_DT result = IOCMD_FALSE;
 
-      table[1].data = IOCMD_MAKE_INVALID_PTR(const void);
-      table[1].size = 0U;
-   }
-   else
+   /* only data which will be possible to decompress into buffer of IOCMD_Proc_Buffered_Logs */
+   if((data_size >= IOCMD_LOG_DATA_COMPRESSION_THRESHOLD) && (data_size <= IOCMD_MAX_LOG__DATA_1_LENGTH)
+      && (IOCMD_FORCE_STRINGS_COPYING || (!IOCMD_IS_PTR_IN_PROGRAM_MEMORY(data))))
    {
-      buf[cntr++] = IOCMD_LOG_BUF_DATA_TYPE_TAB;
+      /* compressed data must be smaller than original one; size of compressed data takes up to 3 bytes */
+      if(packed_size > (data_size - 4U))
+      {
+         packed_size = data_size - 4U;
+      }
 
-      table[1].data = data;
-      table[1].size = data_size;
+      packed_size = IOCMD_pack_data((const uint8_t*)data, data_size, packed, packed_size);
+
+      if(0U != packed_size)
+      {
+         /* flags - data is never cut */
+         buf[0] = 0U;
+
+         convert.int_field.i = (int)data_size;
+         cntr = IOCMD_add_u32_to_buf(&convert, buf, buf_size - 1U, 1U, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+
+         buf[cntr++] = IOCMD_LOG_BUF_DATA_TYPE_PACKED;
+
+         convert.int_field.i = (int)packed_size;
+         cntr = IOCMD_add_u32_to_buf(&convert, buf, buf_size - cntr, cntr, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+
+         table[0].data = buf;
+         table[0].size = cntr;
+         table[1].data = packed;
+         table[1].size = packed_size;
+
+         result = IOCMD_TRUE;
+      }
    }
 
-   table[0].data = buf;
-   table[0].size = cntr;
-} /* IOCMD_add_data_tab_to_buf */
+   return result;
+} /* IOCMD_add_packed_data_tab_to_buf */
 #endif
 
 static uint_fast16_t IOCMD_get_log_header_main_cntr_time_and_level_from_buf(
@@ -876,11 +3627,58 @@ static uint_fast16_t IOCMD_get_rest_of_log_header_and_main_string_from_buf(
    /* file name - 1-8 bytes, depend on program memory size */
    header->file = IOCMD_get_string_ptr(convert, &cntr, buf, buf_size);
 
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+   header->varint_args = ((cntr < buf_size) && (0U != (buf[cntr] & IOCMD_LOG_BUF_DATA_TYPE_VARINT_ARGS)))
+      ? IOCMD_TRUE : IOCMD_FALSE;
+#endif
+
    header->main_string = IOCMD_get_string_ptr(convert, &cntr, buf, buf_size);
 
    return cntr;
 } /* IOCMD_get_rest_of_log_header_and_main_string_from_buf */
 
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+static uint_fast16_t IOCMD_get_call_site_header_from_buf(IOCMD_standard_header_and_main_string_XT *header, const uint8_t *buf)
+{
+   const IOCMD_Log_Call_Site_XT *call_site;
+   uint_fast16_t cntr = 0U;
+   uint16_t index;
+
+#if (IOCMD_LOG_PRINT_OS_CONTEXT)
+   /* context ID - 1 to 8 bytes, depend on context ID size */
+   cntr = IOCMD_read_context_id(buf, cntr, &(header->context_id));
+
+   /* context type - 1 byte */
+   ((uint8_t*)(&(header->context_type)))[0] = buf[cntr++];
+#endif
+
+   /* index of call site descriptor - 2 bytes */
+   ((uint8_t*)(&index))[0] = buf[cntr++];
+   ((uint8_t*)(&index))[1] = buf[cntr++];
+
+   /* for unknown index level stays IOCMD_LOG_CALL_SITE and log is not printed */
+   if(index < (IOCMD_LOG_CALL_SITES_END - IOCMD_LOG_CALL_SITES_BEGIN))
+   {
+      call_site = &IOCMD_LOG_CALL_SITES_BEGIN[index];
+
+      header->level        = call_site->level;
+      header->line         = call_site->line;
+      header->file         = call_site->file;
+      header->main_string  = call_site->format;
+#if(IOCMD_LOG_TYPED_ARGUMENTS)
+      header->typed_args   = IOCMD_call_site_use_arg_types(call_site);
+#endif
+#if(IOCMD_LOG_VARINT_ARGUMENTS && IOCMD_LOG_TYPED_ARGUMENTS)
+      header->varint_args  = IOCMD_BOOL_IS_TRUE(header->typed_args) ? IOCMD_FALSE : IOCMD_TRUE;
+#elif(IOCMD_LOG_VARINT_ARGUMENTS)
+      header->varint_args  = IOCMD_TRUE;
+#endif
+   }
+
+   return cntr;
+} /* IOCMD_get_call_site_header_from_buf */
+#endif
+
 static void IOCMD_print_main_cntr(
    const IOCMD_Print_Exe_Params_XT *exe, IOCMD_standard_header_and_main_string_XT *header, IOCMD_Bool_DT is_quiet_log)
 {
@@ -919,75 +3717,53 @@ static void IOCMD_print_main_cntr(
 #endif
 } /* IOCMD_print_main_cntr */
 
-#if(IOCMD_SUPPORT_DATA_LOGGING || IOCMD_SUPPORT_DATA_COMPARISON)
-static void IOCMD_print_data(char *temp, const IOCMD_Print_Exe_Params_XT *exe, const uint8_t *data, uint_fast16_t data_size, uint_fast16_t num_bytes_to_print)
+#if(IOCMD_SUPPORT_DATA_COMPARISON)
+static void IOCMD_print_data(
+   char *temp, const IOCMD_Print_Exe_Params_XT *exe, const uint8_t *data, const uint8_t *ref, uint_fast16_t data_size, uint_fast16_t num_bytes_to_print)
 {
-   uint_fast16_t cntr;
-   for(cntr = 0U; cntr < num_bytes_to_print; cntr += 8U)
-   {
-      if(data_size > cntr)
-      {
-         (void)IOCMD_debug_format_u8(temp, &data[cntr], data_size - cntr);
-         (void)exe->print_string(exe->dev, temp);
-      }
-      else
-      {
-         (void)exe->print_string_repeat(exe->dev, " ", 25);
-      }
-   }
+   char *ptr = IOCMD_render_hex_row(temp, data, ref, data_size, num_bytes_to_print);
+
+   *ptr = '\0';
+   (void)exe->print_string(exe->dev, temp);
 } /* IOCMD_print_data */
 
-static const uint8_t *IOCMD_print_ascii(
-   char *temp, const IOCMD_Print_Exe_Params_XT *exe, const uint8_t *data, uint_fast16_t data_size, uint_fast16_t num_bytes_to_print, IOCMD_Bool_DT allow_shorter_string)
+static void IOCMD_print_ascii(
+   char *temp, const IOCMD_Print_Exe_Params_XT *exe, const uint8_t *data, const uint8_t *ref, uint_fast16_t data_size, uint_fast16_t num_bytes_to_print)
 {
-   char *ptr = temp;
+   char *ptr = IOCMD_render_ascii_row(temp, data, ref, data_size);
 
-   while(0U != data_size)
+   while(ptr < &temp[num_bytes_to_print])
    {
-      if((*data >= ' ') && (*data <= '~'))
-      {
-         *ptr = *data;
-      }
-      else
-      {
-         *ptr = '.';
-      }
+      *ptr = ' ';
       ptr++;
-      data++;
-      data_size--;
-   }
-   if(!allow_shorter_string)
-   {
-      while(ptr < &temp[num_bytes_to_print])
-      {
-         *ptr = ' ';
-         ptr++;
-      }
    }
    *ptr = '\0';
    (void)exe->print_string(exe->dev, temp);
-
-   return data;
 }/* IOCMD_print_ascii */
 #endif
 
 #if(IOCMD_SUPPORT_DATA_LOGGING)
+/**
+ * Prints data_size bytes of data which are part of bigger data (total_size) beginning from byte "offset".
+ */
 static void IOCMD_log_data(
-   char *temp, const IOCMD_Print_Exe_Params_XT *exe, IOCMD_standard_header_and_main_string_XT *header, const uint8_t *data, uint_fast16_t data_size)
+   char *temp, const IOCMD_Print_Exe_Params_XT *exe, IOCMD_standard_header_and_main_string_XT *header, const uint8_t *data,
+   uint_fast16_t offset, uint_fast16_t data_size, uint_fast16_t total_size)
 {
+   char *ptr;
    uint_fast16_t cntr;
    uint8_t asciicntr;
    uint8_t pos_marker_len;
 
-   if(data_size < 100U)
+   if(total_size < 100U)
    {
       pos_marker_len = 2U;
    }
-   else if(data_size < 1000U)
+   else if(total_size < 1000U)
    {
       pos_marker_len = 3U;
    }
-   else if(data_size < 10000U)
+   else if(total_size < 10000U)
    {
       pos_marker_len = 4U;
    }
@@ -1010,14 +3786,18 @@ static void IOCMD_log_data(
       }
 
       IOCMD_Oprintf(exe, "  %0*d-%0*d/%0*d: ",
-         pos_marker_len, cntr, pos_marker_len, cntr + asciicntr - 1U, pos_marker_len, data_size);
-
-      IOCMD_print_data(temp, exe, data, data_size - cntr, (8U * IOCMD_LOG_DATA_NUM_COLUMNS_TO_PRINT));
-
-      (void)exe->print_string(exe->dev, "-> ");
-
-      data = IOCMD_print_ascii(temp, exe, data, asciicntr, (8U * IOCMD_LOG_DATA_NUM_COLUMNS_TO_PRINT), IOCMD_TRUE);
+         pos_marker_len, offset + cntr, pos_marker_len, offset + cntr + asciicntr - 1U, pos_marker_len, total_size);
+
+      /* whole row is rendered to temp and printed by single call */
+      ptr = IOCMD_render_hex_row(temp, data, IOCMD_MAKE_INVALID_PTR(const uint8_t), asciicntr, (8U * IOCMD_LOG_DATA_NUM_COLUMNS_TO_PRINT));
+      ptr[0] = '-';
+      ptr[1] = '>';
+      ptr[2] = ' ';
+      ptr = IOCMD_render_ascii_row(&ptr[3], data, IOCMD_MAKE_INVALID_PTR(const uint8_t), asciicntr);
+      *ptr = '\0';
+      (void)exe->print_string(exe->dev, temp);
 
+      data += asciicntr;
       cntr += asciicntr;
 
       exe->print_endl_repeat(exe->dev, 1);
@@ -1026,20 +3806,8 @@ static void IOCMD_log_data(
 #endif
 
 #if(IOCMD_SUPPORT_DATA_COMPARISON)
-static void IOCMD_compare_data(
-   char *temp,
-   const IOCMD_Print_Exe_Params_XT *exe,
-   IOCMD_standard_header_and_main_string_XT *header,
-   const uint8_t *data1, const uint8_t *data2,
-   uint_fast16_t size1, uint_fast16_t size2)
+static uint8_t IOCMD_compare_data_pos_marker_len(uint_fast16_t data_size)
 {
-   char *ptr;
-   uint_fast16_t cntr;
-   uint_fast16_t cntr2;
-   uint_fast16_t data_size = (size1 > size2) ? size1 : size2;
-   uint8_t asciicntr;
-   uint8_t asciicntr1;
-   uint8_t asciicntr2;
    uint8_t pos_marker_len;
 
    if(data_size < 100U)
@@ -1059,140 +3827,408 @@ static void IOCMD_compare_data(
       pos_marker_len = 5U;
    }
 
-   for(cntr = 0U; cntr < data_size;)
-   {
-      IOCMD_print_main_cntr(exe, header, IOCMD_FALSE);
+   return pos_marker_len;
+} /* IOCMD_compare_data_pos_marker_len */
+
+static void IOCMD_compare_data_row(
+   char *temp,
+   const IOCMD_Print_Exe_Params_XT *exe,
+   IOCMD_standard_header_and_main_string_XT *header,
+   const uint8_t *data1, const uint8_t *data2,
+   uint_fast16_t cntr, uint_fast16_t size1, uint_fast16_t size2, uint8_t pos_marker_len)
+{
+   uint_fast16_t data_size = (size1 > size2) ? size1 : size2;
+   uint8_t asciicntr;
+   uint8_t asciicntr1;
+   uint8_t asciicntr2;
+
+   IOCMD_print_main_cntr(exe, header, IOCMD_FALSE);
+
+   asciicntr  = IOCMD_compare_data_row_size(cntr, data_size);
+   asciicntr1 = IOCMD_compare_data_row_size(cntr, size1);
+   asciicntr2 = IOCMD_compare_data_row_size(cntr, size2);
+
+   IOCMD_Oprintf(exe, "  %0*d-%0*d/%0*d: ",
+      pos_marker_len, cntr, pos_marker_len, cntr + asciicntr - 1U, pos_marker_len, data_size);
+
+   IOCMD_print_data(temp, exe, data1, IOCMD_MAKE_INVALID_PTR(const uint8_t), asciicntr1, (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT));
+
+#if(IOCMD_DATA_COMPARE_PRINT_BOTH_CONTEXTS)
+   (void)exe->print_string(exe->dev, "<-> ");
+
+   IOCMD_print_data(temp, exe, data2, IOCMD_MAKE_INVALID_PTR(const uint8_t), asciicntr2, (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT));
+
+#endif
+
+   /* differences are printed only for part which exists in both contexts */
+   asciicntr = (asciicntr1 > asciicntr2) ? asciicntr2 : asciicntr1;
+
+   (void)exe->print_string(exe->dev, "dif in 2: ");
+
+   IOCMD_print_data(temp, exe, data2, data1, asciicntr, (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT));
+
+   (void)exe->print_string(exe->dev, "-> ");
+
+   IOCMD_print_ascii(temp, exe, data1, IOCMD_MAKE_INVALID_PTR(const uint8_t), asciicntr1, (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT));
+
+#if(IOCMD_DATA_COMPARE_PRINT_BOTH_CONTEXTS)
+   (void)exe->print_string(exe->dev, " <-> ");
+
+   IOCMD_print_ascii(temp, exe, data2, IOCMD_MAKE_INVALID_PTR(const uint8_t), asciicntr2, (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT));
+
+#endif
+   (void)exe->print_string(exe->dev, " dif in 2: ");
+
+   IOCMD_print_ascii(temp, exe, data2, data1, asciicntr, 0U);
+
+   exe->print_endl_repeat(exe->dev, 1);
+} /* IOCMD_compare_data_row */
+
+static void IOCMD_compare_data(
+   char *temp,
+   const IOCMD_Print_Exe_Params_XT *exe,
+   IOCMD_standard_header_and_main_string_XT *header,
+   const uint8_t *data1, const uint8_t *data2,
+   uint_fast16_t size1, uint_fast16_t size2)
+{
+   uint_fast16_t cntr;
+   uint_fast16_t data_size = (size1 > size2) ? size1 : size2;
+   uint8_t pos_marker_len = IOCMD_compare_data_pos_marker_len(data_size);
+
+   for(cntr = 0U; cntr < data_size; cntr += 8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT)
+   {
+      IOCMD_compare_data_row(temp, exe, header, data1, data2, cntr, size1, size2, pos_marker_len);
+
+      data1 += 8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT;
+      data2 += 8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT;
+   }
+} /* IOCMD_compare_data */
+
+#if(IOCMD_LOG_DATA_COMPARE_DIFF_ONLY)
+/**
+ * Validates diff created by IOCMD_add_data_diff_to_buf and returns its size or 0 if diff is broken.
+ */
+static uint_fast16_t IOCMD_get_data_diff_size(const uint8_t *diff, uint_fast16_t diff_size, uint_fast16_t size1, uint_fast16_t size2)
+{
+   uint_fast16_t data_size = (size1 > size2) ? size1 : size2;
+   uint_fast16_t num_rows;
+   uint_fast16_t row;
+   uint_fast16_t next_row = 0U;
+   uint_fast16_t pos = 2U;
+   uint_fast16_t result = 0U;
+
+   if(diff_size >= 2U)
+   {
+      num_rows = (uint_fast16_t)(diff[0]) | IOCMD_MUL_BY_POWER_OF_2((uint_fast16_t)(diff[1]), 8);
+
+      for(; num_rows > 0U; num_rows--)
+      {
+         if((diff_size - pos) < 2U)
+         {
+            break;
+         }
+
+         row = (uint_fast16_t)(diff[pos]) | IOCMD_MUL_BY_POWER_OF_2((uint_fast16_t)(diff[pos + 1U]), 8);
+         pos += 2U;
+
+         /* rows are stored in increasing order and must be part of compared data */
+         if((row < next_row) || ((row * (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT)) >= data_size))
+         {
+            break;
+         }
+
+         pos += IOCMD_compare_data_row_size(row * (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT), size1);
+         pos += IOCMD_compare_data_row_size(row * (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT), size2);
+
+         if(pos > diff_size)
+         {
+            break;
+         }
+
+         next_row = row + 1U;
+      }
+
+      if(0U == num_rows)
+      {
+         result = pos;
+      }
+   }
+
+   return result;
+} /* IOCMD_get_data_diff_size */
+
+static void IOCMD_print_compare_data_equal(
+   const IOCMD_Print_Exe_Params_XT *exe,
+   IOCMD_standard_header_and_main_string_XT *header,
+   uint_fast16_t begin, uint_fast16_t end, uint_fast16_t data_size, uint8_t pos_marker_len)
+{
+   IOCMD_print_main_cntr(exe, header, IOCMD_FALSE);
+
+   IOCMD_Oprintf_Line(exe, "  %0*d-%0*d/%0*d: equal",
+      pos_marker_len, begin, pos_marker_len, end - 1U, pos_marker_len, data_size);
+} /* IOCMD_print_compare_data_equal */
+
+/**
+ * Prints comparison stored by IOCMD_add_data_diff_to_buf - rows which were not stored are reported as equal.
+ * Diff must be validated by IOCMD_get_data_diff_size before.
+ */
+static void IOCMD_compare_data_diff(
+   char *temp,
+   const IOCMD_Print_Exe_Params_XT *exe,
+   IOCMD_standard_header_and_main_string_XT *header,
+   const uint8_t *diff,
+   uint_fast16_t size1, uint_fast16_t size2)
+{
+   const uint8_t *data1;
+   const uint8_t *data2;
+   uint_fast16_t data_size = (size1 > size2) ? size1 : size2;
+   uint_fast16_t num_rows  = (uint_fast16_t)(diff[0]) | IOCMD_MUL_BY_POWER_OF_2((uint_fast16_t)(diff[1]), 8);
+   uint_fast16_t next_pos  = 0U;
+   uint_fast16_t pos       = 2U;
+   uint_fast16_t row_pos;
+   uint8_t pos_marker_len  = IOCMD_compare_data_pos_marker_len(data_size);
+
+   for(; num_rows > 0U; num_rows--)
+   {
+      row_pos = ((uint_fast16_t)(diff[pos]) | IOCMD_MUL_BY_POWER_OF_2((uint_fast16_t)(diff[pos + 1U]), 8))
+         * (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT);
+      pos += 2U;
+
+      if(row_pos > next_pos)
+      {
+         IOCMD_print_compare_data_equal(exe, header, next_pos, row_pos, data_size, pos_marker_len);
+      }
+
+      data1 = &diff[pos];
+      pos  += IOCMD_compare_data_row_size(row_pos, size1);
+      data2 = &diff[pos];
+      pos  += IOCMD_compare_data_row_size(row_pos, size2);
+
+      IOCMD_compare_data_row(temp, exe, header, data1, data2, row_pos, size1, size2, pos_marker_len);
+
+      next_pos = row_pos + (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT);
+   }
+
+   if(data_size > next_pos)
+   {
+      IOCMD_print_compare_data_equal(exe, header, next_pos, data_size, data_size, pos_marker_len);
+   }
+} /* IOCMD_compare_data_diff */
+#endif
+#endif
+
+static void IOCMD_print_log_main_string(
+   const IOCMD_Print_Exe_Params_XT           *exe,
+   IOCMD_standard_header_and_main_string_XT  *header,
+   IOCMD_Buffer_Convert_UT                   *convert,
+   const uint8_t                             *buf,
+   uint_fast16_t                              buf_size,
+   uint_fast16_t                              cntr)
+{
+   IOCMD_Param_Parsing_Result_XT parse;
+   uint_fast16_t format_pos;
+   uint_fast16_t len;
+   IOCMD_Bool_DT failed = IOCMD_FALSE;
+   IOCMD_Bool_DT ommit;
+
+   for(format_pos = 0U; format_pos < IOCMD_MAX_STRING_LENGTH; format_pos++)
+   {
+      if('%' == header->main_string[format_pos])
+      {
+         ommit = IOCMD_FALSE;
+
+         if(IOCMD_BOOL_IS_TRUE(IOCMD_Parse_Param(&(header->main_string[format_pos]), &parse)))
+         {
+            if(IOCMD_BOOL_IS_TRUE(parse.width_variadic) && IOCMD_BOOL_IS_FALSE(failed))
+            {
+               if(IOCMD_BOOL_IS_FALSE(IOCMD_get_int_param(convert, &cntr, buf, buf_size, header, IOCMD_TRUE)))
+               {
+                  failed = IOCMD_TRUE;
+               }
+               else
+               {
+                  parse.width = (IOCMD_String_Pos_DT)(convert->int_field.i);
+               }
+            }
+            if(IOCMD_BOOL_IS_TRUE(parse.precision_variadic) && IOCMD_BOOL_IS_FALSE(failed))
+            {
+               if(IOCMD_BOOL_IS_FALSE(IOCMD_get_int_param(convert, &cntr, buf, buf_size, header, IOCMD_TRUE)))
+               {
+                  failed = IOCMD_TRUE;
+               }
+               else
+               {
+                  parse.precision = (IOCMD_String_Pos_DT)(convert->int_field.i);
+               }
+            }
+
+            if(IOCMD_BOOL_IS_FALSE(failed))
+            {
+               memset(convert, 0, sizeof(*convert));
+
+               if('n' == parse.specifier)
+               {
+                  format_pos += parse.param_strlen;
+                  continue;
+               }
+               else if(IOCMD_BOOL_IS_TRUE(parse.length_available))
+               {
+                  if('i' == parse.length)
+                  {
+                     parse.length = sizeof(int) / sizeof(uint8_t);
+                     if(IOCMD_BOOL_IS_FALSE(IOCMD_get_int_param(
+                        convert, &cntr, buf, buf_size, header, IOCMD_LOG_IS_SIGNED_SPECIFIER(parse.specifier))))
+                     {
+                        failed = IOCMD_TRUE;
+                     }
+                  }
+                  else if('c' == parse.length)
+                  {
+                     parse.length = sizeof(char) / sizeof(uint8_t);
+
+#if(IOCMD_LOG_TYPED_ARGUMENTS)
+                     if(IOCMD_BOOL_IS_TRUE(header->typed_args))
+                     {
+                        /* character with captured type is stored as int */
+                        if(IOCMD_BOOL_IS_FALSE(IOCMD_get_int_param(convert, &cntr, buf, buf_size, header, IOCMD_TRUE)))
+                        {
+                           failed = IOCMD_TRUE;
+                        }
+                        convert->char_field.c = (char)(convert->int_field.i);
+                     }
+                     else
+#endif
+                     if(0xFFU == IOCMD_get_char(convert, buf, &cntr))
+                     {
+                        failed = IOCMD_TRUE;
+                     }
+                  }
+                  else if('s' == parse.length)
+                  {
+                     parse.length   = sizeof(IOCMD_Strptr) / sizeof(uint8_t);
+                     convert->ptr_field.ptr.string = IOCMD_get_string_ptr(convert, &cntr, buf, buf_size);
+                     if(!IOCMD_CHECK_PTR(const char, convert->ptr_field.ptr.string))
+                     {
+                        failed = IOCMD_TRUE;
+                     }
+                  }
+                  else if('p' == parse.length)
+                  {
+                     parse.length = sizeof(const void*) / sizeof(uint8_t);
+                     if(IOCMD_BOOL_IS_FALSE(IOCMD_get_int_param(convert, &cntr, buf, buf_size, header, IOCMD_FALSE)))
+                     {
+                        failed = IOCMD_TRUE;
+                     }
+                  }
+#if(IOCMD_OUT_SUPPORT_U64)
+                  else if((parse.length >= (sizeof(uint8_t) / sizeof(uint8_t)))
+                     && (parse.length <= (sizeof(uint64_t) / sizeof(uint8_t))))
+#else
+                  else if((parse.length >= (sizeof(uint8_t) / sizeof(uint8_t)))
+                     && (parse.length <= (sizeof(uint32_t) / sizeof(uint8_t))))
+#endif
+                  {
+                     if(IOCMD_BOOL_IS_FALSE(IOCMD_get_int_param(
+                        convert, &cntr, buf, buf_size, header, IOCMD_LOG_IS_SIGNED_SPECIFIER(parse.specifier))))
+                     {
+                        failed = IOCMD_TRUE;
+                     }
+                  }
+#if(!IOCMD_OUT_SUPPORT_U64)
+                  else if((parse.length > (sizeof(uint32_t) / sizeof(uint8_t)))
+                     && (parse.length <= (sizeof(uint64_t) / sizeof(uint8_t))))
+                  {
+                     ommit = IOCMD_TRUE;
+                  }
+#endif
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+                  else if(('f' == parse.length) || ('L' == parse.length))
+                  {
+                     parse.length = sizeof(double) / sizeof(uint8_t);
+                     if(IOCMD_BOOL_IS_FALSE(IOCMD_get_double(convert, &cntr, buf, buf_size)))
+                     {
+                        failed = IOCMD_TRUE;
+                     }
+                  }
+#else
+                  else if('f' == parse.length)
+                  {
+                     ommit = IOCMD_TRUE;
+                  }
+                  else if('L' == parse.length)
+                  {
+                     ommit = IOCMD_TRUE;
+                  }
+#endif
+               }
+
+               if(IOCMD_BOOL_IS_FALSE(failed) && IOCMD_BOOL_IS_FALSE(ommit))
+               {
+                  (void)IOCMD_Proc_Param(
+                     &parse,
+                     convert,
+                     exe);
+               }
+            }
 
-      if((data_size - cntr) >= (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT))
-      {
-         asciicntr = (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT);
-      }
-      else
-      {
-         asciicntr = data_size - cntr;
-      }
+            if(IOCMD_BOOL_IS_FALSE(failed) && IOCMD_BOOL_IS_FALSE(ommit))
+            {
+               format_pos += parse.param_strlen;
+            }
+            else
+            {
+               (void)exe->print_string(exe->dev, "%");
+               if('%' == header->main_string[format_pos + 1])
+               {
+                  (void)exe->print_string(exe->dev, "%");
+                  format_pos++;
+               }
+            }
 
-      if(size1 > cntr)
-      {
-         if((size1 - cntr) >= (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT))
-         {
-            asciicntr1 = (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT);
+            continue;
          }
          else
          {
-            asciicntr1 = size1 - cntr;
+            IOCMD_Oprintf(exe, "%% at %d, parse param FAILED\n", format_pos);
          }
       }
-      else
-      {
-         asciicntr1 = 0U;
-      }
-
-      if(size2 > cntr)
+      else if('\0' == header->main_string[format_pos])
       {
-         if((size2 - cntr) >= (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT))
-         {
-            asciicntr2 = (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT);
-         }
-         else
-         {
-            asciicntr2 = size2 - cntr;
-         }
+         exe->print_endl_repeat(exe->dev, 1);
+         break;
       }
-      else
+      else if('\n' == header->main_string[format_pos])
       {
-         asciicntr2 = 0U;
+         exe->print_endl_repeat(exe->dev, 1);
       }
-
-      IOCMD_Oprintf(exe, "  %0*d-%0*d/%0*d: ",
-         pos_marker_len, cntr, pos_marker_len, cntr + asciicntr - 1U, pos_marker_len, data_size);
-
-      IOCMD_print_data(temp, exe, data1, asciicntr1, (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT));
-
-#if(IOCMD_DATA_COMPARE_PRINT_BOTH_CONTEXTS)
-      (void)exe->print_string(exe->dev, "<-> ");
-
-      IOCMD_print_data(temp, exe, data2, asciicntr2, (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT));
-
-#endif
-
-      (void)exe->print_string(exe->dev, "dif in 2: ");
-
-      for(cntr2 = 0U; cntr2 < (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT); cntr2 += 8U)
+      else if('\r' == header->main_string[format_pos])
       {
-         if((asciicntr1 > cntr2) && (asciicntr2 > cntr2))
-         {
-            (void)IOCMD_debug_format_dif8(temp, &data1[cntr2], size1 - (cntr2 + cntr), &data2[cntr2], size2 - (cntr2 + cntr));
-            (void)exe->print_string(exe->dev, temp);
-         }
-         else
-         {
-            (void)exe->print_string_repeat(exe->dev, " ", 25);
-         }
+         /* do nothing */
       }
-
-      (void)exe->print_string(exe->dev, "-> ");
-      cntr += asciicntr;
-
-      asciicntr = (asciicntr1 > asciicntr2) ? asciicntr2 : asciicntr1;
-
-      (void)IOCMD_print_ascii(temp, exe, data1, asciicntr1, (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT), IOCMD_FALSE);
-
-#if(IOCMD_DATA_COMPARE_PRINT_BOTH_CONTEXTS)
-      (void)exe->print_string(exe->dev, " <-> ");
-
-      (void)IOCMD_print_ascii(temp, exe, data2, asciicntr2, (8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT), IOCMD_FALSE);
-
-#endif
-      (void)exe->print_string(exe->dev, " dif in 2: ");
-
-      ptr = temp;
-
-      temp[8 * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT] = '\0';
-      cntr2 = 0;
-      asciicntr1 = asciicntr;
-      while(0 != asciicntr)
+      else
       {
-         if(data1[cntr2] != data2[cntr2])
+         for(len = 0U; (len + format_pos) < IOCMD_MAX_STRING_LENGTH ; ++len)
          {
-            if((data2[cntr2] >= ' ') && (data2[cntr2] <= '~'))
-            {
-               if('=' != data2[cntr2])
-               {
-                  *ptr = data2[cntr2];
-               }
-               else
-               {
-                  *ptr = '.';
-               }
-            }
-            else
+            if(('%' == header->main_string[len + format_pos])
+               || ('\0' == header->main_string[len + format_pos])
+               || ('\n' == header->main_string[len + format_pos])
+               || ('\r' == header->main_string[len + format_pos]))
             {
-               *ptr = '.';
+               break;
             }
          }
-         else
-         {
-            *ptr = '=';
-         }
-         ptr++;
-         cntr2++;
-         asciicntr--;
+
+         (void)exe->print_string_len(exe->dev, &(header->main_string[format_pos]), len);
+
+         format_pos += len - 1U;
       }
-      data1 += 8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT;
-      data2 += 8U * IOCMD_COMPARE_DATA_NUM_COLUMNS_TO_PRINT;
-      *ptr = '\0';
-      (void)exe->print_string(exe->dev, temp);
-      exe->print_endl_repeat(exe->dev, 1);
    }
-} /* IOCMD_compare_data */
-#endif
+} /* IOCMD_print_log_main_string */
 
 static void IOCMD_proc_one_buffered_log(
    const uint8_t *buf, uint_fast16_t buf_size, IOCMD_Bool_DT is_quiet_log, const IOCMD_Print_Exe_Params_XT *exe)
 {
    IOCMD_standard_header_and_main_string_XT header;
-   IOCMD_Param_Parsing_Result_XT parse;
    IOCMD_Buffer_Convert_UT convert;
    const char    *level = "";
 #if (IOCMD_LOG_PRINT_OS_CONTEXT && IOCMD_LOG_PRINT_OS_CONTEXT_NAME)
@@ -1210,6 +4246,10 @@ static void IOCMD_proc_one_buffered_log(
 #if(IOCMD_SUPPORT_DATA_COMPARISON)
    uint_fast16_t size2 = 0U;
 #endif
+#if(IOCMD_LOG_DATA_COMPARE_DIFF_ONLY)
+   uint_fast16_t diff_size;
+   IOCMD_Bool_DT data_diff = IOCMD_FALSE;
+#endif
 #if (IOCMD_LOG_PRINT_OS_CONTEXT)
 #if (IOCMD_LOG_PRINT_OS_CONTEXT_NAME)
    uint_fast16_t context_name_len;
@@ -1219,8 +4259,6 @@ static void IOCMD_proc_one_buffered_log(
    IOCMD_Context_ID_DT current_context;
 #endif
 #endif
-   uint_fast16_t format_pos;
-   uint_fast16_t len;
    uint_fast16_t cntr;
 #if(IOCMD_SUPPORT_DATA_COMPARISON || IOCMD_SUPPORT_DATA_LOGGING)
    uint8_t data_too_big1 = 0U;
@@ -1230,9 +4268,18 @@ static void IOCMD_proc_one_buffered_log(
 #endif
 #if(IOCMD_SUPPORT_DATA_COMPARISON || IOCMD_SUPPORT_DATA_LOGGING)
    char temp[IOCMD_PROC_ONE_BUFFERED_LOG_TEMP_BUF_SIZE];
+#endif
+#if(IOCMD_LOG_DATA_COMPRESSION)
+   uint8_t unpacked[IOCMD_MAX_LOG__DATA_1_LENGTH];
+#endif
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+   uint_fast16_t fragment_offset = 0U;
+   uint_fast16_t fragment_total  = 0U;
 #endif
    IOCMD_Bool_DT failed = IOCMD_FALSE;
-   IOCMD_Bool_DT ommit;
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+   IOCMD_Bool_DT call_site = IOCMD_FALSE;
+#endif
 
    /* ommit global_cntr - we don't use it in this function */
 #if (1 == IOCMD_LOG_GLOBAL_CNTR_SIZE)
@@ -1249,13 +4296,33 @@ static void IOCMD_proc_one_buffered_log(
 
    IOCMD_Oprintf(exe, IOCMD_CARIAGE_RETURN);
 
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+   if((IOCMD_LOG_CALL_SITE == header.level)
+      && (buf_size >= (cntr + IOCMD_LOG_HEADER_CONTEXT_PART_SIZE/* context num + context type */ + 2U/*call site index*/)))
+   {
+      cntr += IOCMD_get_call_site_header_from_buf(&header, &buf[cntr]);
+      call_site = IOCMD_TRUE;
+   }
+#endif
+
    if( ( (header.level <= IOCMD_LOG_LEVEL_EXT_EXIT)
          || ((header.level >= IOCMD_LOG_DATA_PRINT_CONTEXT_BEGIN) && (header.level <= IOCMD_LOG_DATA_COMPARE_CONTEXT_END)) )
-      && (buf_size >= (IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_HEADER_TIME_PART_SIZE \
+      && (
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+         IOCMD_BOOL_IS_TRUE(call_site) ||
+#endif
+         (buf_size >= (IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_HEADER_TIME_PART_SIZE \
          + 1U/*level*/ + 2U/*line num*/ + IOCMD_LOG_HEADER_CONTEXT_PART_SIZE/* context num + context type */
-         + 1U/*filename type*/ + 1U/* minimal filename */ + 1U/*format type*/ + 1U/* minimal format */)) )
+         + 1U/*filename type*/ + 1U/* minimal filename */ + 1U/*format type*/ + 1U/* minimal format */))) )
    {
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+      if(IOCMD_BOOL_IS_FALSE(call_site))
+      {
+         cntr += IOCMD_get_rest_of_log_header_and_main_string_from_buf(&convert, &header, &buf[cntr], buf_size - cntr);
+      }
+#else
       cntr += IOCMD_get_rest_of_log_header_and_main_string_from_buf(&convert, &header, &buf[cntr], buf_size - cntr);
+#endif
 
 #if(IOCMD_SUPPORT_DATA_COMPARISON || IOCMD_SUPPORT_DATA_LOGGING)
       /* for data log and data comparision data1 is always placed after main string */
@@ -1274,7 +4341,56 @@ static void IOCMD_proc_one_buffered_log(
             {
                size1 = (uint_fast16_t)(convert.int_field.i);
 
-               data1 = IOCMD_get_tab_ptr(&convert, &cntr, buf, buf_size, size1);
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+               fragment_total = size1;
+
+               /* fragment of data log - offset of the fragment and size of whole data follow size of the fragment */
+               if(0U != (data_too_big1 & IOCMD_LOG_DATA_FLAG_FRAGMENT))
+               {
+                  data_too_big1 &= (uint8_t)(~IOCMD_LOG_DATA_FLAG_FRAGMENT);
+
+                  if(IOCMD_BOOL_IS_FALSE(IOCMD_get_u64(&convert, &cntr, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_1BYTE)))
+                  {
+                     failed = IOCMD_TRUE;
+                  }
+                  else
+                  {
+                     fragment_offset = (uint_fast16_t)(convert.int_field.i);
+
+                     if(IOCMD_BOOL_IS_FALSE(IOCMD_get_u64(&convert, &cntr, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_1BYTE))
+                        || ((uint_fast16_t)(convert.int_field.i) < (fragment_offset + size1)))
+                     {
+                        failed = IOCMD_TRUE;
+                     }
+                     else
+                     {
+                        fragment_total = (uint_fast16_t)(convert.int_field.i);
+                     }
+                  }
+               }
+#endif
+
+#if(IOCMD_LOG_DATA_COMPRESSION)
+               if((buf_size > cntr) && (IOCMD_LOG_BUF_DATA_TYPE_PACKED == buf[cntr]) && (size1 <= sizeof(unpacked)))
+               {
+                  data1 = IOCMD_get_packed_tab_ptr(&convert, &cntr, buf, buf_size, unpacked, size1);
+               }
+               else
+#endif
+#if(IOCMD_LOG_DATA_COMPARE_DIFF_ONLY)
+               /* data1 is stored together with data2 as diff; it is placed in data2 table */
+               if((buf_size > cntr) && (IOCMD_LOG_BUF_DATA_TYPE_DIFF == buf[cntr])
+                  && (header.level >= IOCMD_LOG_DATA_COMPARE_CONTEXT_BEGIN))
+               {
+                  cntr++;
+                  data1     = &buf[cntr];
+                  data_diff = IOCMD_TRUE;
+               }
+               else
+#endif
+               {
+                  data1 = IOCMD_get_tab_ptr(&convert, &cntr, buf, buf_size, size1);
+               }
 
                if(!IOCMD_CHECK_PTR(const uint8_t, data1))
                {
@@ -1308,7 +4424,28 @@ static void IOCMD_proc_one_buffered_log(
             {
                size2 = (uint_fast16_t)(convert.int_field.i);
 
-               data2 = IOCMD_get_tab_ptr(&convert, &cntr, buf, buf_size, size2);
+#if(IOCMD_LOG_DATA_COMPARE_DIFF_ONLY)
+               if(IOCMD_BOOL_IS_TRUE(data_diff))
+               {
+                  data2 = IOCMD_MAKE_INVALID_PTR(const uint8_t);
+
+                  if((buf_size > cntr) && (IOCMD_LOG_BUF_DATA_TYPE_DIFF == buf[cntr]))
+                  {
+                     cntr++;
+                     diff_size = IOCMD_get_data_diff_size(&buf[cntr], buf_size - cntr, size1, size2);
+
+                     if(diff_size > 0U)
+                     {
+                        data2 = &buf[cntr];
+                        cntr += diff_size;
+                     }
+                  }
+               }
+               else
+#endif
+               {
+                  data2 = IOCMD_get_tab_ptr(&convert, &cntr, buf, buf_size, size2);
+               }
 
                if(!IOCMD_CHECK_PTR(const uint8_t, data2))
                {
@@ -1340,6 +4477,11 @@ static void IOCMD_proc_one_buffered_log(
             level = IOCMD_level_strings[header.level - IOCMD_LOG_DATA_COMPARE_CONTEXT_BEGIN];
          }
 
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+         /* next fragments of data log contain only data - log line was printed with the first one */
+         if(0U == fragment_offset)
+         {
+#endif
          IOCMD_print_main_cntr(exe, &header, is_quiet_log);
 
 #if (IOCMD_LOG_PRINT_OS_CONTEXT && IOCMD_LOG_PRINT_OS_CONTEXT_NAME)
@@ -1351,9 +4493,12 @@ static void IOCMD_proc_one_buffered_log(
          }
 #endif
 
+#if (IOCMD_LOG_HIGH_RES_TIME)
+         IOCMD_print_time(exe, header.time);
+#endif
          IOCMD_Oprintf(exe,
             " "
-#if (IOCMD_LOG_PRINT_TIME)
+#if (IOCMD_LOG_PRINT_TIME && (!IOCMD_LOG_HIGH_RES_TIME))
             "[%7u] "
 #endif
 #if (IOCMD_LOG_PRINT_OS_CONTEXT)
@@ -1364,7 +4509,7 @@ static void IOCMD_proc_one_buffered_log(
             " "
 #endif
             "%*s:%-5u; %9s:: ",
-#if (IOCMD_LOG_PRINT_TIME)
+#if (IOCMD_LOG_PRINT_TIME && (!IOCMD_LOG_HIGH_RES_TIME))
             header.time,
 #endif
 #if (IOCMD_LOG_PRINT_OS_CONTEXT)
@@ -1377,197 +4522,38 @@ static void IOCMD_proc_one_buffered_log(
 #endif
 #if (IOCMD_LOG_PRINT_OS_CONTEXT && IOCMD_LOG_PRINT_OS_CONTEXT_NAME)
             IOCMD_MAX_FILE_NAME_SIZE + 16U - context_name_len,
-#else
-            IOCMD_MAX_FILE_NAME_SIZE,
-#endif
-            IOCMD_file_name_remove_path(header.file),
-            header.line,
-            level);
-
-#if(IOCMD_SUPPORT_ENTRANCE_LOGGING)
-         if((header.level >= IOCMD_LOG_LEVEL_EXT_ENTER) && (header.level <= IOCMD_LOG_LEVEL_EXT_EXIT))
-         {
-            (void)exe->print_string_len(exe->dev, header.main_string, IOCMD_MAX_LOG_LENGTH);
-            exe->print_endl_repeat(exe->dev, 1);
-         }
-         else
-#endif
-         {
-            for(format_pos = 0U; format_pos < IOCMD_MAX_STRING_LENGTH; format_pos++)
-            {
-               if('%' == header.main_string[format_pos])
-               {
-                  ommit = IOCMD_FALSE;
-
-                  if(IOCMD_BOOL_IS_TRUE(IOCMD_Parse_Param(&(header.main_string[format_pos]), &parse)))
-                  {
-                     if(IOCMD_BOOL_IS_TRUE(parse.width_variadic) && IOCMD_BOOL_IS_FALSE(failed))
-                     {
-                        if(IOCMD_BOOL_IS_FALSE(IOCMD_get_u64(&convert, &cntr, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_1BYTE)))
-                        {
-                           failed = IOCMD_TRUE;
-                        }
-                        else
-                        {
-                           parse.width = (IOCMD_String_Pos_DT)(convert.int_field.i);
-                        }
-                     }
-                     if(IOCMD_BOOL_IS_TRUE(parse.precision_variadic) && IOCMD_BOOL_IS_FALSE(failed))
-                     {
-                        if(IOCMD_BOOL_IS_FALSE(IOCMD_get_u64(&convert, &cntr, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_1BYTE)))
-                        {
-                           failed = IOCMD_TRUE;
-                        }
-                        else
-                        {
-                           parse.precision = (IOCMD_String_Pos_DT)(convert.int_field.i);
-                        }
-                     }
-
-                     if(IOCMD_BOOL_IS_FALSE(failed))
-                     {
-                        memset(&convert, 0, sizeof(convert));
-
-                        if('n' == parse.specifier)
-                        {
-                           format_pos += parse.param_strlen;
-                           continue;
-                        }
-                        else if(IOCMD_BOOL_IS_TRUE(parse.length_available))
-                        {
-                           if('i' == parse.length)
-                           {
-                              parse.length = sizeof(int) / sizeof(uint8_t);
-                              if(IOCMD_BOOL_IS_FALSE(IOCMD_get_u64(&convert, &cntr, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_1BYTE)))
-                              {
-                                 failed = IOCMD_TRUE;
-                              }
-                           }
-                           else if('c' == parse.length)
-                           {
-                              parse.length = sizeof(char) / sizeof(uint8_t);
-
-                              if(0xFFU == IOCMD_get_char(&convert, buf, &cntr))
-                              {
-                                 failed = IOCMD_TRUE;
-                              }
-                           }
-                           else if('s' == parse.length)
-                           {
-                              parse.length   = sizeof(IOCMD_Strptr) / sizeof(uint8_t);
-                              convert.ptr_field.ptr.string = IOCMD_get_string_ptr(&convert, &cntr, buf, buf_size);
-                              if(!IOCMD_CHECK_PTR(const char, convert.ptr_field.ptr.string))
-                              {
-                                 failed = IOCMD_TRUE;
-                              }
-                           }
-                           else if('p' == parse.length)
-                           {
-                              parse.length = sizeof(const void*) / sizeof(uint8_t);
-                              if(IOCMD_BOOL_IS_FALSE(IOCMD_get_u64(&convert, &cntr, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_1BYTE)))
-                              {
-                                 failed = IOCMD_TRUE;
-                              }
-                           }
-#if(IOCMD_OUT_SUPPORT_U64)
-                           else if((parse.length >= (sizeof(uint8_t) / sizeof(uint8_t)))
-                              && (parse.length <= (sizeof(uint64_t) / sizeof(uint8_t))))
-#else
-                           else if((parse.length >= (sizeof(uint8_t) / sizeof(uint8_t)))
-                              && (parse.length <= (sizeof(uint32_t) / sizeof(uint8_t))))
-#endif
-                           {
-                              if(IOCMD_BOOL_IS_FALSE(IOCMD_get_u64(&convert, &cntr, buf, buf_size, IOCMD_LOG_BUF_DATA_TYPE_1BYTE)))
-                              {
-                                 failed = IOCMD_TRUE;
-                              }
-                           }
-#if(!IOCMD_OUT_SUPPORT_U64)
-                           else if((parse.length > (sizeof(uint32_t) / sizeof(uint8_t)))
-                              && (parse.length <= (sizeof(uint64_t) / sizeof(uint8_t))))
-                           {
-                              ommit = IOCMD_TRUE;
-                           }
-#endif
-                           else if('f' == parse.length)
-                           {
-                              ommit = IOCMD_TRUE;
-                           }
-                           else if('L' == parse.length)
-                           {
-                              ommit = IOCMD_TRUE;
-                           }
-                        }
-
-                        if(IOCMD_BOOL_IS_FALSE(failed) && IOCMD_BOOL_IS_FALSE(ommit))
-                        {
-                           (void)IOCMD_Proc_Param(
-                              &parse,
-                              &convert,
-                              exe);
-                        }
-                     }
-
-                     if(IOCMD_BOOL_IS_FALSE(failed) && IOCMD_BOOL_IS_FALSE(ommit))
-                     {
-                        format_pos += parse.param_strlen;
-                     }
-                     else
-                     {
-                        (void)exe->print_string(exe->dev, "%");
-                        if('%' == header.main_string[format_pos + 1])
-                        {
-                           (void)exe->print_string(exe->dev, "%");
-                           format_pos++;
-                        }
-                     }
-
-                     continue;
-                  }
-                  else
-                  {
-                     IOCMD_Oprintf(exe, "%% at %d, parse param FAILED\n", format_pos);
-                  }
-               }
-               else if('\0' == header.main_string[format_pos])
-               {
-                  exe->print_endl_repeat(exe->dev, 1);
-                  break;
-               }
-               else if('\n' == header.main_string[format_pos])
-               {
-                  exe->print_endl_repeat(exe->dev, 1);
-               }
-               else if('\r' == header.main_string[format_pos])
-               {
-                  /* do nothing */
-               }
-               else
-               {
-                  for(len = 0U; (len + format_pos) < IOCMD_MAX_STRING_LENGTH ; ++len)
-                  {
-                     if(('%' == header.main_string[len + format_pos])
-                        || ('\0' == header.main_string[len + format_pos])
-                        || ('\n' == header.main_string[len + format_pos])
-                        || ('\r' == header.main_string[len + format_pos]))
-                     {
-                        break;
-                     }
-                  }
-
-                  (void)exe->print_string_len(exe->dev, &(header.main_string[format_pos]), len);
+#else
+            IOCMD_MAX_FILE_NAME_SIZE,
+#endif
+            IOCMD_file_name_remove_path(header.file),
+            header.line,
+            level);
 
-                  format_pos += len - 1U;
-               }
-            }
+#if(IOCMD_SUPPORT_ENTRANCE_LOGGING)
+         if((header.level >= IOCMD_LOG_LEVEL_EXT_ENTER) && (header.level <= IOCMD_LOG_LEVEL_EXT_EXIT))
+         {
+            (void)exe->print_string_len(exe->dev, header.main_string, IOCMD_MAX_LOG_LENGTH);
+            exe->print_endl_repeat(exe->dev, 1);
+         }
+         else
+#endif
+         {
+            IOCMD_print_log_main_string(exe, &header, &convert, buf, buf_size, cntr);
+         }
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
          }
+#endif
 
 #if(IOCMD_SUPPORT_DATA_LOGGING)
          /* print data context - specific section for data logs */
          if((header.level >= IOCMD_LOG_DATA_PRINT_CONTEXT_BEGIN) && (header.level <= IOCMD_LOG_DATA_PRINT_CONTEXT_END))
          {
             header.level -= IOCMD_LOG_DATA_PRINT_CONTEXT_BEGIN;
-            IOCMD_log_data(temp, exe, &header, data1, size1);
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+            IOCMD_log_data(temp, exe, &header, data1, fragment_offset, size1, fragment_total);
+#else
+            IOCMD_log_data(temp, exe, &header, data1, 0U, size1, size1);
+#endif
             if(0U != data_too_big1)
             {
                IOCMD_print_main_cntr(exe, &header, IOCMD_FALSE);
@@ -1582,7 +4568,16 @@ static void IOCMD_proc_one_buffered_log(
          if((header.level >= IOCMD_LOG_DATA_COMPARE_CONTEXT_BEGIN) && (header.level <= IOCMD_LOG_DATA_COMPARE_CONTEXT_END))
          {
             header.level -= IOCMD_LOG_DATA_COMPARE_CONTEXT_BEGIN;
-            IOCMD_compare_data(temp, exe, &header, data1, data2, size1, size2);
+#if(IOCMD_LOG_DATA_COMPARE_DIFF_ONLY)
+            if(IOCMD_BOOL_IS_TRUE(data_diff))
+            {
+               IOCMD_compare_data_diff(temp, exe, &header, data2, size1, size2);
+            }
+            else
+#endif
+            {
+               IOCMD_compare_data(temp, exe, &header, data1, data2, size1, size2);
+            }
             if((0U != data_too_big1) || (0U != data_too_big2))
             {
                IOCMD_print_main_cntr(exe, &header, IOCMD_FALSE);
@@ -1612,9 +4607,12 @@ static void IOCMD_proc_one_buffered_log(
 
       IOCMD_print_main_cntr(exe, &header, is_quiet_log);
 
+#if (IOCMD_LOG_HIGH_RES_TIME)
+      IOCMD_print_time(exe, header.time);
+#endif
       IOCMD_Oprintf_Line(exe,
          " "
-#if (IOCMD_LOG_PRINT_TIME)
+#if (IOCMD_LOG_PRINT_TIME && (!IOCMD_LOG_HIGH_RES_TIME))
          "[%7d] "
 #endif
          "%s:%4d"
@@ -1626,7 +4624,7 @@ static void IOCMD_proc_one_buffered_log(
          "(%.*s)"
 #endif
          ,
-#if (IOCMD_LOG_PRINT_TIME)
+#if (IOCMD_LOG_PRINT_TIME && (!IOCMD_LOG_HIGH_RES_TIME))
          header.time,
 #endif
          IOCMD_OS_GET_CONTEXT_TYPE_NAME(IOCMD_OS_CONTEXT_TYPE_THREAD),
@@ -1653,6 +4651,260 @@ static void IOCMD_proc_one_buffered_log(
 } /* IOCMD_proc_one_buffered_log */
 
 
+#if(IOCMD_LOG_TRACE_EXPORT)
+static int IOCMD_trace_escape(IOCMD_Trace_Escape_XT *escape, const char *string, int str_len)
+{
+   const IOCMD_Print_Exe_Params_XT *out = escape->out;
+   int pos;
+   int run = 0;
+   uint8_t c;
+
+   if((str_len > 0) && ('\0' != string[0]))
+   {
+      while(escape->pending_endl > 0)
+      {
+         (void)out->print_string(out->dev, "\\n");
+         escape->pending_endl--;
+      }
+   }
+
+   for(pos = 0; (pos < str_len) && ('\0' != string[pos]); pos++)
+   {
+      c = (uint8_t)string[pos];
+
+      if(('"' == c) || ('\\' == c) || (c < 0x20U))
+      {
+         if(run > 0)
+         {
+            (void)out->print_string_len(out->dev, &string[pos - run], run);
+            run = 0;
+         }
+
+         if('"' == c)
+         {
+            (void)out->print_string(out->dev, "\\\"");
+         }
+         else if('\\' == c)
+         {
+            (void)out->print_string(out->dev, "\\\\");
+         }
+         else if('\t' == c)
+         {
+            (void)out->print_string(out->dev, "\\t");
+         }
+         else if('\n' == c)
+         {
+            (void)out->print_string(out->dev, "\\n");
+         }
+         else if('\r' != c)
+         {
+            IOCMD_Oprintf(out, "\\u%04X", c);
+         }
+      }
+      else
+      {
+         run++;
+      }
+   }
+
+   if(run > 0)
+   {
+      (void)out->print_string_len(out->dev, &string[pos - run], run);
+   }
+
+   return pos;
+} /* IOCMD_trace_escape */
+
+static int IOCMD_trace_escape_print_text(void *dev, const char *string)
+{
+   return IOCMD_trace_escape((IOCMD_Trace_Escape_XT*)dev, string, IOCMD_MAX_STRING_LENGTH);
+} /* IOCMD_trace_escape_print_text */
+
+static int IOCMD_trace_escape_print_text_repeat(void *dev, const char *string, int num_repeats)
+{
+   int result = 0;
+
+   while(num_repeats > 0)
+   {
+      result += IOCMD_trace_escape((IOCMD_Trace_Escape_XT*)dev, string, IOCMD_MAX_STRING_LENGTH);
+      num_repeats--;
+   }
+
+   return result;
+} /* IOCMD_trace_escape_print_text_repeat */
+
+static int IOCMD_trace_escape_print_text_len(void *dev, const char *string, int str_len)
+{
+   return IOCMD_trace_escape((IOCMD_Trace_Escape_XT*)dev, string, (str_len > 0) ? str_len : IOCMD_MAX_STRING_LENGTH);
+} /* IOCMD_trace_escape_print_text_len */
+
+static void IOCMD_trace_escape_print_endline_repeat(void *dev, int num_repeats)
+{
+   if(num_repeats > 0)
+   {
+      ((IOCMD_Trace_Escape_XT*)dev)->pending_endl += num_repeats;
+   }
+} /* IOCMD_trace_escape_print_endline_repeat */
+
+static void IOCMD_trace_escape_print_cariage_return(void *dev)
+{
+   IOCMD_UNUSED_PARAM(dev);
+} /* IOCMD_trace_escape_print_cariage_return */
+
+static void IOCMD_trace_escape_init(IOCMD_Trace_Escape_XT *escape, const IOCMD_Print_Exe_Params_XT *out)
+{
+   escape->exe.dev                  = escape;
+   escape->exe.print_string         = IOCMD_trace_escape_print_text;
+   escape->exe.print_string_repeat  = IOCMD_trace_escape_print_text_repeat;
+   escape->exe.print_string_len     = IOCMD_trace_escape_print_text_len;
+   escape->exe.print_endl_repeat    = IOCMD_trace_escape_print_endline_repeat;
+   escape->exe.print_cariage_return = IOCMD_trace_escape_print_cariage_return;
+   escape->exe.refresh_line         = IOCMD_MAKE_INVALID_HANDLER(IOCMD_Refresh_Line_After_Log);
+   escape->out                      = out;
+   escape->pending_endl             = 0;
+} /* IOCMD_trace_escape_init */
+
+static void IOCMD_trace_print_event_begin(
+   const IOCMD_Print_Exe_Params_XT *exe, const char *phase, IOCMD_Time_DT time, unsigned pid, unsigned tid)
+{
+#if(IOCMD_LOG_HIGH_RES_TIME)
+   uint64_t ns = IOCMD_time_since_start_ns(time);
+
+   /* trace timestamps are in microseconds */
+   IOCMD_Oprintf(exe, "{\"ph\":\"%s\",\"ts\":%llu.%03u,\"pid\":%u,\"tid\":%u,",
+      phase, (unsigned long long)(ns / 1000U), (unsigned)(ns % 1000U), pid, tid);
+#else
+   /* IOCMD_OS_GET_CURRENT_TIME returns miliseconds, trace timestamps are in microseconds */
+   IOCMD_Oprintf(exe, "{\"ph\":\"%s\",\"ts\":%llu,\"pid\":%u,\"tid\":%u,",
+      phase, (unsigned long long)time * 1000U, pid, tid);
+#endif
+} /* IOCMD_trace_print_event_begin */
+
+static void IOCMD_proc_one_trace_log(const uint8_t *buf, uint_fast16_t buf_size, const IOCMD_Print_Exe_Params_XT *exe)
+{
+   IOCMD_standard_header_and_main_string_XT header;
+   IOCMD_Buffer_Convert_UT convert;
+   IOCMD_Trace_Escape_XT escape;
+#if(IOCMD_LOG_PRINT_OS_CONTEXT && IOCMD_LOGS_TREE_OS_LOG_CONTEXT_SWITCH)
+   IOCMD_Context_ID_DT previous_context;
+   IOCMD_Context_ID_DT current_context;
+#endif
+   unsigned pid = 0U;
+   unsigned tid = 0U;
+   uint_fast16_t cntr;
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+   IOCMD_Bool_DT call_site = IOCMD_FALSE;
+#endif
+
+   /* ommit global_cntr - we don't use it in this function */
+#if (1 == IOCMD_LOG_GLOBAL_CNTR_SIZE)
+   cntr = 1U;
+#elif (2 == IOCMD_LOG_GLOBAL_CNTR_SIZE)
+   cntr = 2U;
+#else
+   cntr = 4U;
+#endif
+
+   memset(&header, 0, sizeof(header));
+
+   cntr += IOCMD_get_log_header_main_cntr_time_and_level_from_buf(&header, &buf[cntr]);
+
+   IOCMD_trace_escape_init(&escape, exe);
+
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+   if((IOCMD_LOG_CALL_SITE == header.level)
+      && (buf_size >= (cntr + IOCMD_LOG_HEADER_CONTEXT_PART_SIZE/* context num + context type */ + 2U/*call site index*/)))
+   {
+      cntr += IOCMD_get_call_site_header_from_buf(&header, &buf[cntr]);
+      call_site = IOCMD_TRUE;
+   }
+#endif
+
+   /* data logs and data comparisions are not exported - only entrances, logs and context switches */
+   if( (header.level <= IOCMD_LOG_LEVEL_EXT_EXIT)
+      && (
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+         IOCMD_BOOL_IS_TRUE(call_site) ||
+#endif
+         (buf_size >= (IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_HEADER_TIME_PART_SIZE \
+         + 1U/*level*/ + 2U/*line num*/ + IOCMD_LOG_HEADER_CONTEXT_PART_SIZE/* context num + context type */
+         + 1U/*filename type*/ + 1U/* minimal filename */ + 1U/*format type*/ + 1U/* minimal format */))) )
+   {
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+      if(IOCMD_BOOL_IS_FALSE(call_site))
+      {
+         cntr += IOCMD_get_rest_of_log_header_and_main_string_from_buf(&convert, &header, &buf[cntr], buf_size - cntr);
+      }
+#else
+      cntr += IOCMD_get_rest_of_log_header_and_main_string_from_buf(&convert, &header, &buf[cntr], buf_size - cntr);
+#endif
+
+      if(IOCMD_CHECK_PTR(const char, header.main_string))
+      {
+#if (IOCMD_LOG_PRINT_OS_CONTEXT)
+         /* every context type is separate process in the trace, every context is its thread */
+         pid = (unsigned)header.context_type;
+         tid = (unsigned)IOCMD_OS_GET_CONTEXT_NUMBER(header.context_type, header.context_id);
+#endif
+
+#if(IOCMD_SUPPORT_ENTRANCE_LOGGING)
+         if((header.level >= IOCMD_LOG_LEVEL_EXT_ENTER) && (header.level <= IOCMD_LOG_LEVEL_EXT_EXIT))
+         {
+            /* entrances are begin and end of slices named by function */
+            IOCMD_trace_print_event_begin(
+               exe, (IOCMD_LOG_LEVEL_EXT_ENTER == header.level) ? "B" : "E", header.time, pid, tid);
+            (void)exe->print_string(exe->dev, "\"cat\":\"function\",\"name\":\"");
+            (void)escape.exe.print_string_len(escape.exe.dev, header.main_string, IOCMD_MAX_LOG_LENGTH);
+            (void)exe->print_string(exe->dev, "\"");
+         }
+         else
+#endif
+         {
+            /* logs are instant events of the thread named by log level */
+            IOCMD_trace_print_event_begin(exe, "i", header.time, pid, tid);
+            IOCMD_Oprintf(exe, "\"s\":\"t\",\"cat\":\"log\",\"name\":\"%s\",\"args\":{\"msg\":\"", IOCMD_level_strings[header.level]);
+            IOCMD_print_log_main_string(&(escape.exe), &header, &convert, buf, buf_size, cntr);
+            /* end of line which ends the message is dropped */
+            escape.pending_endl = 0;
+            (void)exe->print_string(exe->dev, "\",\"file\":\"");
+            (void)escape.exe.print_string(escape.exe.dev, IOCMD_file_name_remove_path(header.file));
+            IOCMD_Oprintf(exe, "\",\"line\":%u}", (unsigned)header.line);
+         }
+
+         IOCMD_Oprintf_Line(exe, "},");
+      }
+   }
+#if (IOCMD_LOG_PRINT_OS_CONTEXT && IOCMD_LOGS_TREE_OS_LOG_CONTEXT_SWITCH)
+   else if(IOCMD_LOG_OS_CONTEXT_SWITCH == header.level)
+   {
+      cntr = IOCMD_read_context_id(buf, cntr, &previous_context);
+      cntr = IOCMD_read_context_id(buf, cntr, &current_context);
+
+      pid = (unsigned)IOCMD_OS_CONTEXT_TYPE_THREAD;
+
+      /* context switch is marked on tracks of both threads */
+      IOCMD_trace_print_event_begin(
+         exe, "i", header.time, pid, (unsigned)IOCMD_OS_GET_CONTEXT_NUMBER(IOCMD_OS_CONTEXT_TYPE_THREAD, previous_context));
+      IOCMD_Oprintf_Line(exe, "\"s\":\"t\",\"cat\":\"sched\",\"name\":\"switch out\",\"args\":{\"next\":%u}},",
+         (unsigned)IOCMD_OS_GET_CONTEXT_NUMBER(IOCMD_OS_CONTEXT_TYPE_THREAD, current_context));
+
+      IOCMD_trace_print_event_begin(
+         exe, "i", header.time, pid, (unsigned)IOCMD_OS_GET_CONTEXT_NUMBER(IOCMD_OS_CONTEXT_TYPE_THREAD, current_context));
+      IOCMD_Oprintf_Line(exe, "\"s\":\"t\",\"cat\":\"sched\",\"name\":\"switch in\",\"args\":{\"previous\":%u}},",
+         (unsigned)IOCMD_OS_GET_CONTEXT_NUMBER(IOCMD_OS_CONTEXT_TYPE_THREAD, previous_context));
+
+#if (IOCMD_LOG_PRINT_OS_CONTEXT_NAME)
+      /* thread track gets name of the context */
+      IOCMD_Oprintf(exe, "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"",
+         pid, (unsigned)IOCMD_OS_GET_CONTEXT_NUMBER(IOCMD_OS_CONTEXT_TYPE_THREAD, current_context));
+      (void)escape.exe.print_string(escape.exe.dev, IOCMD_OS_GET_CONTEXT_NAME(IOCMD_OS_CONTEXT_TYPE_THREAD, current_context));
+      IOCMD_Oprintf_Line(exe, "\"}},");
+#endif
+   }
+#endif
+} /* IOCMD_proc_one_trace_log */
+#endif
+
 #if(!IOCMD_OUT_SUPPORT_POS_RETURNING)
 
 uint_fast16_t IOCMD_Compress_Param(
@@ -1669,12 +4921,20 @@ uint_fast16_t IOCMD_Compress_Param(
    if(IOCMD_BOOL_IS_TRUE(params->width_variadic))
    {
       var.int_field.i = (int)(params->width);
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+      buf_pos = IOCMD_add_varint_to_buf(&var, buf, buf_size - buf_pos, buf_pos, sizeof(int), IOCMD_TRUE);
+#else
       buf_pos = IOCMD_add_u32_to_buf(&var, buf, buf_size - buf_pos, buf_pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#endif
    }
    if(IOCMD_BOOL_IS_TRUE(params->precision_variadic))
    {
       var.int_field.i = (int)(params->precision);
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+      buf_pos = IOCMD_add_varint_to_buf(&var, buf, buf_size - buf_pos, buf_pos, sizeof(int), IOCMD_TRUE);
+#else
       buf_pos = IOCMD_add_u32_to_buf(&var, buf, buf_size - buf_pos, buf_pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#endif
    }
 
    if(   ('d' == params->specifier) || ('i' == params->specifier) || ('u' == params->specifier)
@@ -1684,11 +4944,16 @@ uint_fast16_t IOCMD_Compress_Param(
 #if((!IOCMD_PROMOTION_INT8_TO_INT16) && (!IOCMD_PROMOTION_INT16_TO_INT32))
       if((sizeof(uint8_t) / sizeof(uint8_t)) == params->length)
       {
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+         buf_pos = IOCMD_add_varint_to_buf(
+            data, buf, buf_size - buf_pos, buf_pos, params->length, IOCMD_LOG_IS_SIGNED_SPECIFIER(params->specifier));
+#else
          if((buf_size - buf_pos) >= 2U)
          {
             buf[buf_pos++] = IOCMD_LOG_BUF_DATA_TYPE_1BYTE;
             buf[buf_pos++] = data->u8_field.u8_0;
          }
+#endif
       }
       else
 #endif
@@ -1700,7 +4965,12 @@ uint_fast16_t IOCMD_Compress_Param(
             ((sizeof(uint16_t) / sizeof(uint8_t)) == params->length)
          )
       {
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+         buf_pos = IOCMD_add_varint_to_buf(
+            data, buf, buf_size - buf_pos, buf_pos, params->length, IOCMD_LOG_IS_SIGNED_SPECIFIER(params->specifier));
+#else
          buf_pos = IOCMD_add_u32_to_buf(data, buf, buf_size - buf_pos, buf_pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#endif
       }
       else
 #endif
@@ -1712,12 +4982,22 @@ uint_fast16_t IOCMD_Compress_Param(
             ((sizeof(uint32_t) / sizeof(uint8_t)) == params->length)
          )
       {
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+         buf_pos = IOCMD_add_varint_to_buf(
+            data, buf, buf_size - buf_pos, buf_pos, params->length, IOCMD_LOG_IS_SIGNED_SPECIFIER(params->specifier));
+#else
          buf_pos = IOCMD_add_u32_to_buf(data, buf, buf_size - buf_pos, buf_pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#endif
       }
 #if(IOCMD_OUT_SUPPORT_U64)
       else if((sizeof(uint64_t) / sizeof(uint8_t)) == params->length)
       {
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+         buf_pos = IOCMD_add_varint_to_buf(
+            data, buf, buf_size - buf_pos, buf_pos, params->length, IOCMD_LOG_IS_SIGNED_SPECIFIER(params->specifier));
+#else
          buf_pos = IOCMD_add_u64_to_buf(data, buf, buf_size - buf_pos, buf_pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#endif
       }
 #endif
    } /* d,i,u,o,x,X */
@@ -1768,6 +5048,18 @@ uint_fast16_t IOCMD_Compress_Param(
          }
       }
    } /* s */
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+   else if(('f' == params->specifier) || ('F' == params->specifier) || ('e' == params->specifier) || ('E' == params->specifier)
+      ||   ('g' == params->specifier) || ('G' == params->specifier) || ('a' == params->specifier) || ('A' == params->specifier))
+   {
+      if((buf_size - buf_pos) > sizeof(double))
+      {
+         buf[buf_pos++] = IOCMD_LOG_BUF_DATA_TYPE_DOUBLE;
+         memcpy(&buf[buf_pos], &(data->double_field.d), sizeof(double));
+         buf_pos += sizeof(double);
+      }
+   } /* f,F,e,E,g,G,a,A */
+#endif
 
    if(IOCMD_CHECK_PTR(uint_fast16_t, buf_ppos))
    {
@@ -1802,12 +5094,20 @@ uint_fast16_t IOCMD_Compress_Param(
    if(IOCMD_BOOL_IS_TRUE(params->width_variadic))
    {
       var.int_field.i = (int)(params->width);
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+      buf_pos = IOCMD_add_varint_to_buf(&var, buf, buf_size - buf_pos, buf_pos, sizeof(int), IOCMD_TRUE);
+#else
       buf_pos = IOCMD_add_u32_to_buf(&var, buf, buf_size - buf_pos, buf_pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#endif
    }
    if(IOCMD_BOOL_IS_TRUE(params->precision_variadic))
    {
       var.int_field.i = (int)(params->precision);
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+      buf_pos = IOCMD_add_varint_to_buf(&var, buf, buf_size - buf_pos, buf_pos, sizeof(int), IOCMD_TRUE);
+#else
       buf_pos = IOCMD_add_u32_to_buf(&var, buf, buf_size - buf_pos, buf_pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#endif
    }
 
    if(   ('d' == params->specifier) || ('i' == params->specifier) || ('u' == params->specifier)
@@ -1877,11 +5177,16 @@ uint_fast16_t IOCMD_Compress_Param(
 #if((!IOCMD_PROMOTION_INT8_TO_INT16) && (!IOCMD_PROMOTION_INT16_TO_INT32))
       if((sizeof(uint8_t) / sizeof(uint8_t)) == params->length)
       {
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+         buf_pos = IOCMD_add_varint_to_buf(
+            data, buf, buf_size - buf_pos, buf_pos, params->length, IOCMD_LOG_IS_SIGNED_SPECIFIER(params->specifier));
+#else
          if((buf_size - buf_pos) >= 2U)
          {
             buf[buf_pos++] = IOCMD_LOG_BUF_DATA_TYPE_1BYTE;
             buf[buf_pos++] = data->u8_field.u8_0;
          }
+#endif
 
          /* zero */
          if(0U == data->u8_field.u8_0)
@@ -1923,7 +5228,12 @@ uint_fast16_t IOCMD_Compress_Param(
             ((sizeof(uint16_t) / sizeof(uint8_t)) == params->length)
          )
       {
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+         buf_pos = IOCMD_add_varint_to_buf(
+            data, buf, buf_size - buf_pos, buf_pos, params->length, IOCMD_LOG_IS_SIGNED_SPECIFIER(params->specifier));
+#else
          buf_pos = IOCMD_add_u32_to_buf(data, buf, buf_size - buf_pos, buf_pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#endif
 
          /* zero */
          if(0U == data->u16_field.u16_0)
@@ -1965,7 +5275,12 @@ uint_fast16_t IOCMD_Compress_Param(
             ((sizeof(uint32_t) / sizeof(uint8_t)) == params->length)
          )
       {
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+         buf_pos = IOCMD_add_varint_to_buf(
+            data, buf, buf_size - buf_pos, buf_pos, params->length, IOCMD_LOG_IS_SIGNED_SPECIFIER(params->specifier));
+#else
          buf_pos = IOCMD_add_u32_to_buf(data, buf, buf_size - buf_pos, buf_pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#endif
 
          /* zero */
          if(0U == data->u32_field.u32_0)
@@ -2000,7 +5315,12 @@ uint_fast16_t IOCMD_Compress_Param(
 #if(IOCMD_OUT_SUPPORT_U64)
       else if((sizeof(uint64_t) / sizeof(uint8_t)) == params->length)
       {
+#if(IOCMD_LOG_VARINT_ARGUMENTS)
+         buf_pos = IOCMD_add_varint_to_buf(
+            data, buf, buf_size - buf_pos, buf_pos, params->length, IOCMD_LOG_IS_SIGNED_SPECIFIER(params->specifier));
+#else
          buf_pos = IOCMD_add_u64_to_buf(data, buf, buf_size - buf_pos, buf_pos, IOCMD_LOG_BUF_DATA_TYPE_1BYTE);
+#endif
 
          /* zero */
          if(0U == data->u64_field.u64)
@@ -2339,6 +5659,21 @@ uint_fast16_t IOCMD_Compress_Param(
          }
       }
    } /* s */
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+   else if(('f' == params->specifier) || ('F' == params->specifier) || ('e' == params->specifier) || ('E' == params->specifier)
+      ||   ('g' == params->specifier) || ('G' == params->specifier) || ('a' == params->specifier) || ('A' == params->specifier))
+   {
+      if((buf_size - buf_pos) > sizeof(double))
+      {
+         buf[buf_pos++] = IOCMD_LOG_BUF_DATA_TYPE_DOUBLE;
+         memcpy(&buf[buf_pos], &(data->double_field.d), sizeof(double));
+         buf_pos += sizeof(double);
+      }
+
+      /* length of printed number is known only after conversion - done here without printing */
+      out_pos = (IOCMD_String_Pos_DT)IOCMD_Proc_Float_Param(params, data->double_field.d, IOCMD_MAKE_INVALID_PTR(const IOCMD_Print_Exe_Params_XT));
+   } /* f,F,e,E,g,G,a,A */
+#endif
 
    if(IOCMD_CHECK_PTR(uint_fast16_t, buf_ppos))
    {
@@ -2363,51 +5698,188 @@ size_t                                 IOCMD_Log_Get_Tree_Num_Elems(void)
 {
    return Num_Elems(IOCMD_logs_tree_tab);
 }
+void IOCMD_Log_Refresh_Tree_State(void)
+{
+   IOCMD_global_cntr_DT i;
+   uint_fast8_t main_level  = IOCMD_LOG_LEVEL_EMERG;
+   uint_fast8_t quiet_level = IOCMD_LOG_LEVEL_EMERG;
+
+   for(i = 0U; i < IOCMD_Params.levels_tab_size; i++)
+   {
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+      main_level  = IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_data[i].level, IOCMD_Params.temporary_main_level)
+         | (IOCMD_Params.temporary_main_level & 0xFU);
+#endif
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+      quiet_level = IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_data[i].quiet_level, IOCMD_Params.temporary_quiet_level)
+         | (IOCMD_Params.temporary_quiet_level & 0xFU);
+#endif
+      IOCMD_Params.levels_tab_effective[i]      = (uint8_t)(main_level | IOCMD_MUL_BY_POWER_OF_2(quiet_level, 4));
+      IOCMD_Params.entrances_tab_effective[i]   = (uint8_t)(
+         IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_data[i].entrance_logging_state, IOCMD_Params.temporary_entrance_level)
+         | (IOCMD_Params.temporary_entrance_level & 0xFU));
+#if(IOCMD_LOG_INLINE_LEVEL_CHECK)
+      IOCMD_Log_Effective_Levels[i] = (uint8_t)((main_level > quiet_level) ? main_level : quiet_level);
+#endif
+   }
+} /* IOCMD_Log_Refresh_Tree_State */
 const char * const *IOCMD_Log_Get_Levels_Names(void)
 {
    return IOCMD_level_strings;
 }
 
-void IOCMD_Log_Get_Buf_Params(IOCMD_Buff_Params_Readout_XT *params)
+void IOCMD_Log_Get_Buf_Params(IOCMD_Buff_Params_Readout_XT *params)
+{
+#if(IOCMD_LOG_LOCK_FREE_STAGING && (IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0))
+   size_t cntr;
+
+#endif
+   if(IOCMD_CHECK_PTR(IOCMD_Buff_Params_Readout_XT, params))
+   {
+#if(IOCMD_LOG_SINGLE_STORAGE)
+      /* both views share one buffer; main logs are these which were not processed as main logs yet */
+      params->main_buf_size               = (size_t)(IOCMD_Params.quiet_ring_buf.size);
+      params->main_buf_max_used_size      = (size_t)BUFF_RING_GET_MAX_BUSY_SIZE(&(IOCMD_Params.quiet_ring_buf));
+      params->main_buf_current_used_size  =
+         (size_t)(BUFF_RING_GET_BUSY_SIZE(&(IOCMD_Params.quiet_ring_buf)) - IOCMD_Params.main_read_pos);
+#elif(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+      params->main_buf_size               = (size_t)(IOCMD_Params.main_ring_buf.size);
+      params->main_buf_max_used_size      = (size_t)BUFF_RING_GET_MAX_BUSY_SIZE(&(IOCMD_Params.main_ring_buf));
+      params->main_buf_current_used_size  = (size_t)BUFF_RING_GET_BUSY_SIZE(&(IOCMD_Params.main_ring_buf));
+#else
+      params->main_buf_size               = 0U;
+      params->main_buf_max_used_size      = 0U;
+      params->main_buf_current_used_size  = 0U;
+#endif
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+      params->quiet_buf_size              = (size_t)(IOCMD_Params.quiet_ring_buf.size);
+      params->quiet_buf_max_used_size     = (size_t)BUFF_RING_GET_MAX_BUSY_SIZE(&(IOCMD_Params.quiet_ring_buf));
+      params->quiet_buf_current_used_size = (size_t)BUFF_RING_GET_BUSY_SIZE(&(IOCMD_Params.quiet_ring_buf));
+#else
+      params->quiet_buf_size              = 0U;
+      params->quiet_buf_max_used_size     = 0U;
+      params->quiet_buf_current_used_size = 0U;
+#endif
+#if(IOCMD_LOG_LOCK_FREE_STAGING && (IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0))
+      params->context_staging_rings_used  = 0U;
+
+      for(cntr = 0U; cntr < IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS; cntr++)
+      {
+         if(atomic_load_explicit(&(IOCMD_Params.context_staging_taken[cntr]), memory_order_relaxed))
+         {
+            params->context_staging_rings_used++;
+         }
+      }
+#endif
+   }
+}
+
+#if(IOCMD_LOG_PROFILER)
+IOCMD_Bool_DT IOCMD_Log_Get_Profiler_Stats(size_t index, IOCMD_Log_Profiler_Stats_XT *stats)
+{
+   IOCMD_Profiler_Function_XT *function;
+   uint_fast16_t cntr;
+   IOCMD_Bool_DT result = IOCMD_FALSE;
+
+   if(IOCMD_CHECK_PTR(IOCMD_Log_Profiler_Stats_XT, stats) && (index < IOCMD_LOG_PROFILER_NUM_FUNCTIONS))
+   {
+      function          = &IOCMD_profiler_functions[index];
+      stats->func_name  = atomic_load_explicit(&(function->func_name), memory_order_acquire);
+
+      if(IOCMD_CHECK_PTR(const char, stats->func_name))
+      {
+         /* statistics are read while other threads can update them - values can be not exactly consistent */
+         stats->file       = atomic_load_explicit(&(function->file), memory_order_acquire);
+         stats->id         = atomic_load_explicit(&(function->id),   memory_order_relaxed);
+         stats->num_calls  = 0U;
+         stats->total_time = atomic_load_explicit(&(function->total_time), memory_order_relaxed);
+         stats->min_time   = atomic_load_explicit(&(function->min_time),   memory_order_relaxed);
+         stats->max_time   = atomic_load_explicit(&(function->max_time),   memory_order_relaxed);
+
+         for(cntr = 0U; cntr < IOCMD_LOG_PROFILER_NUM_BUCKETS; cntr++)
+         {
+            stats->histogram[cntr] = atomic_load_explicit(&(function->histogram[cntr]), memory_order_relaxed);
+            stats->num_calls      += stats->histogram[cntr];
+         }
+
+         result = IOCMD_TRUE;
+      }
+   }
+
+   return result;
+} /* IOCMD_Log_Get_Profiler_Stats */
+
+void IOCMD_Log_Reset_Profiler_Stats(void)
+{
+   IOCMD_Profiler_Function_XT *function;
+   size_t index;
+   uint_fast16_t cntr;
+
+   /* functions stay in their slots, only statistics are cleared */
+   for(index = 0U; index < IOCMD_LOG_PROFILER_NUM_FUNCTIONS; index++)
+   {
+      function = &IOCMD_profiler_functions[index];
+
+      atomic_store_explicit(&(function->total_time), 0U,         memory_order_relaxed);
+      atomic_store_explicit(&(function->min_time),   UINT64_MAX, memory_order_relaxed);
+      atomic_store_explicit(&(function->max_time),   0U,         memory_order_relaxed);
+
+      for(cntr = 0U; cntr < IOCMD_LOG_PROFILER_NUM_BUCKETS; cntr++)
+      {
+         atomic_store_explicit(&(function->histogram[cntr]), 0U, memory_order_relaxed);
+      }
+   }
+} /* IOCMD_Log_Reset_Profiler_Stats */
+
+uint64_t IOCMD_Log_Profiler_Bucket_Begin(uint_fast16_t bucket)
 {
-   if(IOCMD_CHECK_PTR(IOCMD_Buff_Params_Readout_XT, params))
+   uint_fast16_t shift = 0U;
+
+   if(bucket >= (2U * IOCMD_LOG_PROFILER_SUB_BUCKETS))
    {
-#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
-      params->main_buf_size               = sizeof(IOCMD_Params.main_buf);
-      params->main_buf_max_used_size      = (size_t)BUFF_RING_GET_MAX_BUSY_SIZE(&(IOCMD_Params.main_ring_buf));
-      params->main_buf_current_used_size  = (size_t)BUFF_RING_GET_BUSY_SIZE(&(IOCMD_Params.main_ring_buf));
-#else
-      params->main_buf_size               = 0U;
-      params->main_buf_max_used_size      = 0U;
-      params->main_buf_current_used_size  = 0U;
+      shift   = (uint_fast16_t)(bucket / IOCMD_LOG_PROFILER_SUB_BUCKETS) - 1U;
+      bucket -= (uint_fast16_t)(shift * IOCMD_LOG_PROFILER_SUB_BUCKETS);
+   }
+
+   return (uint64_t)bucket << shift;
+} /* IOCMD_Log_Profiler_Bucket_Begin */
+
+uint64_t IOCMD_Log_Profiler_Time_To_Ns(uint64_t time)
+{
+#if(IOCMD_LOG_HIGH_RES_TIME)
+   IOCMD_time_calibrate();
+
+   time = (uint64_t)((double)time * atomic_load_explicit(&(IOCMD_time.ns_per_tick), memory_order_relaxed));
 #endif
-#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
-      params->quiet_buf_size              = sizeof(IOCMD_Params.quiet_buf);
-      params->quiet_buf_max_used_size     = (size_t)BUFF_RING_GET_MAX_BUSY_SIZE(&(IOCMD_Params.quiet_ring_buf));
-      params->quiet_buf_current_used_size = (size_t)BUFF_RING_GET_BUSY_SIZE(&(IOCMD_Params.quiet_ring_buf));
-#else
-      params->quiet_buf_size              = 0U;
-      params->quiet_buf_max_used_size     = 0U;
-      params->quiet_buf_current_used_size = 0U;
+
+   return time;
+} /* IOCMD_Log_Profiler_Time_To_Ns */
 #endif
-   }
-}
 
-IOCMD_Bool_DT IOCMD_Logs_Init(void)
+static IOCMD_Bool_DT IOCMD_logs_init(Buff_Size_DT main_buf_size, Buff_Size_DT quiet_buf_size)
 {
    IOCMD_Log_ID_DT i;
    IOCMD_Bool_DT result = IOCMD_FALSE;
 
+#if(0 == IOCMD_LOG_MAIN_BUF_SIZE)
+   IOCMD_UNUSED_PARAM(main_buf_size);
+#endif
+#if(0 == IOCMD_LOG_QUIET_BUF_SIZE)
+   IOCMD_UNUSED_PARAM(quiet_buf_size);
+#endif
+
    if(IOCMD_PROTECTION_CREATE(&IOCMD_Params.global_cntr))
    {
       if(IOCMD_PROTECTION_INIT(&IOCMD_Params.global_cntr))
       {
-#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
-         if(Buff_Ring_Init(&(IOCMD_Params.main_ring_buf),   IOCMD_Params.main_buf,   sizeof(IOCMD_Params.main_buf)))
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE))
+         if(Buff_Ring_Init(&(IOCMD_Params.main_ring_buf),   IOCMD_Params.buf_memory,   main_buf_size))
 #endif
          {
-#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
-            if(Buff_Ring_Init(&(IOCMD_Params.quiet_ring_buf),   IOCMD_Params.quiet_buf,   sizeof(IOCMD_Params.quiet_buf)))
+#if(IOCMD_LOG_SINGLE_STORAGE)
+            if(Buff_Ring_Init(&(IOCMD_Params.quiet_ring_buf),   IOCMD_Params.buf_memory,   main_buf_size + quiet_buf_size))
+#elif(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+            if(Buff_Ring_Init(&(IOCMD_Params.quiet_ring_buf),   &(IOCMD_Params.buf_memory[main_buf_size]),   quiet_buf_size))
 #endif
             {
                for(i = 0U; i < IOCMD_logs_tree.tab_num_elems; i++)
@@ -2445,6 +5917,36 @@ IOCMD_Bool_DT IOCMD_Logs_Init(void)
                IOCMD_Params.temporary_quiet_level   = 0U;
 #endif
                IOCMD_Params.temporary_entrance_level= 0U;
+#if(IOCMD_LOG_SINGLE_STORAGE)
+               IOCMD_Params.main_read_pos           = 0U;
+#endif
+               IOCMD_Log_Refresh_Tree_State();
+#if(IOCMD_LOG_HIGH_RES_TIME)
+               IOCMD_time_init();
+#endif
+#if(IOCMD_LOG_PROFILER)
+               IOCMD_Log_Reset_Profiler_Stats();
+#endif
+#if(IOCMD_LOG_COMPACT_HEADER)
+               /* first logs will be keyframes */
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+               memset(&(IOCMD_Params.main_compact), 0, sizeof(IOCMD_Params.main_compact));
+#endif
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+               memset(&(IOCMD_Params.quiet_compact), 0, sizeof(IOCMD_Params.quiet_compact));
+#endif
+#endif
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE))
+               memset(&(IOCMD_Params.main_index), 0, sizeof(IOCMD_Params.main_index));
+#endif
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+               memset(&(IOCMD_Params.quiet_index), 0, sizeof(IOCMD_Params.quiet_index));
+#endif
+#endif
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+               IOCMD_staging_init();
+#endif
 
                result = IOCMD_TRUE;
             }
@@ -2467,18 +5969,167 @@ IOCMD_Bool_DT IOCMD_Logs_Init(void)
 #endif
 
    return result;
+} /* IOCMD_logs_init */
+
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY)
+static IOCMD_Bool_DT IOCMD_buf_memory_is_valid(const void *mem, size_t main_buf_size, size_t quiet_buf_size)
+{
+   IOCMD_Bool_DT result = IOCMD_FALSE;
+
+   if(IOCMD_CHECK_PTR(const void, mem)
+      && (main_buf_size <= (size_t)(IOCMD_LOG_MAIN_BUF_SIZE)) && (quiet_buf_size <= (size_t)(IOCMD_LOG_QUIET_BUF_SIZE))
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+      && (main_buf_size >= IOCMD_LOG_MIN_BUF_SIZE)
+#endif
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+      && (quiet_buf_size >= IOCMD_LOG_MIN_BUF_SIZE)
+#endif
+      )
+   {
+      result = IOCMD_TRUE;
+   }
+
+   return result;
+} /* IOCMD_buf_memory_is_valid */
+
+/**
+ * Copies logs to new buffer which is already initialized; the oldest logs are removed when they do not fit into it.
+ * Returns IOCMD_TRUE if all remaining logs were copied.
+ */
+static IOCMD_Bool_DT IOCMD_move_buf(Buff_Ring_XT *buf, Buff_Ring_XT *new_buf)
+{
+   Buff_Size_DT size = new_buf->size;
+
+   if(BUFF_RING_GET_BUSY_SIZE(buf) > size)
+   {
+      /* the oldest logs are removed so 1/8 of new buffer stays free */
+#if(IOCMD_LOG_REMOVE_LOGS_IN_BATCHES)
+      /* IOCMD_reduce_buf releases 1/8 of current buffer more than requested */
+      IOCMD_reduce_buf(buf, (buf->size - size) - ((buf->size / 8U) - (size / 8U)));
+#else
+      /* requested size is never smaller than 1/8 of current buffer, because new buffer is smaller */
+      IOCMD_reduce_buf(buf, (buf->size - size) + (size / 8U));
+#endif
+   }
+
+   return (BUFF_RING_GET_BUSY_SIZE(buf) == Buff_Ring_To_Ring_Copy(new_buf, buf, BUFF_RING_GET_BUSY_SIZE(buf), 0U, BUFF_FALSE, BUFF_FALSE))
+      ? IOCMD_TRUE : IOCMD_FALSE;
+} /* IOCMD_move_buf */
+
+IOCMD_Bool_DT IOCMD_Logs_Init_With_Memory(void *mem, size_t main_buf_size, size_t quiet_buf_size)
+{
+   IOCMD_Bool_DT result = IOCMD_FALSE;
+
+   if(IOCMD_buf_memory_is_valid(mem, main_buf_size, quiet_buf_size))
+   {
+      IOCMD_Params.buf_memory = (uint8_t*)mem;
+
+      result = IOCMD_logs_init((Buff_Size_DT)main_buf_size, (Buff_Size_DT)quiet_buf_size);
+   }
+
+   return result;
+} /* IOCMD_Logs_Init_With_Memory */
+
+IOCMD_Bool_DT IOCMD_Logs_Change_Memory(void *mem, size_t main_buf_size, size_t quiet_buf_size, void **old_mem)
+{
+   Buff_Ring_XT  *bufs[2];
+   Buff_Ring_XT   new_bufs[2];
+   uint_fast8_t   num_bufs     = 0U;
+   uint_fast8_t   num_inited   = 0U;
+   uint_fast8_t   cntr;
+   IOCMD_Bool_DT  result       = IOCMD_FALSE;
+
+   if(IOCMD_buf_memory_is_valid(mem, main_buf_size, quiet_buf_size) && IOCMD_CHECK_PTR(void*, old_mem)
+      && (IOCMD_Params.levels_tab_size > 0U))
+   {
+      /* new buffers are initialized before anything is changed; if it fails, logs stay in current memory */
+#if(IOCMD_LOG_SINGLE_STORAGE)
+      bufs[num_bufs] = &(IOCMD_Params.quiet_ring_buf);
+      num_bufs++;
+      if(Buff_Ring_Init(&(new_bufs[num_inited]), mem, (Buff_Size_DT)(main_buf_size + quiet_buf_size)))
+      {
+         num_inited++;
+      }
+#else
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+      bufs[num_bufs] = &(IOCMD_Params.main_ring_buf);
+      num_bufs++;
+      if(Buff_Ring_Init(&(new_bufs[num_inited]), mem, (Buff_Size_DT)main_buf_size))
+      {
+         num_inited++;
+      }
+#endif
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+      bufs[num_bufs] = &(IOCMD_Params.quiet_ring_buf);
+      num_bufs++;
+      if((num_inited == (num_bufs - 1U))
+         && Buff_Ring_Init(&(new_bufs[num_inited]), &(((uint8_t*)mem)[main_buf_size]), (Buff_Size_DT)quiet_buf_size))
+      {
+         num_inited++;
+      }
+#endif
+#endif
+
+      if(num_inited == num_bufs)
+      {
+         IOCMD_PROTECTION_LOCK(IOCMD_Params);
+
+         result = IOCMD_TRUE;
+
+         for(cntr = 0U; cntr < num_bufs; cntr++)
+         {
+            if(IOCMD_BOOL_IS_FALSE(IOCMD_move_buf(bufs[cntr], &(new_bufs[cntr]))))
+            {
+               result = IOCMD_FALSE;
+            }
+         }
+
+         if(IOCMD_BOOL_IS_TRUE(result))
+         {
+            for(cntr = 0U; cntr < num_bufs; cntr++)
+            {
+               Buff_Ring_Deinit(bufs[cntr]);
+               *(bufs[cntr]) = new_bufs[cntr];
+            }
+
+            *old_mem = IOCMD_Params.buf_memory;
+            IOCMD_Params.buf_memory = (uint8_t*)mem;
+         }
+
+         IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
+      }
+
+      if(IOCMD_BOOL_IS_FALSE(result))
+      {
+         for(cntr = 0U; cntr < num_inited; cntr++)
+         {
+            Buff_Ring_Deinit(&(new_bufs[cntr]));
+         }
+      }
+   }
+
+   return result;
+} /* IOCMD_Logs_Change_Memory */
+#else
+IOCMD_Bool_DT IOCMD_Logs_Init(void)
+{
+   return IOCMD_logs_init(IOCMD_LOG_MAIN_BUF_SIZE, IOCMD_LOG_QUIET_BUF_SIZE);
 } /* IOCMD_Logs_Init */
+#endif
 
 void IOCMD_Logs_Deinit(void)
 {
    IOCMD_PROTECTION_LOCK(IOCMD_Params);
 
-#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE))
    Buff_Ring_Deinit(&(IOCMD_Params.main_ring_buf));
 #endif
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
    Buff_Ring_Deinit(&(IOCMD_Params.quiet_ring_buf));
 #endif
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY)
+   IOCMD_Params.buf_memory = IOCMD_MAKE_INVALID_PTR(uint8_t);
+#endif
 
    IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
 
@@ -2486,6 +6137,25 @@ void IOCMD_Logs_Deinit(void)
    IOCMD_PROTECTION_DESTROY(&IOCMD_Params.global_cntr);
 } /* IOCMD_Logs_Deinit */
 
+void IOCMD_Log_Thread_Exit(void)
+{
+#if(IOCMD_LOG_LOCK_FREE_STAGING && (IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0))
+   IOCMD_Staging_Ring_XT *ring = IOCMD_context_staging_ring;
+
+   if(IOCMD_CHECK_PTR(IOCMD_Staging_Ring_XT, ring) && (ring != &(IOCMD_Params.staging)))
+   {
+      IOCMD_context_staging_ring = IOCMD_MAKE_INVALID_PTR(IOCMD_Staging_Ring_XT);
+
+      /**
+       * logs published to the ring stay in it and are moved to log buffers by next transfer, merged by publishing order;
+       * release - next owner continues writing after them
+       */
+      atomic_store_explicit(
+         &(IOCMD_Params.context_staging_taken[ring - IOCMD_Params.context_staging]), false, memory_order_release);
+   }
+#endif
+} /* IOCMD_Log_Thread_Exit */
+
 void IOCMD_Clear_All_Logs(IOCMD_Bool_DT clear_quiet_buf)
 {
 #if(0 == IOCMD_LOG_QUIET_BUF_SIZE)
@@ -2494,14 +6164,45 @@ void IOCMD_Clear_All_Logs(IOCMD_Bool_DT clear_quiet_buf)
 
    IOCMD_PROTECTION_LOCK(IOCMD_Params);
 
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+   IOCMD_staging_transfer();
+#endif
+
+#if(IOCMD_LOG_SINGLE_STORAGE)
+   if(IOCMD_BOOL_IS_TRUE(clear_quiet_buf))
+   {
+      Buff_Ring_Clear(&(IOCMD_Params.quiet_ring_buf), BUFF_FALSE);
+      IOCMD_Params.main_read_pos = 0U;
+#if(IOCMD_LOG_COMPACT_HEADER)
+      memset(&(IOCMD_Params.main_compact), 0, sizeof(IOCMD_Params.main_compact));
+      memset(&(IOCMD_Params.quiet_compact), 0, sizeof(IOCMD_Params.quiet_compact));
+#endif
+   }
+   else
+   {
+      /* all logs are treated as already processed main logs - they stay available only if they are quiet logs */
+      IOCMD_Params.main_read_pos = BUFF_RING_GET_BUSY_SIZE(&(IOCMD_Params.quiet_ring_buf));
+#if(IOCMD_LOG_COMPACT_HEADER)
+      IOCMD_Params.main_compact.reader = IOCMD_Params.quiet_compact.writer;
+#endif
+      IOCMD_remove_processed_main_logs();
+   }
+#else
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
    Buff_Ring_Clear(&(IOCMD_Params.main_ring_buf), BUFF_FALSE);
+#if(IOCMD_LOG_COMPACT_HEADER)
+   memset(&(IOCMD_Params.main_compact), 0, sizeof(IOCMD_Params.main_compact));
+#endif
 #endif
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
    if(IOCMD_BOOL_IS_TRUE(clear_quiet_buf))
    {
       Buff_Ring_Clear(&(IOCMD_Params.quiet_ring_buf), BUFF_FALSE);
+#if(IOCMD_LOG_COMPACT_HEADER)
+      memset(&(IOCMD_Params.quiet_compact), 0, sizeof(IOCMD_Params.quiet_compact));
+#endif
    }
+#endif
 #endif
 
    IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
@@ -2530,16 +6231,33 @@ void IOCMD_Logs_Resume(void)
 } /* IOCMD_Logs_Resume */
 #endif
 
-void IOCMD_Log(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, const char *file, const char *format, ...)
+static void IOCMD_log_va(
+   IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, const char *file, const char *format,
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+   uint_fast32_t call_site,
+#endif
+   va_list arg)
 {
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+   IOCMD_Staging_Ring_XT *ring;
+   IOCMD_Staging_Slot_XT *slot;
+   size_t slot_pos;
+   uint8_t targets;
+   uint8_t record[IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH];
+#elif(IOCMD_LOG_COMPRESS_OUTSIDE_LOCK)
+   uint8_t targets;
+   uint8_t record[IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH];
+#else
    Buff_Ring_XT *first_ring;
-#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0))
+#if(IOCMD_LOG_SINGLE_STORAGE)
+   uint8_t targets;
+#elif((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0))
    Buff_Ring_XT *second_ring = BUFF_MAKE_INVALID_PTR(Buff_Ring_XT);
+#endif
 #endif
    uint8_t *buf;
-   va_list arg;
    IOCMD_Out_Main_Loop_Params_XT params;
-#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0))
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0) && (!IOCMD_LOG_LOCK_FREE_STAGING) && (!IOCMD_LOG_COMPRESS_OUTSIDE_LOCK) && (!IOCMD_LOG_SINGLE_STORAGE))
    Buff_Size_DT first_ring_pos;
 #endif
    /* first 2 bytes are reserved for length */
@@ -2560,12 +6278,10 @@ void IOCMD_Log(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, c
    )
    {
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
-      main_level  = IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_data[tab_id].level, IOCMD_Params.temporary_main_level)
-         | (IOCMD_Params.temporary_main_level & 0xFU);
+      main_level  = IOCMD_Params.levels_tab_effective[tab_id] & 0xFU;
 #endif
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
-      quiet_level = IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_data[tab_id].quiet_level, IOCMD_Params.temporary_quiet_level)
-         | (IOCMD_Params.temporary_quiet_level & 0xFU);
+      quiet_level = IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_effective[tab_id], 4);
 #endif
 
 #if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0))
@@ -2578,7 +6294,24 @@ void IOCMD_Log(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, c
       {
          if(IOCMD_LIKELY(IOCMD_CHECK_PTR(const char, file) && IOCMD_CHECK_PTR(const char, format)))
          {
-#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0))
+#if(IOCMD_LOG_LOCK_FREE_STAGING || IOCMD_LOG_COMPRESS_OUTSIDE_LOCK || IOCMD_LOG_SINGLE_STORAGE)
+            targets = 0U;
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+            if(level <= main_level)
+            {
+               targets |= IOCMD_LOG_TARGET_MAIN;
+            }
+#endif
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+            if(level <= quiet_level)
+            {
+               targets |= IOCMD_LOG_TARGET_QUIET;
+            }
+#endif
+#if(IOCMD_LOG_SINGLE_STORAGE && (!IOCMD_LOG_LOCK_FREE_STAGING) && (!IOCMD_LOG_COMPRESS_OUTSIDE_LOCK))
+            first_ring = &(IOCMD_Params.quiet_ring_buf);
+#endif
+#elif((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0))
             if(level <= quiet_level)
             {
                first_ring = &(IOCMD_Params.quiet_ring_buf);
@@ -2607,8 +6340,21 @@ void IOCMD_Log(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, c
                cntr2 = 1U;
             }
 
-            va_start(arg, format);
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+            ring = IOCMD_staging_get_ring();
+            slot = IOCMD_staging_reserve(ring, &slot_pos);
 
+            if(IOCMD_CHECK_PTR(IOCMD_Staging_Slot_XT, slot))
+            {
+               buf = slot->record;
+            }
+            else
+            {
+               buf = record;
+            }
+#elif(IOCMD_LOG_COMPRESS_OUTSIDE_LOCK)
+            buf = record;
+#else
             IOCMD_PROTECTION_LOCK(IOCMD_Params);
 
             if(BUFF_UNLIKELY(BUFF_RING_GET_FREE_SIZE(first_ring) < (2U * (IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH))))
@@ -2618,15 +6364,36 @@ void IOCMD_Log(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, c
 
             buf = Buff_Ring_Data_Check_Out(
                first_ring, IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH - 2U + cntr2, BUFF_FALSE, BUFF_FALSE);
+#endif
 
-            cntr = IOCMD_add_standard_header_and_main_string_to_buf(
-               buf, IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH - 2U + cntr2, cntr2, line, level, file, format);
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+            if(call_site < IOCMD_LOG_MAX_NUM_CALL_SITES)
+            {
+               cntr = IOCMD_add_call_site_header_to_buf(buf, cntr2, call_site);
+            }
+            else
+#endif
+            {
+               cntr = IOCMD_add_standard_header_and_main_string_to_buf(
+                  buf, IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH - 2U + cntr2, cntr2, line, level, file, format);
+            }
 
-            params.log.buf = buf;
-            params.log.buf_ppos = &cntr;
-            params.log.buf_size = IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH;
+#if(IOCMD_LOG_TYPED_ARGUMENTS)
+            if((call_site < IOCMD_LOG_MAX_NUM_CALL_SITES)
+               && IOCMD_BOOL_IS_TRUE(IOCMD_call_site_use_arg_types(&IOCMD_LOG_CALL_SITES_BEGIN[call_site])))
+            {
+               cntr = IOCMD_add_typed_args_to_buf(
+                  buf, IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH, cntr, &IOCMD_LOG_CALL_SITES_BEGIN[call_site], arg);
+            }
+            else
+#endif
+            {
+               params.log.buf = buf;
+               params.log.buf_ppos = &cntr;
+               params.log.buf_size = IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH;
 
-            (void)IOCMD_Proc_Main_Loop(format, &params, arg, IOCMD_FALSE);
+               (void)IOCMD_Proc_Main_Loop(format, &params, arg, IOCMD_FALSE);
+            }
 
             if(IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH >= 128)
             {
@@ -2639,6 +6406,40 @@ void IOCMD_Log(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, c
                buf[0] = (uint8_t)cntr;
             }
 
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+            if(IOCMD_CHECK_PTR(IOCMD_Staging_Slot_XT, slot))
+            {
+               slot->length  = cntr;
+               slot->targets = targets;
+               slot->order   = atomic_fetch_add_explicit(&(IOCMD_Params.staging_order), 1U, memory_order_relaxed);
+
+               /* publish the log; global counters will be added when it is moved to log buffers */
+               atomic_store_explicit(&(slot->sequence), slot_pos + 1U, memory_order_release);
+
+               /* logs from thread's own ring wait for IOCMD_Proc_Buffered_Logs or any other log function which takes the lock */
+               if(&(IOCMD_Params.staging) == ring)
+               {
+                  IOCMD_staging_published = slot_pos + 1U;
+
+                  /* logs of common ring are moved in batches - most writers don't take the lock */
+                  if((slot_pos + 1U - atomic_load_explicit(&(ring->tail), memory_order_relaxed)) >= IOCMD_LOG_STAGING_TRANSFER_THRESHOLD)
+                  {
+                     IOCMD_staging_try_transfer();
+                  }
+               }
+            }
+            else
+            {
+               IOCMD_PROTECTION_LOCK(IOCMD_Params);
+               IOCMD_staging_transfer_all();
+               IOCMD_store_log(record, cntr, targets);
+               IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
+            }
+#elif(IOCMD_LOG_COMPRESS_OUTSIDE_LOCK)
+            IOCMD_PROTECTION_LOCK(IOCMD_Params);
+            IOCMD_store_log(record, cntr, targets);
+            IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
+#else
             /* global cntr */
             buf[cntr2++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.global_cntr)) )[0];
 #if(IOCMD_LOG_GLOBAL_CNTR_SIZE > 1)
@@ -2666,13 +6467,23 @@ void IOCMD_Log(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, c
                IOCMD_Params.global_cntr.main_cntr++;
             }
 
-#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0))
+#if(IOCMD_LOG_SINGLE_STORAGE)
+            IOCMD_set_log_targets(buf, targets);
+
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+            IOCMD_index_log(first_ring, (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
+            (void)Buff_Ring_Data_Check_In(first_ring, (Buff_Size_DT)cntr, BUFF_FALSE);
+#elif((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0))
             /**
              * Function Buff_Ring_To_Ring_Copy gets offset from begining of busy size fo we have to remember here busy size
              * instead result of Buff_Ring_Data_Check_In which is offset from begining of buffer memory
              */
             first_ring_pos = BUFF_RING_GET_BUSY_SIZE(first_ring);
 
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+            IOCMD_index_log(first_ring, (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
             (void)Buff_Ring_Data_Check_In(first_ring, (Buff_Size_DT)cntr, BUFF_FALSE);
 
             if(BUFF_CHECK_PTR(Buff_Ring_XT, second_ring))
@@ -2681,15 +6492,20 @@ void IOCMD_Log(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, c
                {
                   IOCMD_reduce_buf(second_ring, (Buff_Size_DT)cntr);
                }
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+               IOCMD_index_log(second_ring, (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
                Buff_Ring_To_Ring_Copy(second_ring, first_ring, (Buff_Size_DT)cntr, first_ring_pos, BUFF_FALSE, BUFF_FALSE);
             }
 #else
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+            IOCMD_index_log(first_ring, (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
             (void)Buff_Ring_Data_Check_In(first_ring, (Buff_Size_DT)cntr, BUFF_FALSE);
 #endif
 
             IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
-
-            va_end(arg);
+#endif
 
 #if(IOCMD_SUPPORT_IMMEDIATE_LOGS_PRINTING)
             if(IOCMD_CHECK_PTR(const IOCMD_Print_Exe_Params_XT, IOCMD_ILP.exe))
@@ -2703,8 +6519,64 @@ void IOCMD_Log(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, c
          }
       }
    }
+} /* IOCMD_log_va */
+
+#if(IOCMD_LOG_HIGH_RES_TIME)
+IOCMD_Time_DT IOCMD_Log_Get_Time(void)
+{
+   IOCMD_Time_DT result;
+
+#if(IOCMD_LOG_TSC_SUPPORTED)
+   if(IOCMD_BOOL_IS_TRUE(IOCMD_time.tsc))
+   {
+      result = (IOCMD_Time_DT)__rdtsc();
+   }
+   else
+#endif
+   {
+      result = (IOCMD_Time_DT)IOCMD_time_get_ns(CLOCK_MONOTONIC);
+   }
+
+   return result;
+} /* IOCMD_Log_Get_Time */
+#endif
+
+void IOCMD_Log(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, const char *file, const char *format, ...)
+{
+   va_list arg;
+
+   va_start(arg, format);
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+   IOCMD_log_va(tab_id, line, level, file, format, IOCMD_LOG_NO_CALL_SITE, arg);
+#else
+   IOCMD_log_va(tab_id, line, level, file, format, arg);
+#endif
+   va_end(arg);
 } /* IOCMD_Log */
 
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+void IOCMD_Log_Call_Site(const IOCMD_Log_Call_Site_XT *call_site, const char *format, ...)
+{
+   va_list arg;
+
+   va_start(arg, format);
+   IOCMD_log_va(
+      call_site->id, call_site->line, call_site->level, call_site->file, call_site->format,
+      (uint_fast32_t)(call_site - IOCMD_LOG_CALL_SITES_BEGIN), arg);
+   va_end(arg);
+} /* IOCMD_Log_Call_Site */
+
+const IOCMD_Log_Call_Site_XT *IOCMD_Log_Get_Call_Sites(uint_fast32_t *num_call_sites)
+{
+   if(IOCMD_CHECK_PTR(uint_fast32_t, num_call_sites))
+   {
+      *num_call_sites = (uint_fast32_t)(IOCMD_LOG_CALL_SITES_END - IOCMD_LOG_CALL_SITES_BEGIN);
+   }
+
+   return IOCMD_LOG_CALL_SITES_BEGIN;
+} /* IOCMD_Log_Get_Call_Sites */
+#endif
+
 #if(IOCMD_SUPPORT_DATA_LOGGING)
 void IOCMD_Log_Data_Context(
    IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t level, const char *file,
@@ -2717,7 +6589,18 @@ void IOCMD_Log_Data_Context(
    uint_fast16_t cntr = 2U;
    uint_fast8_t cntr2 = 2U;
    uint8_t buf[IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH];
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+   uint8_t data_desc_buf[MAX(IOCMD_LOG_DATA_DESC_SIZE, IOCMD_LOG_DATA_FRAGMENT_DESC_SIZE)];
+#else
    uint8_t data_desc_buf[IOCMD_LOG_DATA_DESC_SIZE];
+#endif
+#if(IOCMD_LOG_DATA_COMPRESSION)
+   uint8_t packed_buf[IOCMD_MAX_LOG__DATA_1_LENGTH];
+#endif
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+   uint_fast16_t fragment_end = size;
+   IOCMD_Bool_DT next_fragment;
+#endif
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
    uint_fast8_t main_level;
 #endif
@@ -2733,12 +6616,10 @@ void IOCMD_Log_Data_Context(
    )
    {
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
-      main_level  = IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_data[tab_id].level, IOCMD_Params.temporary_main_level)
-         | (IOCMD_Params.temporary_main_level & 0xFU);
+      main_level  = IOCMD_Params.levels_tab_effective[tab_id] & 0xFU;
 #endif
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
-      quiet_level = IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_data[tab_id].quiet_level, IOCMD_Params.temporary_quiet_level)
-         | (IOCMD_Params.temporary_quiet_level & 0xFU);
+      quiet_level = IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_effective[tab_id], 4);
 #endif
 
 #if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0))
@@ -2758,14 +6639,6 @@ void IOCMD_Log_Data_Context(
             table[0].data = buf;
             table[0].size = cntr;
 
-            /**
-             * add data just after format string/ptr -
-             * it will be always correctly read even if "printf" argumnets were provided incorrectly
-             */
-
-            /* add data size and data table to buffer */
-            IOCMD_add_data_tab_to_buf(data_desc_buf, sizeof(data_desc_buf), data, size, &table[1]);
-
             table[3].data = &buf[cntr];
 
             va_start(arg, format);
@@ -2780,6 +6653,23 @@ void IOCMD_Log_Data_Context(
 
             table[3].size = (Buff_Size_DT)( ((const uint8_t*)(&buf[cntr])) - ((const uint8_t*)(table[3].data)) );
 
+            /**
+             * add data just after format string/ptr -
+             * it will be always correctly read even if "printf" argumnets were provided incorrectly
+             */
+#if(IOCMD_LOG_DATA_COMPRESSION)
+            /* compressed data must fit into working buffer of IOCMD_Proc_Buffered_Logs together with rest of the log */
+            cntr = IOCMD_WORKING_BUF_RECOMMENDED_SIZE - table[0].size - table[3].size - IOCMD_LOG_DATA_DESC_SIZE;
+
+            if(IOCMD_BOOL_IS_FALSE(IOCMD_add_packed_data_tab_to_buf(
+               data_desc_buf, sizeof(data_desc_buf), packed_buf, (cntr < sizeof(packed_buf)) ? cntr : sizeof(packed_buf),
+               data, size, &table[1])))
+#endif
+            {
+               /* add data size and data table to buffer */
+               IOCMD_add_data_tab_to_buf(data_desc_buf, sizeof(data_desc_buf), data, size, &table[1]);
+            }
+
             ptr = buf;
 
             cntr = table[0].size + table[1].size + table[2].size + table[3].size;
@@ -2795,6 +6685,11 @@ void IOCMD_Log_Data_Context(
             /* log too big and will not be possible to parse it by IOCMD_Proc_Buffered_Logs; reduce logged data size */
             if(cntr > IOCMD_WORKING_BUF_RECOMMENDED_SIZE)
             {
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+               /* instead of cutting, data is stored in few logs - every one of them fits into working buffer */
+               cntr = IOCMD_set_data_fragment(data_desc_buf, sizeof(data_desc_buf), (const uint8_t*)data, size, 0U, table);
+               fragment_end = table[2].size;
+#else
                cntr -= table[2].size;
                table[2].size = IOCMD_WORKING_BUF_RECOMMENDED_SIZE - cntr;
                cntr += table[2].size;
@@ -2802,6 +6697,7 @@ void IOCMD_Log_Data_Context(
                data_desc_buf[0] = 1U;
 
                IOCMD_reduce_int_in_buf((int)(table[2].size), &data_desc_buf[1], 0U);
+#endif
             }
 
             /* exception in library - length is big endian!!! */
@@ -2810,6 +6706,15 @@ void IOCMD_Log_Data_Context(
 
             IOCMD_PROTECTION_LOCK(IOCMD_Params);
 
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+            IOCMD_staging_transfer_all();
+#endif
+
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+            /* all fragments are stored one after another in single lock so they are not mixed with other logs */
+            do
+            {
+#endif
             /* global cntr */
             buf[cntr2++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.global_cntr)) )[0];
 #if(IOCMD_LOG_GLOBAL_CNTR_SIZE > 1)
@@ -2834,9 +6739,27 @@ void IOCMD_Log_Data_Context(
             if(level <= main_level)
 #endif
             {
-               IOCMD_Params.global_cntr.main_cntr++;
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+               /* all fragments have the same main cntr */
+               if(fragment_end >= size)
+#endif
+               {
+                  IOCMD_Params.global_cntr.main_cntr++;
+               }
+            }
+
+#if(IOCMD_LOG_SINGLE_STORAGE)
+            IOCMD_set_log_targets(
+               buf,
+               ((level <= main_level) ? IOCMD_LOG_TARGET_MAIN : 0U) | ((level <= quiet_level) ? IOCMD_LOG_TARGET_QUIET : 0U));
+
+            if(BUFF_UNLIKELY(BUFF_RING_GET_FREE_SIZE(&(IOCMD_Params.quiet_ring_buf)) < (Buff_Size_DT)cntr))
+            {
+               IOCMD_reduce_buf(&(IOCMD_Params.quiet_ring_buf), (Buff_Size_DT)cntr);
             }
 
+            IOCMD_write_log(&(IOCMD_Params.quiet_ring_buf), table, Num_Elems(table), (Buff_Size_DT)cntr);
+#else
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
             if(level <= main_level)
             {
@@ -2845,14 +6768,7 @@ void IOCMD_Log_Data_Context(
                   IOCMD_reduce_buf(&(IOCMD_Params.main_ring_buf), (Buff_Size_DT)cntr);
                }
 
-               (void)Buff_Ring_Write_From_Vector(
-                  &(IOCMD_Params.main_ring_buf),
-                  table,
-                  Num_Elems(table),
-                  (Buff_Size_DT)cntr,
-                  0U,
-                  BUFF_FALSE,
-                  BUFF_FALSE);
+               IOCMD_write_log(&(IOCMD_Params.main_ring_buf), table, Num_Elems(table), (Buff_Size_DT)cntr);
             }
 #endif
 
@@ -2864,15 +6780,29 @@ void IOCMD_Log_Data_Context(
                   IOCMD_reduce_buf(&(IOCMD_Params.quiet_ring_buf), (Buff_Size_DT)cntr);
                }
 
-               (void)Buff_Ring_Write_From_Vector(
-                  &(IOCMD_Params.quiet_ring_buf),
-                  table,
-                  Num_Elems(table),
-                  (Buff_Size_DT)cntr,
-                  0U,
-                  BUFF_FALSE,
-                  BUFF_FALSE);
+               IOCMD_write_log(&(IOCMD_Params.quiet_ring_buf), table, Num_Elems(table), (Buff_Size_DT)cntr);
+            }
+#endif
+#endif
+
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+            next_fragment = IOCMD_FALSE;
+
+            if(fragment_end < size)
+            {
+               /* arguments are printed with the first fragment only */
+               table[3].size = 0U;
+
+               cntr = IOCMD_set_data_fragment(data_desc_buf, sizeof(data_desc_buf), (const uint8_t*)data, size, fragment_end, table);
+               fragment_end += table[2].size;
+
+               buf[1] = (uint8_t)cntr;
+               buf[0] = (uint8_t)(IOCMD_DIV_BY_POWER_OF_2(cntr, 8) | 0x80U);
+               cntr2  = 2U;
+
+               next_fragment = IOCMD_TRUE;
             }
+            } while(IOCMD_BOOL_IS_TRUE(next_fragment));
 #endif
 
             IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
@@ -2907,6 +6837,9 @@ void IOCMD_Log_Data_Comparision(
    uint8_t                       buf[IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH];
    uint8_t                       data1_desc_buf[IOCMD_LOG_DATA_DESC_SIZE];
    uint8_t                       data2_desc_buf[IOCMD_LOG_DATA_DESC_SIZE];
+#if(IOCMD_LOG_DATA_COMPARE_DIFF_ONLY)
+   uint8_t                       diff_buf[IOCMD_LOG_DATA_COMPARE_DIFF_MAX_SIZE];
+#endif
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
    uint_fast8_t main_level;
 #endif
@@ -2922,12 +6855,10 @@ void IOCMD_Log_Data_Comparision(
    )
    {
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
-      main_level  = IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_data[tab_id].level, IOCMD_Params.temporary_main_level)
-         | (IOCMD_Params.temporary_main_level & 0xFU);
+      main_level  = IOCMD_Params.levels_tab_effective[tab_id] & 0xFU;
 #endif
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
-      quiet_level = IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_data[tab_id].quiet_level, IOCMD_Params.temporary_quiet_level)
-         | (IOCMD_Params.temporary_quiet_level & 0xFU);
+      quiet_level = IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_effective[tab_id], 4);
 #endif
 
 #if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && (IOCMD_LOG_QUIET_BUF_SIZE > 0))
@@ -2947,17 +6878,6 @@ void IOCMD_Log_Data_Comparision(
             table[0].data = buf;
             table[0].size = cntr;
 
-            /**
-             * add data just after format string/ptr -
-             * it will be always correctly read even if "printf" argumnets were provided incorrectly
-             */
-
-            /* add data1 size and data1 table */
-            IOCMD_add_data_tab_to_buf(data1_desc_buf, sizeof(data1_desc_buf), data1, size1, &table[1]);
-
-            /* add data2 size and data2 table */
-            IOCMD_add_data_tab_to_buf(data2_desc_buf, sizeof(data2_desc_buf), data2, size2, &table[3]);
-
             table[5].data = &buf[cntr];
 
             va_start(arg, format);
@@ -2972,6 +6892,26 @@ void IOCMD_Log_Data_Comparision(
 
             table[5].size = (Buff_Size_DT)( ((const uint8_t*)(&buf[cntr])) - ((const uint8_t*)(table[5].data)) );
 
+            /**
+             * add data just after format string/ptr -
+             * it will be always correctly read even if "printf" argumnets were provided incorrectly
+             */
+#if(IOCMD_LOG_DATA_COMPARE_DIFF_ONLY)
+            /* diff must fit into working buffer of IOCMD_Proc_Buffered_Logs together with rest of the log */
+            part = IOCMD_WORKING_BUF_RECOMMENDED_SIZE - table[0].size - table[5].size - (2U * IOCMD_LOG_DATA_DESC_SIZE);
+
+            if(IOCMD_BOOL_IS_FALSE(IOCMD_add_data_diff_to_buf(
+               data1_desc_buf, data2_desc_buf, sizeof(data1_desc_buf), diff_buf, (part < sizeof(diff_buf)) ? part : sizeof(diff_buf),
+               (const uint8_t*)data1, size1, (const uint8_t*)data2, size2, table)))
+#endif
+            {
+               /* add data1 size and data1 table */
+               IOCMD_add_data_tab_to_buf(data1_desc_buf, sizeof(data1_desc_buf), data1, size1, &table[1]);
+
+               /* add data2 size and data2 table */
+               IOCMD_add_data_tab_to_buf(data2_desc_buf, sizeof(data2_desc_buf), data2, size2, &table[3]);
+            }
+
             ptr = buf;
 
             cntr = table[0].size + table[1].size + table[2].size + table[3].size + table[4].size + table[5].size;
@@ -3065,6 +7005,10 @@ void IOCMD_Log_Data_Comparision(
 
             IOCMD_PROTECTION_LOCK(IOCMD_Params);
 
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+            IOCMD_staging_transfer_all();
+#endif
+
             /* global cntr */
             buf[cntr2++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.global_cntr)) )[0];
 #if(IOCMD_LOG_GLOBAL_CNTR_SIZE > 1)
@@ -3092,6 +7036,18 @@ void IOCMD_Log_Data_Comparision(
                IOCMD_Params.global_cntr.main_cntr++;
             }
 
+#if(IOCMD_LOG_SINGLE_STORAGE)
+            IOCMD_set_log_targets(
+               buf,
+               ((level <= main_level) ? IOCMD_LOG_TARGET_MAIN : 0U) | ((level <= quiet_level) ? IOCMD_LOG_TARGET_QUIET : 0U));
+
+            if(BUFF_UNLIKELY(BUFF_RING_GET_FREE_SIZE(&(IOCMD_Params.quiet_ring_buf)) < (Buff_Size_DT)cntr))
+            {
+               IOCMD_reduce_buf(&(IOCMD_Params.quiet_ring_buf), (Buff_Size_DT)cntr);
+            }
+
+            IOCMD_write_log(&(IOCMD_Params.quiet_ring_buf), table, Num_Elems(table), (Buff_Size_DT)cntr);
+#else
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
             if(level <= main_level)
             {
@@ -3100,14 +7056,7 @@ void IOCMD_Log_Data_Comparision(
                   IOCMD_reduce_buf(&(IOCMD_Params.main_ring_buf), (Buff_Size_DT)cntr);
                }
 
-               (void)Buff_Ring_Write_From_Vector(
-                  &(IOCMD_Params.main_ring_buf),
-                  table,
-                  Num_Elems(table),
-                  (Buff_Size_DT)cntr,
-                  0U,
-                  BUFF_FALSE,
-                  BUFF_FALSE);
+               IOCMD_write_log(&(IOCMD_Params.main_ring_buf), table, Num_Elems(table), (Buff_Size_DT)cntr);
             }
 #endif
 
@@ -3119,15 +7068,9 @@ void IOCMD_Log_Data_Comparision(
                   IOCMD_reduce_buf(&(IOCMD_Params.quiet_ring_buf), (Buff_Size_DT)cntr);
                }
 
-               (void)Buff_Ring_Write_From_Vector(
-                  &(IOCMD_Params.quiet_ring_buf),
-                  table,
-                  Num_Elems(table),
-                  (Buff_Size_DT)cntr,
-                  0U,
-                  BUFF_FALSE,
-                  BUFF_FALSE);
+               IOCMD_write_log(&(IOCMD_Params.quiet_ring_buf), table, Num_Elems(table), (Buff_Size_DT)cntr);
             }
+#endif
 #endif
 
             IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
@@ -3150,12 +7093,18 @@ void IOCMD_Log_Data_Comparision(
 #if(IOCMD_SUPPORT_ENTRANCE_LOGGING)
 void IOCMD_Enter_Exit(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t enter_exit, const char *file, const char *func_name)
 {
+#if((!IOCMD_LOG_PROFILER) || IOCMD_LOG_TRACE_EXPORT)
+#if(IOCMD_LOG_COMPACT_HEADER)
+   uint8_t       record[IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_ENTRANCE_LENGTH];
+#else
    Buff_Ring_XT *ring;
+#endif
    uint8_t      *buf;
    uint_fast16_t cntr;
    uint_fast8_t  cntr2;
-#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+#if((IOCMD_LOG_QUIET_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE) && (!IOCMD_LOG_COMPACT_HEADER))
    Buff_Size_DT  first_ring_pos;
+#endif
 #endif
    uint_fast8_t  entrance_logging_state;
 
@@ -3166,9 +7115,19 @@ void IOCMD_Enter_Exit(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t e
       (tab_id < IOCMD_Params.levels_tab_size)
    )
    {
-      entrance_logging_state =
-         IOCMD_DIV_BY_POWER_OF_2(IOCMD_Params.levels_tab_data[tab_id].entrance_logging_state, IOCMD_Params.temporary_entrance_level)
-         | (IOCMD_Params.temporary_entrance_level & 0xFU);
+      entrance_logging_state = IOCMD_Params.entrances_tab_effective[tab_id];
+#if(IOCMD_LOG_PROFILER)
+      /* function enter / exit is profiled - both, enabled and quiet entrances */
+      if(entrance_logging_state > IOCMD_ENTRANCE_DISABLED)
+      {
+         if(IOCMD_LIKELY(IOCMD_CHECK_PTR(const char, func_name)))
+         {
+            IOCMD_UNUSED_PARAM(line);
+            IOCMD_profiler_enter_exit(tab_id, enter_exit, file, func_name);
+         }
+      }
+#endif
+#if((!IOCMD_LOG_PROFILER) || IOCMD_LOG_TRACE_EXPORT)
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
       if(entrance_logging_state > IOCMD_ENTRANCE_DISABLED)
 #else
@@ -3177,14 +7136,20 @@ void IOCMD_Enter_Exit(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t e
       {
          if(IOCMD_LIKELY(IOCMD_CHECK_PTR(const char, file) && IOCMD_CHECK_PTR(const char, func_name)))
          {
+#if(!IOCMD_LOG_COMPACT_HEADER)
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
             ring = &(IOCMD_Params.quiet_ring_buf);
 #else
             ring = &(IOCMD_Params.main_ring_buf);
+#endif
 #endif
 
             IOCMD_PROTECTION_LOCK(IOCMD_Params);
 
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+            IOCMD_staging_transfer_all();
+#endif
+
             if(IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_ENTRANCE_LENGTH >= 128)
             {
                cntr2 = 2U;
@@ -3194,6 +7159,10 @@ void IOCMD_Enter_Exit(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t e
                cntr2 = 1U;
             }
 
+#if(IOCMD_LOG_COMPACT_HEADER)
+            /* header is replaced by compact one when the log is copied to the buffer */
+            buf = record;
+#else
             if(BUFF_UNLIKELY(BUFF_RING_GET_FREE_SIZE(ring) < (2U * (IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_ENTRANCE_LENGTH))))
             {
                IOCMD_reduce_buf(ring, (Buff_Size_DT)(2U * (IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_ENTRANCE_LENGTH)));
@@ -3201,6 +7170,7 @@ void IOCMD_Enter_Exit(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t e
 
             buf = Buff_Ring_Data_Check_Out(
                ring, IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_ENTRANCE_LENGTH - 2U + cntr2, BUFF_FALSE, BUFF_FALSE);
+#endif
 
             cntr = IOCMD_add_standard_header_and_main_string_to_buf(
                buf, IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_ENTRANCE_LENGTH - 2U + cntr2, cntr2, line, enter_exit, file, func_name);
@@ -3216,6 +7186,12 @@ void IOCMD_Enter_Exit(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t e
                buf[0] = (uint8_t)cntr;
             }
 
+#if(IOCMD_LOG_COMPACT_HEADER)
+            IOCMD_store_log(
+               buf,
+               cntr,
+               (entrance_logging_state > IOCMD_ENTRANCE_QUIET) ? (IOCMD_LOG_TARGET_MAIN | IOCMD_LOG_TARGET_QUIET) : IOCMD_LOG_TARGET_QUIET);
+#else
             /* global cntr */
             buf[cntr2++] = ( (uint8_t*)(&(IOCMD_Params.global_cntr.global_cntr)) )[0];
 #if(IOCMD_LOG_GLOBAL_CNTR_SIZE > 1)
@@ -3243,13 +7219,25 @@ void IOCMD_Enter_Exit(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t e
                IOCMD_Params.global_cntr.main_cntr++;
             }
 
-#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+#if(IOCMD_LOG_SINGLE_STORAGE)
+            IOCMD_set_log_targets(
+               buf,
+               (entrance_logging_state > IOCMD_ENTRANCE_QUIET) ? (IOCMD_LOG_TARGET_MAIN | IOCMD_LOG_TARGET_QUIET) : IOCMD_LOG_TARGET_QUIET);
+
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+            IOCMD_index_log(ring, (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
+            (void)Buff_Ring_Data_Check_In(ring, (Buff_Size_DT)cntr, BUFF_FALSE);
+#elif(IOCMD_LOG_QUIET_BUF_SIZE > 0)
             /**
              * Function Buff_Ring_To_Ring_Copy gets offset from begining of busy size so we have to remember here busy size
              * instead result of Buff_Ring_Data_Check_In which is offset from begining of buffer memory
              */
             first_ring_pos = BUFF_RING_GET_BUSY_SIZE(ring);
 
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+            IOCMD_index_log(ring, (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
             (void)Buff_Ring_Data_Check_In(ring, (Buff_Size_DT)cntr, BUFF_FALSE);
 
             if(entrance_logging_state > IOCMD_ENTRANCE_QUIET)
@@ -3258,6 +7246,9 @@ void IOCMD_Enter_Exit(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t e
                {
                   IOCMD_reduce_buf(&(IOCMD_Params.main_ring_buf), (Buff_Size_DT)cntr);
                }
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+               IOCMD_index_log(&(IOCMD_Params.main_ring_buf), (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
                Buff_Ring_To_Ring_Copy(
                   &(IOCMD_Params.main_ring_buf),
                   &(IOCMD_Params.quiet_ring_buf),
@@ -3267,7 +7258,11 @@ void IOCMD_Enter_Exit(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t e
                   BUFF_FALSE);
             }
 #else
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+            IOCMD_index_log(ring, (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
             (void)Buff_Ring_Data_Check_In(ring, (Buff_Size_DT)cntr, BUFF_FALSE);
+#endif
 #endif
 
             IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
@@ -3283,31 +7278,55 @@ void IOCMD_Enter_Exit(IOCMD_Log_ID_DT tab_id, uint_fast16_t line, uint_fast8_t e
 #endif
          }
       }
+#endif
    }
 } /* IOCMD_Enter_Exit */
+
+void IOCMD_Exit_Scope(const IOCMD_Log_Scope_XT *scope)
+{
+   if(IOCMD_BOOL_IS_TRUE(scope->enabled))
+   {
+      IOCMD_Enter_Exit(scope->id, scope->line, IOCMD_LOG_LEVEL_EXT_EXIT, scope->file, scope->func_name);
+   }
+} /* IOCMD_Exit_Scope */
 #endif
 
 #if (IOCMD_LOG_PRINT_OS_CONTEXT && IOCMD_LOGS_TREE_OS_LOG_CONTEXT_SWITCH)
 void IOCMD_Os_Switch_Context(IOCMD_Context_ID_DT previous_service, IOCMD_Context_ID_DT next_service)
 {
+#if(IOCMD_LOG_COMPACT_HEADER)
+   uint8_t       record[IOCMD_LOG_OS_SWITCH_CONTEXT_DESC_SIZE];
+#else
    Buff_Ring_XT *ring;
+#endif
    uint8_t      *buf;
 #if (IOCMD_LOG_PRINT_TIME)
    IOCMD_Time_DT time = IOCMD_OS_GET_CURRENT_TIME();
 #endif
    uint_fast8_t  cntr = 1U;
-#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+#if((IOCMD_LOG_QUIET_BUF_SIZE > 0) && (!IOCMD_LOG_SINGLE_STORAGE) && (!IOCMD_LOG_COMPACT_HEADER))
    Buff_Size_DT  first_ring_pos;
 #endif
 
+#if(!IOCMD_LOG_COMPACT_HEADER)
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
    ring = &(IOCMD_Params.quiet_ring_buf);
 #else
    ring = &(IOCMD_Params.main_ring_buf);
+#endif
 #endif
 
    IOCMD_PROTECTION_LOCK(IOCMD_Params);
 
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+   IOCMD_staging_transfer_all();
+#endif
+
+#if(IOCMD_LOG_COMPACT_HEADER)
+   /* header is replaced by compact one when the log is copied to the buffer; global counters are added there too */
+   buf = record;
+   cntr += IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_GLOBAL_CNTR_SIZE;
+#else
    if(BUFF_UNLIKELY(BUFF_RING_GET_FREE_SIZE(ring) < (2U * IOCMD_LOG_OS_SWITCH_CONTEXT_DESC_SIZE)))
    {
       IOCMD_reduce_buf(ring, (Buff_Size_DT)(2U * IOCMD_LOG_OS_SWITCH_CONTEXT_DESC_SIZE));
@@ -3338,6 +7357,7 @@ void IOCMD_Os_Switch_Context(IOCMD_Context_ID_DT previous_service, IOCMD_Context
    {
       IOCMD_Params.global_cntr.main_cntr++;
    }
+#endif
 
 #if (IOCMD_LOG_PRINT_TIME)
    /* time - 1 to 8 bytes; depend on time size */
@@ -3352,13 +7372,30 @@ void IOCMD_Os_Switch_Context(IOCMD_Context_ID_DT previous_service, IOCMD_Context
 
    buf[0] = (uint8_t)cntr;
 
-#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+#if(IOCMD_LOG_COMPACT_HEADER)
+   IOCMD_store_log(
+      buf,
+      cntr,
+      (IOCMD_ENTRANCE_ENABLED == *IOCMD_Os_Critical_Switch) ? (IOCMD_LOG_TARGET_MAIN | IOCMD_LOG_TARGET_QUIET) : IOCMD_LOG_TARGET_QUIET);
+#elif(IOCMD_LOG_SINGLE_STORAGE)
+   IOCMD_set_log_targets(
+      buf,
+      (IOCMD_ENTRANCE_ENABLED == *IOCMD_Os_Critical_Switch) ? (IOCMD_LOG_TARGET_MAIN | IOCMD_LOG_TARGET_QUIET) : IOCMD_LOG_TARGET_QUIET);
+
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+   IOCMD_index_log(ring, (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
+   (void)Buff_Ring_Data_Check_In(ring, (Buff_Size_DT)cntr, BUFF_FALSE);
+#elif(IOCMD_LOG_QUIET_BUF_SIZE > 0)
    /**
     * Function Buff_Ring_To_Ring_Copy gets offset from begining of busy size fo we have to remember here busy size
     * instead result of Buff_Ring_Data_Check_In which is offset from begining of buffer memory
     */
    first_ring_pos = BUFF_RING_GET_BUSY_SIZE(ring);
 
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+   IOCMD_index_log(ring, (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
    (void)Buff_Ring_Data_Check_In(ring, (Buff_Size_DT)cntr, BUFF_FALSE);
 
    if(IOCMD_ENTRANCE_ENABLED == *IOCMD_Os_Critical_Switch)
@@ -3367,6 +7404,9 @@ void IOCMD_Os_Switch_Context(IOCMD_Context_ID_DT previous_service, IOCMD_Context
       {
          IOCMD_reduce_buf(&(IOCMD_Params.main_ring_buf), (Buff_Size_DT)cntr);
       }
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+      IOCMD_index_log(&(IOCMD_Params.main_ring_buf), (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
       Buff_Ring_To_Ring_Copy(
          &(IOCMD_Params.main_ring_buf),
          &(IOCMD_Params.quiet_ring_buf),
@@ -3376,6 +7416,9 @@ void IOCMD_Os_Switch_Context(IOCMD_Context_ID_DT previous_service, IOCMD_Context
          BUFF_FALSE);
    }
 #else
+#if(IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE > 0)
+   IOCMD_index_log(ring, (Buff_Size_DT)cntr, IOCMD_TRUE);
+#endif
    (void)Buff_Ring_Data_Check_In(ring, (Buff_Size_DT)cntr, BUFF_FALSE);
 #endif
 
@@ -3393,12 +7436,17 @@ void IOCMD_Os_Switch_Context(IOCMD_Context_ID_DT previous_service, IOCMD_Context
 } /* IOCMD_Os_Switch_Context */
 #endif
 
-void IOCMD_Proc_Buffered_Logs(IOCMD_Bool_DT print_quiet_logs, const IOCMD_Print_Exe_Params_XT *exe, uint8_t *working_buf, uint_fast16_t working_buf_size)
+static void IOCMD_proc_buffered_logs(
+   IOCMD_Bool_DT print_quiet_logs, const IOCMD_Print_Exe_Params_XT *exe, uint8_t *working_buf, uint_fast16_t working_buf_size, IOCMD_Bool_DT trace)
 {
-#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+#if(IOCMD_LOG_SINGLE_STORAGE)
+   IOCMD_Bool_DT print_log;
+   uint8_t targets;
+#else
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && ((IOCMD_LOG_QUIET_BUF_SIZE > 0) || (!IOCMD_LOG_COMPACT_HEADER)))
    IOCMD_global_cntr_DT main_buf_global_cntr;
 #endif
-#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+#if((IOCMD_LOG_QUIET_BUF_SIZE > 0) && ((IOCMD_LOG_MAIN_BUF_SIZE > 0) || (!IOCMD_LOG_COMPACT_HEADER)))
    IOCMD_global_cntr_DT quiet_buf_global_cntr;
 #endif
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
@@ -3407,14 +7455,26 @@ void IOCMD_Proc_Buffered_Logs(IOCMD_Bool_DT print_quiet_logs, const IOCMD_Print_
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
    Buff_Size_DT len_quiet;
 #endif
-   Buff_Size_DT len;
+#if(!IOCMD_LOG_COMPACT_HEADER)
    uint8_t temp[2 + IOCMD_LOG_GLOBAL_CNTR_SIZE];
+#endif
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
    uint8_t offset_main;
 #endif
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
    uint8_t offset_quiet;
 #endif
+#endif
+#if(IOCMD_LOG_COMPACT_HEADER)
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+   IOCMD_Compact_Header_XT header_main;
+#endif
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+   IOCMD_Compact_Header_XT header_quiet;
+#endif
+   const IOCMD_Compact_Header_XT *header = IOCMD_MAKE_INVALID_PTR(const IOCMD_Compact_Header_XT);
+#endif
+   Buff_Size_DT len;
    uint8_t offset;
    IOCMD_Bool_DT is_quiet_log = IOCMD_FALSE;
    IOCMD_Bool_DT continue_reading = IOCMD_FALSE;
@@ -3422,6 +7482,9 @@ void IOCMD_Proc_Buffered_Logs(IOCMD_Bool_DT print_quiet_logs, const IOCMD_Print_
 #if(0 == IOCMD_LOG_QUIET_BUF_SIZE)
       IOCMD_UNUSED_PARAM(print_quiet_logs);
 #endif
+#if(!IOCMD_LOG_TRACE_EXPORT)
+      IOCMD_UNUSED_PARAM(trace);
+#endif
 
    /* check function params */
    if(IOCMD_CHECK_PTR(const IOCMD_Print_Exe_Params_XT, exe) && (IOCMD_Params.levels_tab_size > 0U))
@@ -3435,8 +7498,16 @@ void IOCMD_Proc_Buffered_Logs(IOCMD_Bool_DT print_quiet_logs, const IOCMD_Print_
          /* acivate buffers protection */
          IOCMD_PROTECTION_LOCK(IOCMD_Params);
 
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+         IOCMD_staging_transfer();
+#endif
+
          /* check if there is any data in main or quiet buffer to be processed */
          if(
+#if(IOCMD_LOG_SINGLE_STORAGE)
+            (IOCMD_Params.main_read_pos < BUFF_RING_GET_BUSY_SIZE(&(IOCMD_Params.quiet_ring_buf)))
+            || (IOCMD_BOOL_IS_TRUE(print_quiet_logs) && (!BUFF_RING_IS_EMPTY(&(IOCMD_Params.quiet_ring_buf))))
+#else
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
             (!BUFF_RING_IS_EMPTY(&(IOCMD_Params.main_ring_buf)))
 #endif
@@ -3445,12 +7516,109 @@ void IOCMD_Proc_Buffered_Logs(IOCMD_Bool_DT print_quiet_logs, const IOCMD_Print_
 #endif
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
             (IOCMD_BOOL_IS_TRUE(print_quiet_logs) && (!BUFF_RING_IS_EMPTY(&(IOCMD_Params.quiet_ring_buf))))
+#endif
 #endif
          )
          {
             do
             {
-#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+#if(IOCMD_LOG_SINGLE_STORAGE)
+               if(IOCMD_BOOL_IS_TRUE(print_quiet_logs))
+               {
+                  /**
+                   * all logs are processed from the oldest one; logs which were already processed as main logs
+                   * are printed as quiet logs, same as when they are left only in quiet buffer
+                   */
+#if(IOCMD_LOG_COMPACT_HEADER)
+                  len = IOCMD_peak_compact_log(
+                     &(IOCMD_Params.quiet_ring_buf), 0U, &(IOCMD_Params.quiet_compact.reader), &header_quiet, &offset);
+                  targets = (uint8_t)IOCMD_DIV_BY_POWER_OF_2(header_quiet.level, IOCMD_LOG_TARGETS_IN_LEVEL_SHIFT);
+                  header  = &header_quiet;
+                  IOCMD_Params.quiet_compact.reader = header_quiet;
+#else
+                  len = IOCMD_peak_log_targets(0U, &targets);
+#endif
+
+                  if(IOCMD_Params.main_read_pos > 0U)
+                  {
+                     print_log    = (0U != (targets & IOCMD_LOG_TARGET_QUIET)) ? IOCMD_TRUE : IOCMD_FALSE;
+                     is_quiet_log = IOCMD_TRUE;
+                     IOCMD_Params.main_read_pos -= len;
+                  }
+                  else
+                  {
+                     print_log    = IOCMD_TRUE;
+                     is_quiet_log = (0U == (targets & IOCMD_LOG_TARGET_MAIN)) ? IOCMD_TRUE : IOCMD_FALSE;
+#if(IOCMD_LOG_COMPACT_HEADER)
+                     /* main logs reading position stays at the begining of the buffer - after removed log */
+                     IOCMD_Params.main_compact.reader = header_quiet;
+#endif
+                  }
+
+                  if(IOCMD_BOOL_IS_TRUE(print_log) && (len <= working_buf_size))
+                  {
+                     (void)Buff_Ring_Read(&(IOCMD_Params.quiet_ring_buf), working_buf, len, BUFF_FALSE);
+                  }
+                  else
+                  {
+                     (void)Buff_Ring_Remove(&(IOCMD_Params.quiet_ring_buf), len, BUFF_FALSE);
+                     print_log = IOCMD_FALSE;
+                  }
+               }
+               else
+               {
+                  /* main logs are only read - they are removed when they are not needed by quiet logs anymore */
+#if(IOCMD_LOG_COMPACT_HEADER)
+                  len = IOCMD_peak_compact_log(
+                     &(IOCMD_Params.quiet_ring_buf),
+                     IOCMD_Params.main_read_pos,
+                     &(IOCMD_Params.main_compact.reader),
+                     &header_main,
+                     &offset);
+                  targets = (uint8_t)IOCMD_DIV_BY_POWER_OF_2(header_main.level, IOCMD_LOG_TARGETS_IN_LEVEL_SHIFT);
+                  header  = &header_main;
+                  IOCMD_Params.main_compact.reader = header_main;
+#else
+                  len = IOCMD_peak_log_targets(IOCMD_Params.main_read_pos, &targets);
+#endif
+
+                  print_log    = (0U != (targets & IOCMD_LOG_TARGET_MAIN)) ? IOCMD_TRUE : IOCMD_FALSE;
+                  is_quiet_log = IOCMD_FALSE;
+
+                  if(IOCMD_BOOL_IS_TRUE(print_log) && (len <= working_buf_size))
+                  {
+                     (void)Buff_Ring_Peak(&(IOCMD_Params.quiet_ring_buf), working_buf, len, IOCMD_Params.main_read_pos, BUFF_FALSE);
+                  }
+                  else
+                  {
+                     print_log = IOCMD_FALSE;
+                  }
+
+                  IOCMD_Params.main_read_pos += len;
+
+                  IOCMD_remove_processed_main_logs();
+               }
+
+               if(IOCMD_BOOL_IS_TRUE(print_log))
+               {
+                  offset = (0U != (working_buf[0] & 0x80U)) ? 2U : 1U;
+#if(!IOCMD_LOG_COMPACT_HEADER)
+                  working_buf[offset + IOCMD_LOG_LEVEL_POS] &= (uint8_t)(~IOCMD_LOG_TARGETS_IN_LEVEL_MASK);
+#endif
+               }
+               else
+               {
+                  len    = 0U;
+                  offset = 0U;
+               }
+#else
+#if((IOCMD_LOG_MAIN_BUF_SIZE > 0) && IOCMD_LOG_COMPACT_HEADER)
+               len_main = IOCMD_peak_compact_log(
+                  &(IOCMD_Params.main_ring_buf), 0U, &(IOCMD_Params.main_compact.reader), &header_main, &offset_main);
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+               main_buf_global_cntr = (len_main > 0U) ? header_main.global_cntr : (IOCMD_global_cntr_DT)(-1);
+#endif
+#elif(IOCMD_LOG_MAIN_BUF_SIZE > 0)
                offset_main = 1U;
                len_main    = 0U;
 
@@ -3478,7 +7646,24 @@ void IOCMD_Proc_Buffered_Logs(IOCMD_Bool_DT print_quiet_logs, const IOCMD_Print_
                }
 #endif
 
-#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+#if((IOCMD_LOG_QUIET_BUF_SIZE > 0) && IOCMD_LOG_COMPACT_HEADER)
+               len_quiet = 0U;
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+               quiet_buf_global_cntr = (IOCMD_global_cntr_DT)(-1);
+#endif
+
+               if(IOCMD_BOOL_IS_TRUE(print_quiet_logs))
+               {
+                  len_quiet = IOCMD_peak_compact_log(
+                     &(IOCMD_Params.quiet_ring_buf), 0U, &(IOCMD_Params.quiet_compact.reader), &header_quiet, &offset_quiet);
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+                  if(len_quiet > 0U)
+                  {
+                     quiet_buf_global_cntr = header_quiet.global_cntr;
+                  }
+#endif
+               }
+#elif(IOCMD_LOG_QUIET_BUF_SIZE > 0)
                offset_quiet = 1U;
                len_quiet    = 0U;
 
@@ -3590,18 +7775,69 @@ void IOCMD_Proc_Buffered_Logs(IOCMD_Bool_DT print_quiet_logs, const IOCMD_Print_
                }
 #endif
 
+#if(IOCMD_LOG_COMPACT_HEADER)
+               /* headers of logs removed from the buffers are base for the next ones */
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+               if((len_quiet > 0U)
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+                  && (quiet_buf_global_cntr <= main_buf_global_cntr)
+#endif
+                  )
+               {
+                  IOCMD_Params.quiet_compact.reader = header_quiet;
+                  header = &header_quiet;
+               }
+#endif
+#if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
+               if((len_main > 0U)
+#if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
+                  && (quiet_buf_global_cntr >= main_buf_global_cntr)
+#endif
+                  )
+               {
+                  IOCMD_Params.main_compact.reader = header_main;
+                  header = &header_main;
+               }
+#endif
+#endif
+#endif
+
+#if(IOCMD_LOG_COMPACT_HEADER)
+               if(len > 0U)
+               {
+                  len = IOCMD_compact_header_expand(working_buf, len, offset, working_buf_size, header);
+               }
+#endif
+
                IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
 
                if(len >= (IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_GLOBAL_CNTR_SIZE + IOCMD_LOG_HEADER_TIME_PART_SIZE))
                {
-                  IOCMD_proc_one_buffered_log(&working_buf[offset], len - offset, is_quiet_log, exe);
+#if(IOCMD_LOG_TRACE_EXPORT)
+                  if(IOCMD_BOOL_IS_TRUE(trace))
+                  {
+                     IOCMD_proc_one_trace_log(&working_buf[offset], len - offset, exe);
+                  }
+                  else
+#endif
+                  {
+                     IOCMD_proc_one_buffered_log(&working_buf[offset], len - offset, is_quiet_log, exe);
+                  }
                }
 
                IOCMD_PROTECTION_LOCK(IOCMD_Params);
 
+#if(IOCMD_LOG_LOCK_FREE_STAGING)
+               IOCMD_staging_transfer();
+#endif
+
                continue_reading = IOCMD_FALSE;
 
                if(
+#if(IOCMD_LOG_SINGLE_STORAGE)
+                  (IOCMD_Params.main_read_pos < BUFF_RING_GET_BUSY_SIZE(&(IOCMD_Params.quiet_ring_buf)))
+                  || (IOCMD_BOOL_IS_TRUE(print_quiet_logs) && (!BUFF_RING_IS_EMPTY(&(IOCMD_Params.quiet_ring_buf))))
+#else
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
                   (!BUFF_RING_IS_EMPTY(&(IOCMD_Params.main_ring_buf)))
 #endif
@@ -3610,6 +7846,7 @@ void IOCMD_Proc_Buffered_Logs(IOCMD_Bool_DT print_quiet_logs, const IOCMD_Print_
 #endif
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
                   (IOCMD_BOOL_IS_TRUE(print_quiet_logs) && (!BUFF_RING_IS_EMPTY(&(IOCMD_Params.quiet_ring_buf))))
+#endif
 #endif
                )
                {
@@ -3621,8 +7858,30 @@ void IOCMD_Proc_Buffered_Logs(IOCMD_Bool_DT print_quiet_logs, const IOCMD_Print_
          IOCMD_PROTECTION_UNLOCK(IOCMD_Params);
       }
    }
+} /* IOCMD_proc_buffered_logs */
+
+void IOCMD_Proc_Buffered_Logs(IOCMD_Bool_DT print_quiet_logs, const IOCMD_Print_Exe_Params_XT *exe, uint8_t *working_buf, uint_fast16_t working_buf_size)
+{
+   IOCMD_proc_buffered_logs(print_quiet_logs, exe, working_buf, working_buf_size, IOCMD_FALSE);
 }
 
+#if(IOCMD_LOG_TRACE_EXPORT)
+void IOCMD_Proc_Buffered_Logs_Trace(
+   IOCMD_Bool_DT print_quiet_logs, IOCMD_Bool_DT begin_trace, const IOCMD_Print_Exe_Params_XT *exe, uint8_t *working_buf, uint_fast16_t working_buf_size)
+{
+   if(IOCMD_BOOL_IS_TRUE(begin_trace) && IOCMD_CHECK_PTR(const IOCMD_Print_Exe_Params_XT, exe))
+   {
+      if(IOCMD_CHECK_HANDLER(IOCMD_Print_Text, exe->print_string)
+         && IOCMD_CHECK_HANDLER(IOCMD_Print_Endline_Repeat, exe->print_endl_repeat))
+      {
+         IOCMD_Oprintf_Line(exe, "[");
+      }
+   }
+
+   IOCMD_proc_buffered_logs(print_quiet_logs, exe, working_buf, working_buf_size, IOCMD_TRUE);
+} /* IOCMD_Proc_Buffered_Logs_Trace */
+#endif
+
 
 void IOCMD_Install_Immediate_Logs_Processor(const IOCMD_Print_Exe_Params_XT *exe, uint8_t *working_buf, uint_fast16_t working_buf_size)
 {
@@ -3638,6 +7897,8 @@ void IOCMD_Set_Temporary_Main_Level(uint8_t level)
 {
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
    IOCMD_Params.temporary_main_level    = level | 0x10U;
+
+   IOCMD_Log_Refresh_Tree_State();
 #endif
 }
 
@@ -3648,6 +7909,8 @@ void IOCMD_Set_Temporary_Quiet_Level(uint8_t level)
    IOCMD_UNUSED_PARAM(level);
 #else
    IOCMD_Params.temporary_quiet_level   = level | 0x10U;
+
+   IOCMD_Log_Refresh_Tree_State();
 #endif
 }
 
@@ -3655,6 +7918,8 @@ void IOCMD_Set_Temporary_Quiet_Level(uint8_t level)
 void IOCMD_Set_Temporary_Entrances_Level(uint8_t level)
 {
    IOCMD_Params.temporary_entrance_level= level | 0x10U;
+
+   IOCMD_Log_Refresh_Tree_State();
 }
 
 
@@ -3662,6 +7927,8 @@ void IOCMD_Clear_Temporary_Main_Level(void)
 {
 #if(IOCMD_LOG_MAIN_BUF_SIZE > 0)
    IOCMD_Params.temporary_main_level    = 0U;
+
+   IOCMD_Log_Refresh_Tree_State();
 #endif
 }
 
@@ -3670,6 +7937,8 @@ void IOCMD_Clear_Temporary_Quiet_Level(void)
 {
 #if(IOCMD_LOG_QUIET_BUF_SIZE > 0)
    IOCMD_Params.temporary_quiet_level   = 0U;
+
+   IOCMD_Log_Refresh_Tree_State();
 #endif
 }
 
@@ -3677,6 +7946,8 @@ void IOCMD_Clear_Temporary_Quiet_Level(void)
 void IOCMD_Clear_Temporary_Entrances_Level(void)
 {
    IOCMD_Params.temporary_entrance_level= 0U;
+
+   IOCMD_Log_Refresh_Tree_State();
 }
 
 
@@ -3689,6 +7960,8 @@ void IOCMD_Set_All_Logs(uint8_t level, uint8_t quiet_level)
       IOCMD_Params.levels_tab_data[i].level        = level;
       IOCMD_Params.levels_tab_data[i].quiet_level  = quiet_level;
    }
+
+   IOCMD_Log_Refresh_Tree_State();
 }
 
 
@@ -3700,4 +7973,6 @@ void IOCMD_Set_All_Entrances(uint8_t entrance_level)
    {
       IOCMD_Params.levels_tab_data[i].entrance_logging_state  = entrance_level;
    }
+
+   IOCMD_Log_Refresh_Tree_State();
 }
@@ -28,6 +28,11 @@
 #include "iocmd.h"
 #include "iocmd_out_internal.h"
 
+#if(IOCMD_OUT_USE_BUFFERED_EXE && IOCMD_OUT_BUFFERED_EXE_SUPPORT_POSIX_FD)
+#include <unistd.h>
+#include <errno.h>
+#endif
+
 typedef struct IOCMD_sprintf_dev_Tag
 {
    char  *buf;
@@ -38,64 +43,113 @@ typedef struct IOCMD_sprintf_dev_Tag
 static const IOCMD_Print_Exe_Params_XT *iocmd_standard_out_exe = IOCMD_MAKE_INVALID_PTR(const IOCMD_Print_Exe_Params_XT);
 
 
+#if(IOCMD_OUT_USE_SNPRINTF || IOCMD_OUT_USE_BUFFERED_EXE)
+static int IOCMD_out_strlen(const char *string, int max_len)
+{
+   int result;
+
+   for(result = 0; (result < max_len) && (0 != string[result]); result++)
+   {
+      ;
+   }
+
+   return result;
+} /* IOCMD_out_strlen */
+#endif
+
+
 #if(IOCMD_OUT_USE_SNPRINTF)
-static int IOCMD_sprintf_print_text(void *dev, const char *string)
+/**
+ * result_pos is position in the virtual, unlimited output - only part which fits into buf_size is copied to the buffer;
+ * thanks to that IOCMD_Vsnprintf returns length of whole output, like C99 vsnprintf
+ */
+static void IOCMD_sprintf_append(IOCMD_sprintf_dev_T *sdev, const char *data, size_t size)
 {
-   IOCMD_sprintf_dev_T *sdev = (IOCMD_sprintf_dev_T*)dev;
-   char                *to   = &(sdev->buf[sdev->result_pos]);
-   int                  result;
+   size_t part;
 
-   for(result = 0; (result < IOCMD_MAX_STRING_LENGTH) && (0 != string[result]) && (sdev->result_pos < sdev->buf_size); result++)
+   if(sdev->result_pos < sdev->buf_size)
    {
-      to[result] = string[result];
-      sdev->result_pos += 1;
+      part = sdev->buf_size - sdev->result_pos;
+
+      if(part > size)
+      {
+         part = size;
+      }
+
+      memcpy(&(sdev->buf[sdev->result_pos]), data, part);
    }
 
+   sdev->result_pos += size;
+} /* IOCMD_sprintf_append */
+
+static void IOCMD_sprintf_fill(IOCMD_sprintf_dev_T *sdev, char fill, size_t size)
+{
+   size_t part;
+
+   if(sdev->result_pos < sdev->buf_size)
+   {
+      part = sdev->buf_size - sdev->result_pos;
+
+      if(part > size)
+      {
+         part = size;
+      }
+
+      memset(&(sdev->buf[sdev->result_pos]), fill, part);
+   }
+
+   sdev->result_pos += size;
+} /* IOCMD_sprintf_fill */
+
+static int IOCMD_sprintf_print_text(void *dev, const char *string)
+{
+   int result = IOCMD_out_strlen(string, IOCMD_MAX_STRING_LENGTH);
+
+   IOCMD_sprintf_append((IOCMD_sprintf_dev_T*)dev, string, (size_t)result);
+
    return result;
 } /* IOCMD_sprintf_print_text */
 
 static int IOCMD_sprintf_print_text_repeat(void *dev, const char *string, int num_repeats)
 {
-   IOCMD_sprintf_dev_T *sdev = (IOCMD_sprintf_dev_T*)dev;
-   char                *to;
-   int                  total_result = 0;
-   int                  result;
+   IOCMD_sprintf_dev_T *sdev   = (IOCMD_sprintf_dev_T*)dev;
+   int                  len    = IOCMD_out_strlen(string, IOCMD_MAX_STRING_LENGTH);
+   int                  result = 0;
 
-   while((num_repeats > 0) && (sdev->result_pos < sdev->buf_size))
+   if((1 == len) && (num_repeats > 0))
    {
-      to = &(sdev->buf[sdev->result_pos]);
+      /* padding - single character repeated */
+      IOCMD_sprintf_fill(sdev, string[0], (size_t)num_repeats);
 
-      for(result = 0; (result < IOCMD_MAX_STRING_LENGTH) && (0 != string[result]) && (sdev->result_pos < sdev->buf_size); result++)
+      result = num_repeats;
+   }
+   else if(len > 0)
+   {
+      while(num_repeats > 0)
       {
-         to[result] = string[result];
-         sdev->result_pos += 1;
-      }
+         IOCMD_sprintf_append(sdev, string, (size_t)len);
 
-      total_result += result;
-
-      num_repeats--;
+         result += len;
+         num_repeats--;
+      }
    }
 
-   return total_result;
+   return result;
 } /* IOCMD_sprintf_print_text_repeat */
 
 static int IOCMD_sprintf_print_text_len(void *dev, const char *string, int str_len)
 {
-   IOCMD_sprintf_dev_T *sdev = (IOCMD_sprintf_dev_T*)dev;
-   char                *to   = &(sdev->buf[sdev->result_pos]);
-   int                  result;
-   int                  len  = IOCMD_MAX_STRING_LENGTH;
+   int result;
+   int len = IOCMD_MAX_STRING_LENGTH;
 
    if(str_len > 0)
    {
       len = str_len;
    }
 
-   for(result = 0; (result < len) && (0 != string[result]) && (sdev->result_pos < sdev->buf_size); result++)
-   {
-      to[result] = string[result];
-      sdev->result_pos += 1;
-   }
+   result = IOCMD_out_strlen(string, len);
+
+   IOCMD_sprintf_append((IOCMD_sprintf_dev_T*)dev, string, (size_t)result);
 
    return result;
 } /* IOCMD_sprintf_print_text_len */
@@ -103,18 +157,10 @@ static int IOCMD_sprintf_print_text_len(void *dev, const char *string, int str_l
 void IOCMD_sprintf_print_endline_repeat(void *dev, int num_repeats)
 {
    IOCMD_sprintf_dev_T *sdev = (IOCMD_sprintf_dev_T*)dev;
-   char                *to;
-   int                  result;
 
-   while((num_repeats > 0) && (sdev->result_pos < sdev->buf_size))
+   while(num_repeats > 0)
    {
-      to = &(sdev->buf[sdev->result_pos]);
-
-      for(result = 0; (result < IOCMD_MAX_STRING_LENGTH) && (0 != IOCMD_ENDLINE[result]) && (sdev->result_pos < sdev->buf_size); result++)
-      {
-         to[result] = IOCMD_ENDLINE[result];
-         sdev->result_pos += 1;
-      }
+      IOCMD_sprintf_append(sdev, IOCMD_ENDLINE, sizeof(IOCMD_ENDLINE) - 1);
 
       num_repeats--;
    }
@@ -135,7 +181,7 @@ int IOCMD_Snprintf(char *buf, size_t buf_size, const char *format, ...)
    va_list arguments;
    int result = 0;
 
-   if(IOCMD_CHECK_PTR(const char, format) && IOCMD_CHECK_PTR(char, buf) && (buf_size > 0))
+   if(IOCMD_CHECK_PTR(const char, format) && (IOCMD_CHECK_PTR(char, buf) || (0 == buf_size)))
    {
       va_start(arguments, format);
 
@@ -156,12 +202,11 @@ int IOCMD_Vsnprintf(char *buf, size_t buf_size, const char *format, va_list arg)
 
    dev.result_pos = 0;
 
-   if(IOCMD_CHECK_PTR(const char, format) && IOCMD_CHECK_PTR(char, buf) && (buf_size > 0))
+   if(IOCMD_CHECK_PTR(const char, format) && (IOCMD_CHECK_PTR(char, buf) || (0 == buf_size)))
    {
-      buf_size--;
-
+      /* buf_size 0 - nothing is written, only length of the output is computed */
       dev.buf                 = buf;
-      dev.buf_size            = buf_size;
+      dev.buf_size            = (buf_size > 0) ? (buf_size - 1) : 0;
       exe.dev                 = &dev;
       exe.print_string        = IOCMD_sprintf_print_text;
       exe.print_string_repeat = IOCMD_sprintf_print_text_repeat;
@@ -173,7 +218,10 @@ int IOCMD_Vsnprintf(char *buf, size_t buf_size, const char *format, va_list arg)
 
       (void)IOCMD_Proc_Main_Loop(format, &params, arg, IOCMD_TRUE);
 
-      buf[dev.result_pos] = '\0';
+      if(buf_size > 0)
+      {
+         buf[(dev.result_pos < dev.buf_size) ? dev.result_pos : dev.buf_size] = '\0';
+      }
    }
 
    return((int)(dev.result_pos));
@@ -400,3 +448,221 @@ int IOCMD_Voprintf_Line(const IOCMD_Print_Exe_Params_XT *exe, const char *format
 } /* IOCMD_Voprintf_Line */
 #endif
 
+
+
+#if(IOCMD_OUT_USE_BUFFERED_EXE)
+static void IOCMD_buffered_exe_append(IOCMD_Buffered_Exe_XT *bexe, const char *data, int size)
+{
+   int part;
+
+   if((0 == bexe->used) && (size >= bexe->buf_size))
+   {
+      /* nothing collected and data doesn't fit into staging buffer - pass it to the device without copying */
+      (void)bexe->output(bexe->sink, data, size);
+      bexe->num_writes++;
+   }
+   else
+   {
+      while(size > 0)
+      {
+         if(bexe->used >= bexe->buf_size)
+         {
+            (void)IOCMD_Buffered_Exe_Flush(bexe);
+         }
+
+         part = bexe->buf_size - bexe->used;
+
+         if(part > size)
+         {
+            part = size;
+         }
+
+         memcpy(&(bexe->buf[bexe->used]), data, (size_t)part);
+
+         bexe->used += part;
+         data        = &data[part];
+         size       -= part;
+      }
+   }
+} /* IOCMD_buffered_exe_append */
+
+static void IOCMD_buffered_exe_fill(IOCMD_Buffered_Exe_XT *bexe, char fill, int size)
+{
+   int part;
+
+   while(size > 0)
+   {
+      if(bexe->used >= bexe->buf_size)
+      {
+         (void)IOCMD_Buffered_Exe_Flush(bexe);
+      }
+
+      part = bexe->buf_size - bexe->used;
+
+      if(part > size)
+      {
+         part = size;
+      }
+
+      memset(&(bexe->buf[bexe->used]), fill, (size_t)part);
+
+      bexe->used += part;
+      size       -= part;
+   }
+} /* IOCMD_buffered_exe_fill */
+
+static int IOCMD_buffered_exe_print_text(void *dev, const char *string)
+{
+   int result = IOCMD_out_strlen(string, IOCMD_MAX_STRING_LENGTH);
+
+   IOCMD_buffered_exe_append((IOCMD_Buffered_Exe_XT*)dev, string, result);
+
+   return result;
+} /* IOCMD_buffered_exe_print_text */
+
+static int IOCMD_buffered_exe_print_text_repeat(void *dev, const char *string, int num_repeats)
+{
+   IOCMD_Buffered_Exe_XT *bexe   = (IOCMD_Buffered_Exe_XT*)dev;
+   int                    len    = IOCMD_out_strlen(string, IOCMD_MAX_STRING_LENGTH);
+   int                    result = 0;
+
+   if((1 == len) && (num_repeats > 0))
+   {
+      /* padding - single character repeated */
+      IOCMD_buffered_exe_fill(bexe, string[0], num_repeats);
+
+      result = num_repeats;
+   }
+   else if(len > 0)
+   {
+      while(num_repeats > 0)
+      {
+         IOCMD_buffered_exe_append(bexe, string, len);
+
+         result += len;
+         num_repeats--;
+      }
+   }
+
+   return result;
+} /* IOCMD_buffered_exe_print_text_repeat */
+
+static int IOCMD_buffered_exe_print_text_len(void *dev, const char *string, int str_len)
+{
+   int result;
+   int len = IOCMD_MAX_STRING_LENGTH;
+
+   if(str_len > 0)
+   {
+      len = str_len;
+   }
+
+   result = IOCMD_out_strlen(string, len);
+
+   IOCMD_buffered_exe_append((IOCMD_Buffered_Exe_XT*)dev, string, result);
+
+   return result;
+} /* IOCMD_buffered_exe_print_text_len */
+
+static void IOCMD_buffered_exe_print_endline_repeat(void *dev, int num_repeats)
+{
+   IOCMD_Buffered_Exe_XT *bexe = (IOCMD_Buffered_Exe_XT*)dev;
+
+   if(num_repeats > 0)
+   {
+      do
+      {
+         IOCMD_buffered_exe_append(bexe, IOCMD_ENDLINE, (int)(sizeof(IOCMD_ENDLINE) - 1));
+
+         num_repeats--;
+      }while(num_repeats > 0);
+
+      (void)IOCMD_Buffered_Exe_Flush(bexe);
+   }
+} /* IOCMD_buffered_exe_print_endline_repeat */
+
+static void IOCMD_buffered_exe_print_cariage_return(void *dev)
+{
+   IOCMD_buffered_exe_append((IOCMD_Buffered_Exe_XT*)dev, IOCMD_CARIAGE_RETURN, (int)(sizeof(IOCMD_CARIAGE_RETURN) - 1));
+} /* IOCMD_buffered_exe_print_cariage_return */
+
+
+void IOCMD_Buffered_Exe_Init(IOCMD_Buffered_Exe_XT *bexe, char *buf, size_t buf_size, IOCMD_Buffered_Exe_Write output, void *sink)
+{
+   if(IOCMD_CHECK_PTR(IOCMD_Buffered_Exe_XT, bexe) && IOCMD_CHECK_PTR(char, buf) && (buf_size > 0)
+      && IOCMD_CHECK_HANDLER(IOCMD_Buffered_Exe_Write, output))
+   {
+      bexe->exe.dev                  = bexe;
+      bexe->exe.print_string         = IOCMD_buffered_exe_print_text;
+      bexe->exe.print_string_repeat  = IOCMD_buffered_exe_print_text_repeat;
+      bexe->exe.print_string_len     = IOCMD_buffered_exe_print_text_len;
+      bexe->exe.print_endl_repeat    = IOCMD_buffered_exe_print_endline_repeat;
+      bexe->exe.print_cariage_return = IOCMD_buffered_exe_print_cariage_return;
+      bexe->exe.refresh_line         = IOCMD_MAKE_INVALID_HANDLER(IOCMD_Refresh_Line_After_Log);
+      bexe->buf                      = buf;
+      bexe->buf_size                 = (int)buf_size;
+      bexe->used                     = 0;
+      bexe->sink                     = sink;
+      bexe->output                   = output;
+      bexe->num_writes               = 0;
+   }
+} /* IOCMD_Buffered_Exe_Init */
+
+
+int IOCMD_Buffered_Exe_Flush(IOCMD_Buffered_Exe_XT *bexe)
+{
+   int result = 0;
+
+   if(IOCMD_CHECK_PTR(IOCMD_Buffered_Exe_XT, bexe) && (bexe->used > 0))
+   {
+      result = bexe->output(bexe->sink, bexe->buf, bexe->used);
+
+      bexe->used = 0;
+      bexe->num_writes++;
+   }
+
+   return result;
+} /* IOCMD_Buffered_Exe_Flush */
+
+
+#if(IOCMD_OUT_BUFFERED_EXE_SUPPORT_POSIX_FD)
+static int IOCMD_buffered_exe_fd_output(void *sink, const char *data, int size)
+{
+   IOCMD_Buffered_Exe_XT *bexe = (IOCMD_Buffered_Exe_XT*)sink;
+   ssize_t                written;
+   int                    result = 0;
+   IOCMD_Bool_DT          failed = IOCMD_FALSE;
+
+   while((result < size) && IOCMD_BOOL_IS_FALSE(failed))
+   {
+      written = write(bexe->fd, &data[result], (size_t)(size - result));
+
+      if(written > 0)
+      {
+         result += (int)written;
+      }
+      else if((written < 0) && (EINTR == errno))
+      {
+         /* interrupted by signal before anything was written - try again */
+      }
+      else
+      {
+         failed = IOCMD_TRUE;
+      }
+   }
+
+   return result;
+} /* IOCMD_buffered_exe_fd_output */
+
+
+void IOCMD_Buffered_Exe_Init_Fd(IOCMD_Buffered_Exe_XT *bexe, char *buf, size_t buf_size, int fd)
+{
+   IOCMD_Buffered_Exe_Init(bexe, buf, buf_size, IOCMD_buffered_exe_fd_output, bexe);
+
+   if(IOCMD_CHECK_PTR(IOCMD_Buffered_Exe_XT, bexe))
+   {
+      bexe->fd = fd;
+   }
+} /* IOCMD_Buffered_Exe_Init_Fd */
+#endif
+#endif
@@ -0,0 +1,950 @@
+/** ---------------------------------------- LICENSE SECTION -------------------------------------------------------------------
+ *
+ * Copyright (c) 2018 Piotr Wojtowicz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * -----------------------------------------------------------------------------------------------------------------------------
+ */
+
+#include <stdarg.h>
+#include <string.h>
+#include "iocmd.h"
+#include "iocmd_out_internal.h"
+
+#if((defined(IOCMD_USE_OUT) || defined(IOCMD_USE_LOG)) && IOCMD_OUT_SUPPORT_FLOATING_POINT)
+
+#include <float.h>
+
+#if(DBL_MANT_DIG != 53)
+#error "IOCMD_OUT_SUPPORT_FLOATING_POINT needs type double in IEEE-754 binary64 format"
+#endif
+
+/**
+ * Value of double is converted to decimal representation as big number of "limbs", every limb keeps 9 decimal digits.
+ * Conversion is exact: mantissa is multiplied / divided by power of 2 limb by limb, so printed digits
+ * are always the same as printed by standard library (rounding to nearest, ties to even).
+ */
+#define IOCMD_DTOA_LIMB_BASE                    1000000000U
+#define IOCMD_DTOA_LIMB_DIGITS                  9
+
+/**
+ * Number of limbs needed to keep exact value of the smallest denormal (1074 fractional digits) with its mantissa,
+ * one spare limb for carry generated by rounding and one for information that digits behind precision are not zero.
+ */
+#define IOCMD_DTOA_NUM_LIMBS                    126
+
+#define IOCMD_DTOA_MANTISSA_BITS                52
+#define IOCMD_DTOA_EXP_MASK                     0x7FFU
+#define IOCMD_DTOA_EXP_BIAS                     1075
+#define IOCMD_DTOA_HEX_DIGITS                   13
+
+/**
+ * Number of significant digits which always identify double value and number of digits kept
+ * during searching of the shortest representation (2 more for rounding decision).
+ */
+#define IOCMD_DTOA_ROUND_TRIP_DIGITS            17
+#define IOCMD_DTOA_SHORTEST_DIGITS              (IOCMD_DTOA_ROUND_TRIP_DIGITS + 3)
+
+#define IOCMD_DTOA_TEMP_SIZE                    32
+
+typedef struct IOCMD_Dtoa_Number_eXtendedTag
+{
+   uint32_t       limbs[IOCMD_DTOA_NUM_LIMBS];
+   uint_fast16_t  first;   /* first limb (most significant) */
+   uint_fast16_t  point;   /* first limb of fractional part */
+   uint_fast16_t  end;     /* limb after the last one */
+}IOCMD_Dtoa_Number_XT;
+
+typedef struct IOCMD_Dtoa_Layout_eXtendedTag
+{
+   IOCMD_Dtoa_Number_XT num;
+   uint64_t             hex_mantissa;
+   const char          *text;
+   int                  first_digit;   /* position of first printed digit: 0 - units, -1 - tens, 1 - tenths ... */
+   int                  last_digit;    /* position of last printed digit */
+   int                  point_after;   /* position of digit printed before decimal point */
+   int                  exp;
+   char                 sign;
+   char                 exp_char;      /* 'e', 'E', 'p', 'P' or '\0' if exponent is not printed */
+   uint8_t              hex_lead;
+   IOCMD_Bool_DT        is_hex;
+   IOCMD_Bool_DT        show_point;
+   IOCMD_Bool_DT        is_upper_case;
+}IOCMD_Dtoa_Layout_XT;
+
+typedef struct IOCMD_Dtoa_Writer_eXtendedTag
+{
+   const IOCMD_Print_Exe_Params_XT *exe;
+   int                  result;
+   uint_fast8_t         used;
+   char                 buf[IOCMD_DTOA_TEMP_SIZE];
+}IOCMD_Dtoa_Writer_XT;
+
+#if(IOCMD_OUT_FLOATING_POINT_SHORTEST_G)
+typedef struct IOCMD_Dtoa_Decimal_eXtendedTag
+{
+   uint8_t        digits[IOCMD_DTOA_SHORTEST_DIGITS];
+   int            exp;
+   IOCMD_Bool_DT  sticky;  /* digits behind the last one are not zero */
+}IOCMD_Dtoa_Decimal_XT;
+#endif
+
+static const uint32_t IOCMD_dtoa_pow10[IOCMD_DTOA_LIMB_DIGITS + 1] =
+{
+   1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U
+};
+
+static int IOCMD_dtoa_floor_div9(int value)
+{
+   int result;
+
+   if(value >= 0)
+   {
+      result = value / IOCMD_DTOA_LIMB_DIGITS;
+   }
+   else
+   {
+      result = 0 - (((IOCMD_DTOA_LIMB_DIGITS - 1) - value) / IOCMD_DTOA_LIMB_DIGITS);
+   }
+
+   return result;
+} /* IOCMD_dtoa_floor_div9 */
+
+static void IOCMD_dtoa_convert(IOCMD_Dtoa_Number_XT *num, uint64_t mantissa, int e2, IOCMD_Bool_DT is_fixed, int precision)
+{
+   uint64_t       value;
+   uint32_t       carry;
+   uint32_t       rest;
+   uint32_t       sticky;
+   uint_fast16_t  pos;
+   uint_fast16_t  limit;
+   uint_fast8_t   shift;
+
+   if(e2 >= 0)
+   {
+      /* only integer part - it grows towards begining of the table */
+      num->first = IOCMD_DTOA_NUM_LIMBS - 2U;
+   }
+   else
+   {
+      /* fractional part grows towards end of the table; first limb is left free for carry generated by rounding */
+      num->first = 1U;
+   }
+
+   num->limbs[num->first]      = (uint32_t)(mantissa / IOCMD_DTOA_LIMB_BASE);
+   num->limbs[num->first + 1U] = (uint32_t)(mantissa % IOCMD_DTOA_LIMB_BASE);
+   num->end                    = num->first + 2U;
+   num->point                  = num->end;
+
+   /* multiply by 2^e2; at most 29 bits at once to not overflow 64-bit intermediate result */
+   while(e2 > 0)
+   {
+      shift = 29U;
+
+      if(e2 < 29)
+      {
+         shift = (uint_fast8_t)e2;
+      }
+
+      carry = 0U;
+
+      for(pos = num->end; pos > num->first; pos--)
+      {
+         value                 = (((uint64_t)(num->limbs[pos - 1U])) << shift) + carry;
+         num->limbs[pos - 1U]  = (uint32_t)(value % IOCMD_DTOA_LIMB_BASE);
+         carry                 = (uint32_t)(value / IOCMD_DTOA_LIMB_BASE);
+      }
+
+      if(0U != carry)
+      {
+         num->first--;
+         num->limbs[num->first] = carry;
+      }
+
+      e2 -= (int)shift;
+   }
+
+   /* divide by 2^(-e2); at most 9 bits at once - 1000000000 is divisible by 2^9 so every step is exact */
+   while(e2 < 0)
+   {
+      shift = 9U;
+
+      if(e2 > (-9))
+      {
+         shift = (uint_fast8_t)(0 - e2);
+      }
+
+      carry = 0U;
+
+      for(pos = num->first; pos < num->end; pos++)
+      {
+         rest              = num->limbs[pos] & ((((uint32_t)1U) << shift) - 1U);
+         num->limbs[pos]   = (num->limbs[pos] >> shift) + carry;
+         carry             = (IOCMD_DTOA_LIMB_BASE >> shift) * rest;
+      }
+
+      if(0U != carry)
+      {
+         if(num->end < IOCMD_DTOA_NUM_LIMBS)
+         {
+            num->limbs[num->end] = carry;
+            num->end++;
+         }
+         else
+         {
+            num->limbs[num->end - 1U] |= 1U;
+         }
+      }
+
+      /* leading zero of integer part is not needed but at least one limb of integer part is always kept */
+      if(((num->first + 1U) < num->point) && (0U == num->limbs[num->first]))
+      {
+         num->first++;
+      }
+
+      /**
+       * digits far behind requested precision are not calculated - they are cut and only information
+       * that they were not zero is kept in the last limb (which is also behind precision)
+       */
+      if(IOCMD_BOOL_IS_TRUE(is_fixed))
+      {
+         limit = num->point + (uint_fast16_t)((precision + IOCMD_DTOA_LIMB_DIGITS) / IOCMD_DTOA_LIMB_DIGITS) + 1U;
+      }
+      else
+      {
+         for(limit = num->first; (limit < num->end) && (0U == num->limbs[limit]); limit++)
+         {
+            ;
+         }
+
+         limit += (uint_fast16_t)((precision + IOCMD_DTOA_LIMB_DIGITS + 1) / IOCMD_DTOA_LIMB_DIGITS) + 2U;
+      }
+
+      if(limit < num->end)
+      {
+         sticky = 0U;
+
+         for(pos = limit; pos < num->end; pos++)
+         {
+            sticky |= num->limbs[pos];
+         }
+
+         num->end = limit;
+
+         if(0U != sticky)
+         {
+            num->limbs[limit - 1U] |= 1U;
+         }
+      }
+
+      e2 += (int)shift;
+   }
+} /* IOCMD_dtoa_convert */
+
+static void IOCMD_dtoa_round(IOCMD_Dtoa_Number_XT *num, int num_fractional_digits)
+{
+   int            digit_pos = num_fractional_digits - 1;
+   int            limb_pos  = (int)(num->point) + IOCMD_dtoa_floor_div9(digit_pos);
+   uint_fast8_t   num_kept  = (uint_fast8_t)(digit_pos - (IOCMD_DTOA_LIMB_DIGITS * IOCMD_dtoa_floor_div9(digit_pos)) + 1);
+   uint_fast16_t  pos;
+   uint32_t       divider;
+   uint32_t       dropped   = 0U;
+   uint32_t       last_kept;
+   IOCMD_Bool_DT  rest_not_zero = IOCMD_FALSE;
+
+   if((limb_pos >= (int)(num->first)) && (limb_pos < (int)(num->end)))
+   {
+      if(num_kept < IOCMD_DTOA_LIMB_DIGITS)
+      {
+         divider     = IOCMD_dtoa_pow10[IOCMD_DTOA_LIMB_DIGITS - num_kept];
+         dropped     = num->limbs[limb_pos] % divider;
+         last_kept   = num->limbs[limb_pos] / divider;
+         pos         = (uint_fast16_t)limb_pos + 1U;
+
+         num->limbs[limb_pos] -= dropped;
+      }
+      else
+      {
+         divider     = IOCMD_DTOA_LIMB_BASE;
+         last_kept   = num->limbs[limb_pos];
+         pos         = (uint_fast16_t)limb_pos + 2U;
+
+         if(((uint_fast16_t)limb_pos + 1U) < num->end)
+         {
+            dropped  = num->limbs[limb_pos + 1];
+         }
+      }
+
+      for(; pos < num->end; pos++)
+      {
+         if(0U != num->limbs[pos])
+         {
+            rest_not_zero = IOCMD_TRUE;
+            break;
+         }
+      }
+
+      num->end = (uint_fast16_t)limb_pos + 1U;
+
+      /* round to nearest, ties to even */
+      if((dropped > (divider / 2U))
+         || ((dropped == (divider / 2U)) && (IOCMD_BOOL_IS_TRUE(rest_not_zero) || (0U != (last_kept & 1U)))))
+      {
+         num->limbs[limb_pos] += (num_kept < IOCMD_DTOA_LIMB_DIGITS) ? divider : 1U;
+
+         while(num->limbs[limb_pos] >= IOCMD_DTOA_LIMB_BASE)
+         {
+            num->limbs[limb_pos] -= IOCMD_DTOA_LIMB_BASE;
+            limb_pos--;
+
+            if(limb_pos < (int)(num->first))
+            {
+               num->first = (uint_fast16_t)limb_pos;
+               num->limbs[limb_pos] = 0U;
+            }
+
+            num->limbs[limb_pos]++;
+         }
+      }
+   }
+} /* IOCMD_dtoa_round */
+
+static int IOCMD_dtoa_get_exp10(const IOCMD_Dtoa_Number_XT *num)
+{
+   uint_fast16_t  pos;
+   int            num_digits = 1;
+   int            result     = 0;
+
+   for(pos = num->first; (pos < num->end) && (0U == num->limbs[pos]); pos++)
+   {
+      ;
+   }
+
+   if(pos < num->end)
+   {
+      while((num_digits < IOCMD_DTOA_LIMB_DIGITS) && (num->limbs[pos] >= IOCMD_dtoa_pow10[num_digits]))
+      {
+         num_digits++;
+      }
+
+      result = (IOCMD_DTOA_LIMB_DIGITS * ((int)(num->point) - 1 - (int)pos)) + num_digits - 1;
+   }
+
+   return result;
+} /* IOCMD_dtoa_get_exp10 */
+
+static uint_fast8_t IOCMD_dtoa_get_digit(const IOCMD_Dtoa_Layout_XT *layout, int digit)
+{
+   int            digit_pos = digit - 1;
+   int            div9      = IOCMD_dtoa_floor_div9(digit_pos);
+   int            limb_pos  = (int)(layout->num.point) + div9;
+   uint_fast8_t   result    = 0U;
+
+   if(IOCMD_BOOL_IS_TRUE(layout->is_hex))
+   {
+      if(0 == digit)
+      {
+         result = layout->hex_lead;
+      }
+      else if(digit <= IOCMD_DTOA_HEX_DIGITS)
+      {
+         result = (uint_fast8_t)((layout->hex_mantissa >> (4 * (IOCMD_DTOA_HEX_DIGITS - digit))) & 0xFU);
+      }
+   }
+   else if((limb_pos >= (int)(layout->num.first)) && (limb_pos < (int)(layout->num.end)))
+   {
+      result = (uint_fast8_t)((layout->num.limbs[limb_pos]
+         / IOCMD_dtoa_pow10[(IOCMD_DTOA_LIMB_DIGITS - 1) - (digit_pos - (IOCMD_DTOA_LIMB_DIGITS * div9))]) % 10U);
+   }
+
+   return result;
+} /* IOCMD_dtoa_get_digit */
+
+
+#if(IOCMD_OUT_FLOATING_POINT_SHORTEST_G)
+static void IOCMD_dtoa_get_decimal(IOCMD_Dtoa_Layout_XT *layout, uint64_t mantissa, int e2, IOCMD_Dtoa_Decimal_XT *decimal)
+{
+   int            digit_pos;
+   int            div9;
+   int            limb_pos;
+   uint_fast8_t   cntr;
+
+   IOCMD_dtoa_convert(&(layout->num), mantissa, e2, IOCMD_FALSE, IOCMD_DTOA_SHORTEST_DIGITS);
+
+   decimal->exp      = IOCMD_dtoa_get_exp10(&(layout->num));
+   decimal->sticky   = IOCMD_FALSE;
+
+   for(cntr = 0; cntr < IOCMD_DTOA_SHORTEST_DIGITS; cntr++)
+   {
+      decimal->digits[cntr] = IOCMD_dtoa_get_digit(layout, (int)cntr - decimal->exp);
+   }
+
+   /* check if there is anything behind stored digits */
+   digit_pos   = (IOCMD_DTOA_SHORTEST_DIGITS - 2) - decimal->exp;
+   div9        = IOCMD_dtoa_floor_div9(digit_pos);
+   limb_pos    = (int)(layout->num.point) + div9;
+
+   if((limb_pos >= (int)(layout->num.first)) && (limb_pos < (int)(layout->num.end)))
+   {
+      if(0U != (layout->num.limbs[limb_pos]
+         % IOCMD_dtoa_pow10[(IOCMD_DTOA_LIMB_DIGITS - 1) - (digit_pos - (IOCMD_DTOA_LIMB_DIGITS * div9))]))
+      {
+         decimal->sticky = IOCMD_TRUE;
+      }
+
+      for(limb_pos++; limb_pos < (int)(layout->num.end); limb_pos++)
+      {
+         if(0U != layout->num.limbs[limb_pos])
+         {
+            decimal->sticky = IOCMD_TRUE;
+         }
+      }
+   }
+} /* IOCMD_dtoa_get_decimal */
+
+static int IOCMD_dtoa_compare(const uint8_t *digits, uint_fast8_t num_digits, int exp, const IOCMD_Dtoa_Decimal_XT *decimal)
+{
+   uint_fast8_t   cntr;
+   uint8_t        digit;
+   int            result = 0;
+
+   if(exp != decimal->exp)
+   {
+      result = (exp > decimal->exp) ? 1 : (-1);
+   }
+   else
+   {
+      for(cntr = 0; (0 == result) && (cntr < IOCMD_DTOA_SHORTEST_DIGITS); cntr++)
+      {
+         digit = (cntr < num_digits) ? digits[cntr] : 0U;
+
+         if(digit != decimal->digits[cntr])
+         {
+            result = (digit > decimal->digits[cntr]) ? 1 : (-1);
+         }
+      }
+
+      if((0 == result) && IOCMD_BOOL_IS_TRUE(decimal->sticky))
+      {
+         result = (-1);
+      }
+   }
+
+   return result;
+} /* IOCMD_dtoa_compare */
+
+/**
+ * Returns the smallest number of significant digits which still identify the value - printed number placed
+ * between middles of the value and its neighbours is converted back by strtod to the same value.
+ */
+static uint_fast8_t IOCMD_dtoa_get_shortest_precision(IOCMD_Dtoa_Layout_XT *layout, uint64_t mantissa, int e2, uint_fast16_t exp_bits)
+{
+   IOCMD_Dtoa_Decimal_XT   value;
+   IOCMD_Dtoa_Decimal_XT   low;
+   IOCMD_Dtoa_Decimal_XT   high;
+   uint8_t                 candidate[IOCMD_DTOA_ROUND_TRIP_DIGITS];
+   uint_fast8_t            result;
+   uint_fast8_t            cntr;
+   uint_fast8_t            rest;
+   int                     exp;
+   int                     low_cmp;
+   int                     high_cmp;
+   IOCMD_Bool_DT           is_inclusive = (0U == (mantissa & 1U)) ? IOCMD_TRUE : IOCMD_FALSE;
+
+   IOCMD_dtoa_get_decimal(layout, mantissa, e2, &value);
+   IOCMD_dtoa_get_decimal(layout, (mantissa * 2U) + 1U, e2 - 1, &high);
+
+   /* distance to lower neighbour is twice smaller when mantissa is power of 2 */
+   if(((((uint64_t)1U) << IOCMD_DTOA_MANTISSA_BITS) == mantissa) && (exp_bits > 1U))
+   {
+      IOCMD_dtoa_get_decimal(layout, (mantissa * 4U) - 1U, e2 - 2, &low);
+   }
+   else
+   {
+      IOCMD_dtoa_get_decimal(layout, (mantissa * 2U) - 1U, e2 - 1, &low);
+   }
+
+   for(result = 1; result < IOCMD_DTOA_ROUND_TRIP_DIGITS; result++)
+   {
+      memcpy(candidate, value.digits, result);
+      exp = value.exp;
+
+      rest = IOCMD_BOOL_IS_TRUE(value.sticky) ? 1U : 0U;
+
+      for(cntr = result + 1U; cntr < IOCMD_DTOA_SHORTEST_DIGITS; cntr++)
+      {
+         rest |= value.digits[cntr];
+      }
+
+      /* round to nearest, ties to even */
+      if((value.digits[result] > 5U)
+         || ((5U == value.digits[result]) && ((0U != rest) || (0U != (candidate[result - 1U] & 1U)))))
+      {
+         cntr = result;
+
+         do
+         {
+            cntr--;
+            candidate[cntr]++;
+
+            if(candidate[cntr] < 10U)
+            {
+               break;
+            }
+
+            candidate[cntr] = 0U;
+
+            if(0U == cntr)
+            {
+               candidate[0] = 1U;
+               exp++;
+            }
+         }while(cntr > 0U);
+      }
+
+      low_cmp  = IOCMD_dtoa_compare(candidate, result, exp, &low);
+      high_cmp = IOCMD_dtoa_compare(candidate, result, exp, &high);
+
+      if(((low_cmp > 0) || (IOCMD_BOOL_IS_TRUE(is_inclusive) && (0 == low_cmp)))
+         && ((high_cmp < 0) || (IOCMD_BOOL_IS_TRUE(is_inclusive) && (0 == high_cmp))))
+      {
+         break;
+      }
+   }
+
+   return result;
+} /* IOCMD_dtoa_get_shortest_precision */
+#endif
+
+static void IOCMD_dtoa_prepare_decimal(
+   IOCMD_Dtoa_Layout_XT                *layout,
+   const IOCMD_Param_Parsing_Result_XT *params,
+   uint64_t                             mantissa,
+   int                                  e2,
+   uint_fast16_t                        exp_bits)
+{
+   int            precision = params->precision;
+   int            threshold = 0;
+   int            exp;
+   IOCMD_Bool_DT  is_g      = IOCMD_FALSE;
+
+   if(('f' == params->specifier) || ('F' == params->specifier))
+   {
+      if(precision < 0)
+      {
+         precision = 6;
+      }
+
+      IOCMD_dtoa_convert(&(layout->num), mantissa, e2, IOCMD_TRUE, precision);
+      IOCMD_dtoa_round(&(layout->num), precision);
+
+      exp = IOCMD_dtoa_get_exp10(&(layout->num));
+
+      layout->first_digit  = (exp > 0) ? (0 - exp) : 0;
+      layout->last_digit   = precision;
+      layout->point_after  = 0;
+   }
+   else
+   {
+      if(('g' == params->specifier) || ('G' == params->specifier))
+      {
+         is_g = IOCMD_TRUE;
+
+         if(precision < 0)
+         {
+#if(IOCMD_OUT_FLOATING_POINT_SHORTEST_G)
+            precision = 1;
+
+            if(0U != mantissa)
+            {
+               precision = (int)IOCMD_dtoa_get_shortest_precision(layout, mantissa, e2, exp_bits);
+            }
+#else
+            precision = 6;
+#endif
+         }
+         else if(0 == precision)
+         {
+            precision = 1;
+         }
+
+         threshold = precision;
+#if(IOCMD_OUT_FLOATING_POINT_SHORTEST_G)
+         if(params->precision < 0)
+         {
+            threshold = IOCMD_DTOA_ROUND_TRIP_DIGITS;
+         }
+#endif
+         /* number of digits after the first one */
+         precision--;
+      }
+      else if(precision < 0)
+      {
+         precision = 6;
+      }
+
+      IOCMD_dtoa_convert(&(layout->num), mantissa, e2, IOCMD_FALSE, precision);
+
+      exp = IOCMD_dtoa_get_exp10(&(layout->num));
+      IOCMD_dtoa_round(&(layout->num), precision - exp);
+      exp = IOCMD_dtoa_get_exp10(&(layout->num));
+
+      if(IOCMD_BOOL_IS_TRUE(is_g) && (exp >= (-4)) && (exp < threshold))
+      {
+         layout->first_digit  = (exp > 0) ? (0 - exp) : 0;
+         layout->last_digit   = (precision > exp) ? (precision - exp) : 0;
+         layout->point_after  = 0;
+      }
+      else
+      {
+         layout->exp          = exp;
+         layout->exp_char     = IOCMD_BOOL_IS_TRUE(layout->is_upper_case) ? 'E' : 'e';
+         layout->first_digit  = 0 - exp;
+         layout->last_digit   = precision - exp;
+         layout->point_after  = layout->first_digit;
+      }
+
+      /* %g removes trailing zeros unless '#' flag is used */
+      if(IOCMD_BOOL_IS_TRUE(is_g) && IOCMD_BOOL_IS_FALSE(params->flags_show_0x))
+      {
+         while((layout->last_digit > layout->point_after) && (0U == IOCMD_dtoa_get_digit(layout, layout->last_digit)))
+         {
+            layout->last_digit--;
+         }
+      }
+   }
+
+   layout->show_point = ((layout->last_digit > layout->point_after) || IOCMD_BOOL_IS_TRUE(params->flags_show_0x))
+      ? IOCMD_TRUE : IOCMD_FALSE;
+#if(!IOCMD_OUT_FLOATING_POINT_SHORTEST_G)
+   (void)exp_bits;
+#endif
+} /* IOCMD_dtoa_prepare_decimal */
+
+static void IOCMD_dtoa_prepare_hex(
+   IOCMD_Dtoa_Layout_XT                *layout,
+   const IOCMD_Param_Parsing_Result_XT *params,
+   uint64_t                             fraction,
+   uint_fast16_t                        exp_bits)
+{
+   uint64_t       dropped;
+   uint64_t       half;
+   int            precision = params->precision;
+   uint_fast8_t   shift;
+   uint_fast8_t   last_kept;
+
+   layout->is_hex    = IOCMD_TRUE;
+   layout->hex_lead  = (0U != exp_bits) ? 1U : 0U;
+   layout->exp       = (0U != exp_bits) ? ((int)exp_bits - 1023) : ((0U != fraction) ? (-1022) : 0);
+   layout->exp_char  = IOCMD_BOOL_IS_TRUE(layout->is_upper_case) ? 'P' : 'p';
+
+   if(precision < 0)
+   {
+      /* exact value - trailing zeros are not printed */
+      precision = IOCMD_DTOA_HEX_DIGITS;
+
+      while((precision > 0) && (0U == ((fraction >> (4 * (IOCMD_DTOA_HEX_DIGITS - precision))) & 0xFU)))
+      {
+         precision--;
+      }
+   }
+   else if(precision < IOCMD_DTOA_HEX_DIGITS)
+   {
+      shift    = (uint_fast8_t)(4 * (IOCMD_DTOA_HEX_DIGITS - precision));
+      half     = ((uint64_t)1U) << (shift - 1U);
+      dropped  = fraction & ((half << 1) - 1U);
+      fraction = fraction >> shift;
+
+      last_kept = (0 == precision) ? layout->hex_lead : (uint_fast8_t)(fraction & 1U);
+
+      /* round to nearest, ties to even; carry goes to the leading digit */
+      if((dropped > half) || ((dropped == half) && (0U != (last_kept & 1U))))
+      {
+         fraction++;
+      }
+
+      fraction = fraction << shift;
+
+      if(0U != (fraction >> IOCMD_DTOA_MANTISSA_BITS))
+      {
+         layout->hex_lead++;
+         fraction &= (((uint64_t)1U) << IOCMD_DTOA_MANTISSA_BITS) - 1U;
+      }
+   }
+
+   layout->hex_mantissa = fraction;
+   layout->first_digit  = 0;
+   layout->last_digit   = precision;
+   layout->point_after  = 0;
+
+   layout->show_point = ((layout->last_digit > layout->point_after) || IOCMD_BOOL_IS_TRUE(params->flags_show_0x))
+      ? IOCMD_TRUE : IOCMD_FALSE;
+} /* IOCMD_dtoa_prepare_hex */
+
+static void IOCMD_dtoa_flush(IOCMD_Dtoa_Writer_XT *writer)
+{
+   if(0U != writer->used)
+   {
+      if(IOCMD_CHECK_PTR(const IOCMD_Print_Exe_Params_XT, writer->exe))
+      {
+         writer->result += writer->exe->print_string_len(writer->exe->dev, writer->buf, (int)(writer->used));
+      }
+      else
+      {
+         writer->result += (int)(writer->used);
+      }
+
+      writer->used = 0;
+   }
+} /* IOCMD_dtoa_flush */
+
+static void IOCMD_dtoa_put(IOCMD_Dtoa_Writer_XT *writer, char c, int count)
+{
+   while(count > 0)
+   {
+      writer->buf[writer->used] = c;
+      writer->used++;
+
+      if(writer->used >= IOCMD_DTOA_TEMP_SIZE)
+      {
+         IOCMD_dtoa_flush(writer);
+      }
+
+      count--;
+   }
+} /* IOCMD_dtoa_put */
+
+static int IOCMD_dtoa_print(
+   const IOCMD_Dtoa_Layout_XT          *layout,
+   const IOCMD_Param_Parsing_Result_XT *params,
+   const IOCMD_Print_Exe_Params_XT     *exe)
+{
+   IOCMD_Dtoa_Writer_XT writer;
+   const char    *digits     = IOCMD_BOOL_IS_TRUE(layout->is_upper_case) ? "0123456789ABCDEF" : "0123456789abcdef";
+   char           exp_buf[5];
+   int            length     = 0;
+   int            pad        = 0;
+   int            exp        = layout->exp;
+   int            digit;
+   uint_fast8_t   exp_len    = 0;
+   IOCMD_Bool_DT  zero_pad   = IOCMD_FALSE;
+
+   writer.exe     = exe;
+   writer.result  = 0;
+   writer.used    = 0;
+
+   if('\0' != layout->sign)
+   {
+      length++;
+   }
+
+   if(IOCMD_CHECK_PTR(const char, layout->text))
+   {
+      length += (int)strlen(layout->text);
+   }
+   else
+   {
+      if(IOCMD_BOOL_IS_TRUE(layout->is_hex))
+      {
+         length += 2;
+      }
+
+      length += (layout->last_digit - layout->first_digit) + 1;
+
+      if(IOCMD_BOOL_IS_TRUE(layout->show_point))
+      {
+         length++;
+      }
+
+      if('\0' != layout->exp_char)
+      {
+         if(exp < 0)
+         {
+            exp = 0 - exp;
+         }
+
+         /* exponent is stored from the least significant digit */
+         do
+         {
+            exp_buf[exp_len] = (char)('0' + (exp % 10));
+            exp_len++;
+            exp /= 10;
+         }while((0 != exp) || ((exp_len < 2U) && IOCMD_BOOL_IS_FALSE(layout->is_hex)));
+
+         length += 2 + (int)exp_len;
+      }
+
+      zero_pad = params->flags_zero_padding ? IOCMD_TRUE : IOCMD_FALSE;
+   }
+
+   if(params->width > length)
+   {
+      pad = params->width - length;
+   }
+
+   if(IOCMD_BOOL_IS_FALSE(params->flags_left_adj) && IOCMD_BOOL_IS_FALSE(zero_pad))
+   {
+      IOCMD_dtoa_put(&writer, ' ', pad);
+   }
+
+   if('\0' != layout->sign)
+   {
+      IOCMD_dtoa_put(&writer, layout->sign, 1);
+   }
+
+   if(IOCMD_CHECK_PTR(const char, layout->text))
+   {
+      for(digit = 0; '\0' != layout->text[digit]; digit++)
+      {
+         IOCMD_dtoa_put(&writer, layout->text[digit], 1);
+      }
+   }
+   else
+   {
+      if(IOCMD_BOOL_IS_TRUE(layout->is_hex))
+      {
+         IOCMD_dtoa_put(&writer, '0', 1);
+         IOCMD_dtoa_put(&writer, IOCMD_BOOL_IS_TRUE(layout->is_upper_case) ? 'X' : 'x', 1);
+      }
+
+      if(IOCMD_BOOL_IS_FALSE(params->flags_left_adj) && IOCMD_BOOL_IS_TRUE(zero_pad))
+      {
+         IOCMD_dtoa_put(&writer, '0', pad);
+      }
+
+      for(digit = layout->first_digit; digit <= layout->last_digit; digit++)
+      {
+         IOCMD_dtoa_put(&writer, digits[IOCMD_dtoa_get_digit(layout, digit)], 1);
+
+         if(IOCMD_BOOL_IS_TRUE(layout->show_point) && (digit == layout->point_after))
+         {
+            IOCMD_dtoa_put(&writer, '.', 1);
+         }
+      }
+
+      if('\0' != layout->exp_char)
+      {
+         IOCMD_dtoa_put(&writer, layout->exp_char, 1);
+         IOCMD_dtoa_put(&writer, (layout->exp < 0) ? '-' : '+', 1);
+
+         while(exp_len > 0U)
+         {
+            exp_len--;
+            IOCMD_dtoa_put(&writer, exp_buf[exp_len], 1);
+         }
+      }
+   }
+
+   if(IOCMD_BOOL_IS_TRUE(params->flags_left_adj))
+   {
+      IOCMD_dtoa_put(&writer, ' ', pad);
+   }
+
+   IOCMD_dtoa_flush(&writer);
+
+   return writer.result;
+} /* IOCMD_dtoa_print */
+
+int IOCMD_Proc_Float_Param(
+   IOCMD_Param_Parsing_Result_XT   *params,
+   double                           value,
+   const IOCMD_Print_Exe_Params_XT *exe)
+{
+   IOCMD_Dtoa_Layout_XT layout;
+   uint64_t       bits;
+   uint64_t       fraction;
+   uint_fast16_t  exp_bits;
+   int            e2;
+   char           specifier = params->specifier;
+
+   memcpy(&bits, &value, sizeof(bits));
+
+   fraction = bits & ((((uint64_t)1U) << IOCMD_DTOA_MANTISSA_BITS) - 1U);
+   exp_bits = (uint_fast16_t)((bits >> IOCMD_DTOA_MANTISSA_BITS) & IOCMD_DTOA_EXP_MASK);
+
+   layout.text          = IOCMD_MAKE_INVALID_PTR(const char);
+   layout.hex_mantissa  = 0;
+   layout.exp           = 0;
+   layout.exp_char      = '\0';
+   layout.hex_lead      = 0;
+   layout.is_hex        = IOCMD_FALSE;
+   layout.show_point    = IOCMD_FALSE;
+   layout.is_upper_case = IOCMD_FALSE;
+
+   if(('F' == specifier) || ('E' == specifier) || ('G' == specifier) || ('A' == specifier))
+   {
+      layout.is_upper_case = IOCMD_TRUE;
+   }
+
+   if(0U != (bits >> 63))
+   {
+      layout.sign = '-';
+   }
+   else if(IOCMD_BOOL_IS_TRUE(params->flags_show_sign))
+   {
+      layout.sign = '+';
+   }
+   else if(IOCMD_BOOL_IS_TRUE(params->flags_space_on_sign))
+   {
+      layout.sign = ' ';
+   }
+   else
+   {
+      layout.sign = '\0';
+   }
+
+   if(IOCMD_DTOA_EXP_MASK == exp_bits)
+   {
+      if(0U == fraction)
+      {
+         layout.text = IOCMD_BOOL_IS_TRUE(layout.is_upper_case) ? "INF" : "inf";
+      }
+      else
+      {
+         layout.text = IOCMD_BOOL_IS_TRUE(layout.is_upper_case) ? "NAN" : "nan";
+      }
+   }
+   else if(('a' == specifier) || ('A' == specifier))
+   {
+      IOCMD_dtoa_prepare_hex(&layout, params, fraction, exp_bits);
+   }
+   else
+   {
+      if(0U != exp_bits)
+      {
+         fraction |= ((uint64_t)1U) << IOCMD_DTOA_MANTISSA_BITS;
+         e2 = (int)exp_bits - IOCMD_DTOA_EXP_BIAS;
+      }
+      else if(0U != fraction)
+      {
+         e2 = 1 - IOCMD_DTOA_EXP_BIAS;
+      }
+      else
+      {
+         e2 = 0;
+      }
+
+      IOCMD_dtoa_prepare_decimal(&layout, params, fraction, e2, exp_bits);
+   }
+
+   return IOCMD_dtoa_print(&layout, params, exe);
+} /* IOCMD_Proc_Float_Param */
+
+#endif
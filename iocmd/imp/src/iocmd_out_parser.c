@@ -79,14 +79,14 @@ IOCMD_Bool_DT IOCMD_Parse_Param(const char *format, IOCMD_Param_Parsing_Result_X
     *   o
     *   x
     *   X
-    *   f - not supported
-    *   F - not supported
-    *   e - not supported
-    *   E - not supported
-    *   g - not supported
-    *   G - not supported
-    *   a - not supported
-    *   A - not supported
+    *   f - only if IOCMD_OUT_SUPPORT_FLOATING_POINT is enabled
+    *   F - only if IOCMD_OUT_SUPPORT_FLOATING_POINT is enabled
+    *   e - only if IOCMD_OUT_SUPPORT_FLOATING_POINT is enabled
+    *   E - only if IOCMD_OUT_SUPPORT_FLOATING_POINT is enabled
+    *   g - only if IOCMD_OUT_SUPPORT_FLOATING_POINT is enabled
+    *   G - only if IOCMD_OUT_SUPPORT_FLOATING_POINT is enabled
+    *   a - only if IOCMD_OUT_SUPPORT_FLOATING_POINT is enabled
+    *   A - only if IOCMD_OUT_SUPPORT_FLOATING_POINT is enabled
     *   c
     *   s
     *   p
@@ -425,7 +425,7 @@ IOCMD_Bool_DT IOCMD_Parse_Param(const char *format, IOCMD_Param_Parsing_Result_X
 
          break;
       }
-      /* supported here only to remove params from stack in "compress" function */
+      /* printed only if IOCMD_OUT_SUPPORT_FLOATING_POINT is enabled; otherwise params are only removed from stack */
       else if(('f' == character) || ('F' == character) || ('e' == character) || ('E' == character)
            || ('g' == character) || ('G' == character) || ('a' == character) || ('A' == character))
       {
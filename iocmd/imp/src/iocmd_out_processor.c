@@ -27,6 +27,9 @@
 #include <string.h>
 #include "iocmd.h"
 #include "iocmd_out_internal.h"
+#if(IOCMD_OUT_FORMAT_CACHE_SIZE > 0)
+#include <stdatomic.h>
+#endif
 
 #if(defined(IOCMD_USE_OUT) || defined(IOCMD_USE_LOG))
 static int IOCMD_print_sign_and_0x(const IOCMD_Print_Exe_Params_XT *exe, char sign, char x)
@@ -495,11 +498,299 @@ int IOCMD_Proc_Param(
             }
          }
       } /* s */
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+      else if(('f' == params->specifier) || ('F' == params->specifier) || ('e' == params->specifier) || ('E' == params->specifier)
+         ||   ('g' == params->specifier) || ('G' == params->specifier) || ('a' == params->specifier) || ('A' == params->specifier))
+      {
+         result += IOCMD_Proc_Float_Param(params, data->double_field.d, exe);
+      } /* f,F,e,E,g,G,a,A */
+#endif
    }while(0);
 
    return result;
 } /* IOCMD_Proc_Param */
 
+static IOCMD_Bool_DT IOCMD_is_param_ommited(const IOCMD_Param_Parsing_Result_XT *parse)
+{
+   IOCMD_Bool_DT result = IOCMD_FALSE;
+
+   if(('n' != parse->specifier) && IOCMD_BOOL_IS_TRUE(parse->length_available))
+   {
+#if(!IOCMD_OUT_SUPPORT_FLOATING_POINT)
+      if(('f' == parse->length) || ('L' == parse->length))
+      {
+         result = IOCMD_TRUE;
+      }
+#endif
+#if(!IOCMD_OUT_SUPPORT_U64)
+      if((sizeof(uint64_t) / sizeof(uint8_t)) == parse->length)
+      {
+         result = IOCMD_TRUE;
+      }
+#endif
+   }
+
+   return result;
+} /* IOCMD_is_param_ommited */
+
+#define IOCMD_IS_LITERAL_END(_c)    (('%' == (_c)) || ('\0' == (_c)) || ('\n' == (_c)) || ('\r' == (_c)))
+
+#if(IOCMD_OUT_SCAN_FORMAT_BY_WORDS)
+#ifdef __GNUC__
+/* word is read from char array - it must not be optimized out by strict aliasing rules */
+typedef uint_fast32_t __attribute__((__may_alias__)) IOCMD_Format_Word_DT;
+/* bytes read after end of the format are in the same aligned word - they are never used */
+#define IOCMD_LITERAL_LENGTH_ATTRIBUTES     __attribute__((__no_sanitize_address__))
+#else
+typedef uint_fast32_t IOCMD_Format_Word_DT;
+#define IOCMD_LITERAL_LENGTH_ATTRIBUTES
+#endif
+
+#define IOCMD_FORMAT_WORD_NUM_BYTES         sizeof(IOCMD_Format_Word_DT)
+#define IOCMD_FORMAT_WORD_REPEAT(_byte)     ((((IOCMD_Format_Word_DT)(~((IOCMD_Format_Word_DT)0U))) / 0xFFU) * (IOCMD_Format_Word_DT)(_byte))
+/* not 0 if any byte of the word is 0 - exact, false positives are possible only above real 0 byte */
+#define IOCMD_FORMAT_WORD_HAS_ZERO(_word) \
+   (((_word) - IOCMD_FORMAT_WORD_REPEAT(0x01U)) & (~(_word)) & IOCMD_FORMAT_WORD_REPEAT(0x80U))
+#define IOCMD_FORMAT_WORD_HAS_BYTE(_word, _byte) \
+   IOCMD_FORMAT_WORD_HAS_ZERO((_word) ^ IOCMD_FORMAT_WORD_REPEAT(_byte))
+#else
+#define IOCMD_LITERAL_LENGTH_ATTRIBUTES
+#endif
+
+/**
+ * Returns number of characters of literal text starting from literal, not bigger than max_len.
+ * Literal ends on '%', '\0', '\n' or '\r'.
+ */
+IOCMD_LITERAL_LENGTH_ATTRIBUTES static uint_fast16_t IOCMD_literal_length(const char *literal, uint_fast16_t max_len)
+{
+#if(IOCMD_OUT_SCAN_FORMAT_BY_WORDS)
+   IOCMD_Format_Word_DT word;
+#endif
+   uint_fast16_t pos = 0;
+
+#if(IOCMD_OUT_SCAN_FORMAT_BY_WORDS)
+   /* characters before first aligned word */
+   while((pos < max_len)
+      && (0U != (((uintptr_t)(&literal[pos])) % IOCMD_FORMAT_WORD_NUM_BYTES))
+      && !IOCMD_IS_LITERAL_END(literal[pos]))
+   {
+      pos++;
+   }
+
+   if(0U == (((uintptr_t)(&literal[pos])) % IOCMD_FORMAT_WORD_NUM_BYTES))
+   {
+      /* whole words which are still in the limit; word with end of literal is checked again character by character */
+      while((max_len - pos) >= IOCMD_FORMAT_WORD_NUM_BYTES)
+      {
+         word = *((const IOCMD_Format_Word_DT*)(&literal[pos]));
+
+         if(0U != (IOCMD_FORMAT_WORD_HAS_ZERO(word)
+            | IOCMD_FORMAT_WORD_HAS_BYTE(word, '%')
+            | IOCMD_FORMAT_WORD_HAS_BYTE(word, '\n')
+            | IOCMD_FORMAT_WORD_HAS_BYTE(word, '\r')))
+         {
+            break;
+         }
+
+         pos += IOCMD_FORMAT_WORD_NUM_BYTES;
+      }
+   }
+#endif
+
+   while((pos < max_len) && !IOCMD_IS_LITERAL_END(literal[pos]))
+   {
+      pos++;
+   }
+
+   return pos;
+} /* IOCMD_literal_length */
+
+static uint_fast16_t IOCMD_scan_format(const char *format, uint_fast16_t format_pos, IOCMD_Bool_DT is_print, IOCMD_Format_Op_XT *op)
+{
+   uint_fast16_t pos;
+
+   op->type = IOCMD_FORMAT_OP_END;
+
+   if(format_pos < IOCMD_MAX_STRING_LENGTH)
+   {
+      if('%' == format[format_pos])
+      {
+         if(IOCMD_BOOL_IS_TRUE(IOCMD_Parse_Param(&format[format_pos], &(op->data.param))))
+         {
+            op->type = IOCMD_FORMAT_OP_PARAM;
+
+            /* parameter which is not supported is printed as a text, except of "%" which is printed by main loop */
+            if(IOCMD_BOOL_IS_FALSE(IOCMD_is_param_ommited(&(op->data.param))) || IOCMD_BOOL_IS_FALSE(is_print))
+            {
+               format_pos += op->data.param.param_strlen;
+            }
+         }
+         else
+         {
+            op->type = IOCMD_FORMAT_OP_PERCENT;
+         }
+         format_pos++;
+      }
+      else if('\n' == format[format_pos])
+      {
+         op->type = IOCMD_FORMAT_OP_ENDL;
+         format_pos++;
+      }
+      else if('\r' == format[format_pos])
+      {
+         op->type = IOCMD_FORMAT_OP_CARIAGE_RETURN;
+         format_pos++;
+      }
+      else if('\0' != format[format_pos])
+      {
+         pos = IOCMD_literal_length(&format[format_pos], IOCMD_MAX_STRING_LENGTH - format_pos);
+
+         op->type             = IOCMD_FORMAT_OP_LITERAL;
+         op->data.literal.pos = (uint16_t)format_pos;
+         op->data.literal.len = (uint16_t)pos;
+         format_pos          += pos;
+      }
+   }
+
+   return format_pos;
+} /* IOCMD_scan_format */
+
+#if(IOCMD_OUT_FORMAT_CACHE_SIZE > 0)
+
+#define IOCMD_FORMAT_CACHE_NOT_CACHEABLE        0xFFU
+
+typedef struct IOCMD_Format_Cache_Entry_eXtendedTag
+{
+   /* published with release order after num_ops and ops are stored, read with acquire order */
+   _Atomic(const char*) format;
+   uint8_t              num_ops;
+   IOCMD_Format_Op_XT   ops[IOCMD_OUT_FORMAT_CACHE_MAX_OPS];
+}IOCMD_Format_Cache_Entry_XT;
+
+typedef struct IOCMD_Format_Cache_eXtendedTag
+{
+   IOCMD_Format_Cache_Entry_XT   entries[IOCMD_OUT_FORMAT_CACHE_SIZE];
+   /* statistics - relaxed atomic increments, exact also when formats are printed by many threads */
+   atomic_uint_fast32_t          hits;
+   atomic_uint_fast32_t          misses;
+   /* number of occupied entries, also these which keep not cacheable format */
+   atomic_uint_fast16_t          used_entries;
+}IOCMD_Format_Cache_XT;
+
+static IOCMD_Format_Cache_XT IOCMD_Format_Cache;
+
+static void IOCMD_format_cache_compile(IOCMD_Format_Cache_Entry_XT *entry, const char *format)
+{
+   IOCMD_Format_Op_XT op;
+   uint_fast16_t format_pos = 0;
+   uint_fast8_t  num_ops    = 0;
+
+   for(format_pos = IOCMD_scan_format(format, format_pos, IOCMD_TRUE, &op);
+      IOCMD_FORMAT_OP_END != op.type;
+      format_pos = IOCMD_scan_format(format, format_pos, IOCMD_TRUE, &op))
+   {
+      /**
+       * not supported parameters are printed as a text but stored in logs as params
+       * so operations list would be different for these two cases - don't cache such format;
+       * format which needs more operations than entry can keep is also not cached
+       */
+      if((num_ops >= IOCMD_OUT_FORMAT_CACHE_MAX_OPS)
+         || ((IOCMD_FORMAT_OP_PARAM == op.type) && IOCMD_BOOL_IS_TRUE(IOCMD_is_param_ommited(&(op.data.param)))))
+      {
+         num_ops = IOCMD_FORMAT_CACHE_NOT_CACHEABLE;
+         break;
+      }
+
+      entry->ops[num_ops] = op;
+      num_ops++;
+   }
+
+   atomic_store_explicit(&(IOCMD_Format_Cache.used_entries),
+      atomic_load_explicit(&(IOCMD_Format_Cache.used_entries), memory_order_relaxed) + 1U, memory_order_relaxed);
+
+   entry->num_ops = (uint8_t)num_ops;
+   /* entry becomes visible for other calls only when all operations are already stored */
+   atomic_store_explicit(&(entry->format), format, memory_order_release);
+} /* IOCMD_format_cache_compile */
+
+static const IOCMD_Format_Cache_Entry_XT *IOCMD_format_cache_get(const char *format)
+{
+   const IOCMD_Format_Cache_Entry_XT *result = IOCMD_MAKE_INVALID_PTR(const IOCMD_Format_Cache_Entry_XT);
+   IOCMD_Format_Cache_Entry_XT *entry;
+   const char   *entry_format;
+   size_t        index;
+   uint_fast16_t cntr;
+   IOCMD_Bool_DT is_hit = IOCMD_FALSE;
+   atomic_uint_fast32_t *counter;
+
+   index  = (size_t)format;
+   index ^= IOCMD_DIV_BY_POWER_OF_2(index, 7);
+   index %= IOCMD_OUT_FORMAT_CACHE_SIZE;
+
+   /* number of checked entries is limited - when cache is full, not cached format costs only few comparisons */
+   for(cntr = 0; cntr < IOCMD_OUT_FORMAT_CACHE_MAX_PROBES; cntr++)
+   {
+      entry = &(IOCMD_Format_Cache.entries[index]);
+      entry_format = atomic_load_explicit(&(entry->format), memory_order_acquire);
+
+      if(format == entry_format)
+      {
+         is_hit = IOCMD_TRUE;
+      }
+      else if(IOCMD_MAKE_INVALID_PTR(const char) == entry_format)
+      {
+         IOCMD_OUT_FORMAT_CACHE_LOCK();
+
+         if(IOCMD_MAKE_INVALID_PTR(const char) == atomic_load_explicit(&(entry->format), memory_order_relaxed))
+         {
+            IOCMD_format_cache_compile(entry, format);
+         }
+
+         IOCMD_OUT_FORMAT_CACHE_UNLOCK();
+
+         entry_format = atomic_load_explicit(&(entry->format), memory_order_acquire);
+      }
+
+      /* entry might be taken by other context in meantime; in such case search next one */
+      if(format == entry_format)
+      {
+         if(IOCMD_FORMAT_CACHE_NOT_CACHEABLE != entry->num_ops)
+         {
+            result = entry;
+         }
+         else
+         {
+            is_hit = IOCMD_FALSE;
+         }
+         break;
+      }
+
+      index++;
+      if(index >= IOCMD_OUT_FORMAT_CACHE_SIZE)
+      {
+         index = 0;
+      }
+   }
+
+   counter = IOCMD_BOOL_IS_TRUE(is_hit) ? &(IOCMD_Format_Cache.hits) : &(IOCMD_Format_Cache.misses);
+   (void)atomic_fetch_add_explicit(counter, 1U, memory_order_relaxed);
+
+   return result;
+} /* IOCMD_format_cache_get */
+
+void IOCMD_Get_Format_Cache_Stats(IOCMD_Format_Cache_Stats_XT *stats)
+{
+   if(IOCMD_CHECK_PTR(IOCMD_Format_Cache_Stats_XT, stats))
+   {
+      stats->hits          = (uint32_t)atomic_load_explicit(&(IOCMD_Format_Cache.hits), memory_order_relaxed);
+      stats->misses        = (uint32_t)atomic_load_explicit(&(IOCMD_Format_Cache.misses), memory_order_relaxed);
+      stats->used_entries  = (uint_fast16_t)atomic_load_explicit(&(IOCMD_Format_Cache.used_entries), memory_order_relaxed);
+      stats->size          = IOCMD_OUT_FORMAT_CACHE_SIZE;
+   }
+} /* IOCMD_Get_Format_Cache_Stats */
+
+#endif
+
 int IOCMD_Proc_Main_Loop(
    const char                      *format,
    IOCMD_Out_Main_Loop_Params_XT   *params,
@@ -507,199 +798,216 @@ int IOCMD_Proc_Main_Loop(
    IOCMD_Bool_DT                    is_print)
 {
    const IOCMD_Print_Exe_Params_XT *exe;
+#if(IOCMD_OUT_FORMAT_CACHE_SIZE > 0)
+   const IOCMD_Format_Cache_Entry_XT *entry = IOCMD_MAKE_INVALID_PTR(const IOCMD_Format_Cache_Entry_XT);
+   uint_fast8_t                     op_cntr = 0;
+#endif
    IOCMD_Buffer_Convert_UT          convert;
    IOCMD_Param_Parsing_Result_XT    parse;
+   IOCMD_Format_Op_XT               op;
    int                              out_pos = 0;
-   uint_fast16_t                    format_pos;
+   uint_fast16_t                    format_pos = 0;
+#ifdef IOCMD_USE_LOG
    uint_fast16_t                    pos;
+#endif
    IOCMD_Bool_DT                    ommit;
 
    if(IOCMD_CHECK_PTR(const char, format) && IOCMD_CHECK_PTR(IOCMD_Out_Main_Loop_Params_XT, params))
    {
-      for(format_pos = 0; format_pos < IOCMD_MAX_STRING_LENGTH; format_pos++)
+#if(IOCMD_OUT_FORMAT_CACHE_SIZE > 0)
+      if(IOCMD_BOOL_IS_FALSE(is_print) || IOCMD_OUT_IS_FORMAT_CACHEABLE(format))
+      {
+         entry = IOCMD_format_cache_get(format);
+      }
+#endif
+
+      do
       {
-         if('%' == format[format_pos])
+#if(IOCMD_OUT_FORMAT_CACHE_SIZE > 0)
+         if(IOCMD_CHECK_PTR(const IOCMD_Format_Cache_Entry_XT, entry))
+         {
+            if(op_cntr < entry->num_ops)
+            {
+               op = entry->ops[op_cntr];
+               op_cntr++;
+            }
+            else
+            {
+               op.type = IOCMD_FORMAT_OP_END;
+            }
+         }
+         else
+#endif
          {
-            ommit = IOCMD_FALSE;
+            format_pos = IOCMD_scan_format(format, format_pos, is_print, &op);
+         }
 
-            if(IOCMD_BOOL_IS_TRUE(IOCMD_Parse_Param(&format[format_pos], &parse)))
+         if(IOCMD_FORMAT_OP_PARAM == op.type)
+         {
+            parse = op.data.param;
+            ommit = IOCMD_is_param_ommited(&parse);
+
+            if(IOCMD_BOOL_IS_TRUE(parse.width_variadic))
+            {
+               parse.width = (IOCMD_String_Pos_DT)va_arg(arg, int);
+            }
+            if(IOCMD_BOOL_IS_TRUE(parse.precision_variadic))
             {
-               if(IOCMD_BOOL_IS_TRUE(parse.width_variadic))
+               parse.precision = (IOCMD_String_Pos_DT)va_arg(arg, int);
+            }
+
+            memset(&convert, 0, sizeof(convert));
+
+            if('n' == parse.specifier)
+            {
+               convert.ptr_field.ptr.ptr = va_arg(arg, void*);
+
+#if(IOCMD_OUT_SUPPORT_POS_RETURNING)
+               if(1 == parse.length)
                {
-                  parse.width = (IOCMD_String_Pos_DT)va_arg(arg, int);
+                  *(convert.ptr_field.ptr.u8)  = (uint8_t)(out_pos);
                }
-               if(IOCMD_BOOL_IS_TRUE(parse.precision_variadic))
+               else if(2 == parse.length)
                {
-                  parse.precision = (IOCMD_String_Pos_DT)va_arg(arg, int);
+                  *(convert.ptr_field.ptr.u16) = (uint16_t)(out_pos);
                }
-
-               memset(&convert, 0, sizeof(convert));
-
-               if('n' == parse.specifier)
+               else if(4 == parse.length)
                {
-                  convert.ptr_field.ptr.ptr = va_arg(arg, void*);
-
-#if(IOCMD_OUT_SUPPORT_POS_RETURNING)
-                  if(1 == parse.length)
-                  {
-                     *(convert.ptr_field.ptr.u8)  = (uint8_t)(out_pos);
-                  }
-                  else if(2 == parse.length)
-                  {
-                     *(convert.ptr_field.ptr.u16) = (uint16_t)(out_pos);
-                  }
-                  else if(4 == parse.length)
-                  {
-                     *(convert.ptr_field.ptr.u32) = (uint32_t)(out_pos);
-                  }
+                  *(convert.ptr_field.ptr.u32) = (uint32_t)(out_pos);
+               }
    #if(IOCMD_OUT_SUPPORT_U64)
-                  else if(8 == parse.length)
-                  {
-                     *(convert.ptr_field.ptr.u64) = (uint64_t)(out_pos);
-                  }
+               else if(8 == parse.length)
+               {
+                  *(convert.ptr_field.ptr.u64) = (uint64_t)(out_pos);
+               }
    #endif
 #else
-                  if(1 == parse.length)
-                  {
-                     *(convert.ptr_field.ptr.u8)  = 0;
-                  }
-                  else if(2 == parse.length)
-                  {
-                     *(convert.ptr_field.ptr.u16) = 0;
-                  }
-                  else if(4 == parse.length)
-                  {
-                     *(convert.ptr_field.ptr.u32) = 0;
-                  }
+               if(1 == parse.length)
+               {
+                  *(convert.ptr_field.ptr.u8)  = 0;
+               }
+               else if(2 == parse.length)
+               {
+                  *(convert.ptr_field.ptr.u16) = 0;
+               }
+               else if(4 == parse.length)
+               {
+                  *(convert.ptr_field.ptr.u32) = 0;
+               }
    #if(IOCMD_OUT_SUPPORT_U64)
-                  else if(8 == parse.length)
-                  {
-                     *(convert.ptr_field.ptr.u64) = 0;
-                  }
+               else if(8 == parse.length)
+               {
+                  *(convert.ptr_field.ptr.u64) = 0;
+               }
    #endif
 #endif
 
-                  format_pos += parse.param_strlen;
-
-                  continue;
+               continue;
+            }
+            else if(IOCMD_BOOL_IS_TRUE(parse.length_available))
+            {
+               if('i' == parse.length)
+               {
+                  parse.length = sizeof(int) / sizeof(uint8_t);
+                  convert.int_field.i = va_arg(arg, int);
                }
-               else if(IOCMD_BOOL_IS_TRUE(parse.length_available))
+               else if('c' == parse.length)
                {
-                  if('i' == parse.length)
-                  {
-                     parse.length = sizeof(int) / sizeof(uint8_t);
-                     convert.int_field.i = va_arg(arg, int);
-                  }
-                  else if('c' == parse.length)
-                  {
-                     parse.length = sizeof(char) / sizeof(uint8_t);
+                  parse.length = sizeof(char) / sizeof(uint8_t);
 #if((!IOCMD_PROMOTION_INT8_TO_INT16) && (!IOCMD_PROMOTION_INT16_TO_INT32))
-                     convert.char_field.c    = va_arg(arg, char);
+                  convert.char_field.c    = va_arg(arg, char);
 #elif (!IOCMD_PROMOTION_INT16_TO_INT32)
-                     convert.u16_field.u16_0 = va_arg(arg, uint16_t);
+                  convert.u16_field.u16_0 = va_arg(arg, uint16_t);
 #else
-                     convert.u32_field.u32_0 = va_arg(arg, uint32_t);
+                  convert.u32_field.u32_0 = va_arg(arg, uint32_t);
 #endif
-                  }
-                  else if('s' == parse.length)
-                  {
-                     parse.length = sizeof(IOCMD_Strptr) / sizeof(uint8_t);
-                     convert.ptr_field.ptr.string = va_arg(arg, IOCMD_Strptr);
-                  }
-                  else if('p' == parse.length)
-                  {
-                     parse.length = sizeof(const void*) / sizeof(uint8_t);
-                     convert.ptr_field.ptr.ptr = va_arg(arg, const void*);
-                  }
-                  else if((sizeof(uint8_t) / sizeof(uint8_t)) == parse.length)
-                  {
+               }
+               else if('s' == parse.length)
+               {
+                  parse.length = sizeof(IOCMD_Strptr) / sizeof(uint8_t);
+                  convert.ptr_field.ptr.string = va_arg(arg, IOCMD_Strptr);
+               }
+               else if('p' == parse.length)
+               {
+                  parse.length = sizeof(const void*) / sizeof(uint8_t);
+                  convert.ptr_field.ptr.ptr = va_arg(arg, const void*);
+               }
+               else if((sizeof(uint8_t) / sizeof(uint8_t)) == parse.length)
+               {
 #if((!IOCMD_PROMOTION_INT8_TO_INT16) && (!IOCMD_PROMOTION_INT16_TO_INT32))
-                     convert.u8_field.u8_0   = va_arg(arg, uint8_t);
+                  convert.u8_field.u8_0   = va_arg(arg, uint8_t);
 #elif(!IOCMD_PROMOTION_INT16_TO_INT32)
-                     convert.u16_field.u16_0 = va_arg(arg, uint16_t);
+                  convert.u16_field.u16_0 = va_arg(arg, uint16_t);
 #else
-                     convert.u32_field.u32_0 = va_arg(arg, uint32_t);
+                  convert.u32_field.u32_0 = va_arg(arg, uint32_t);
 #endif
-                  }
-                  else if((sizeof(uint16_t) / sizeof(uint8_t)) == parse.length)
-                  {
+               }
+               else if((sizeof(uint16_t) / sizeof(uint8_t)) == parse.length)
+               {
 #if(!IOCMD_PROMOTION_INT16_TO_INT32)
-                     convert.u16_field.u16_0 = va_arg(arg, uint16_t);
+                  convert.u16_field.u16_0 = va_arg(arg, uint16_t);
 #else
-                     convert.u32_field.u32_0 = va_arg(arg, uint32_t);
+                  convert.u32_field.u32_0 = va_arg(arg, uint32_t);
 #endif
-                  }
-                  else if((sizeof(uint32_t) / sizeof(uint8_t)) == parse.length)
-                  {
-                     convert.u32_field.u32_0 = va_arg(arg, uint32_t);
-                  }
-                  else if((sizeof(uint64_t) / sizeof(uint8_t)) == parse.length)
-                  {
+               }
+               else if((sizeof(uint32_t) / sizeof(uint8_t)) == parse.length)
+               {
+                  convert.u32_field.u32_0 = va_arg(arg, uint32_t);
+               }
+               else if((sizeof(uint64_t) / sizeof(uint8_t)) == parse.length)
+               {
 #if(IOCMD_OUT_SUPPORT_U64)
-                     convert.u64_field.u64   = va_arg(arg, uint64_t);
+                  convert.u64_field.u64   = va_arg(arg, uint64_t);
 #else
-                     (void)va_arg(arg, uint64_t);
-                     ommit = IOCMD_TRUE;
+                  (void)va_arg(arg, uint64_t);
 #endif
-                  }
-                  else if('f' == parse.length)
-                  {
-                     parse.length = sizeof(double) / sizeof(uint8_t);
-                     (void)va_arg(arg, double);
-                     ommit = IOCMD_TRUE;
-                  }
-                  else if('L' == parse.length)
-                  {
-                     parse.length = sizeof(long double) / sizeof(uint8_t);
-                     (void)va_arg(arg, long double);
-                     ommit = IOCMD_TRUE;
-                  }
                }
-
-               if(IOCMD_BOOL_IS_FALSE(ommit))
+               else if('f' == parse.length)
                {
-#ifdef IOCMD_USE_LOG
-                  if(IOCMD_BOOL_IS_TRUE(is_print))
-                  {
-                     out_pos += IOCMD_Proc_Param(
-                        &parse,
-                        &convert,
-                        params->print.exe);
-                  }
-                  else
-                  {
-                     pos = *(params->log.buf_ppos);
-                     out_pos += IOCMD_Compress_Param(
-                        &parse,
-                        &convert,
-                        &(params->log.buf)[pos],
-                        params->log.buf_ppos,
-                        params->log.buf_size - pos);
-                  }
+                  parse.length = sizeof(double) / sizeof(uint8_t);
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+                  convert.double_field.d  = va_arg(arg, double);
 #else
-                  out_pos += IOCMD_Proc_Param(
-                     &parse,
-                     &convert,
-                     params->print.exe);
+                  (void)va_arg(arg, double);
+#endif
+               }
+               else if('L' == parse.length)
+               {
+                  parse.length = sizeof(long double) / sizeof(uint8_t);
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+                  convert.double_field.d  = (double)va_arg(arg, long double);
+#else
+                  (void)va_arg(arg, long double);
 #endif
                }
+            }
 
-               if(IOCMD_BOOL_IS_FALSE(ommit)
+            if(IOCMD_BOOL_IS_FALSE(ommit))
+            {
 #ifdef IOCMD_USE_LOG
-                  || IOCMD_BOOL_IS_FALSE(is_print)
-#endif
-                  )
+               if(IOCMD_BOOL_IS_TRUE(is_print))
                {
-                  format_pos += parse.param_strlen;
+                  out_pos += IOCMD_Proc_Param(
+                     &parse,
+                     &convert,
+                     params->print.exe);
                }
                else
                {
-                  exe = params->print.exe;
-
-                  out_pos += exe->print_string(exe->dev, "%");
+                  pos = *(params->log.buf_ppos);
+                  out_pos += IOCMD_Compress_Param(
+                     &parse,
+                     &convert,
+                     &(params->log.buf)[pos],
+                     params->log.buf_ppos,
+                     params->log.buf_size - pos);
                }
-
-               continue;
+#else
+               out_pos += IOCMD_Proc_Param(
+                  &parse,
+                  &convert,
+                  params->print.exe);
+#endif
             }
             else
 #ifdef IOCMD_USE_LOG
@@ -708,6 +1016,17 @@ int IOCMD_Proc_Main_Loop(
             {
                exe = params->print.exe;
 
+               out_pos += exe->print_string(exe->dev, "%");
+            }
+         }
+         else if(IOCMD_FORMAT_OP_PERCENT == op.type)
+         {
+#ifdef IOCMD_USE_LOG
+            if(IOCMD_BOOL_IS_TRUE(is_print))
+#endif
+            {
+               exe = params->print.exe;
+
                out_pos += exe->print_string(exe->dev, "%");
             }
 #ifdef IOCMD_USE_LOG
@@ -717,11 +1036,7 @@ int IOCMD_Proc_Main_Loop(
             }
 #endif
          }
-         else if('\0' == format[format_pos])
-         {
-            break;
-         }
-         else if('\n' == format[format_pos])
+         else if(IOCMD_FORMAT_OP_ENDL == op.type)
          {
             if(IOCMD_BOOL_IS_TRUE(is_print))
             {
@@ -730,7 +1045,7 @@ int IOCMD_Proc_Main_Loop(
                exe->print_endl_repeat(exe->dev, 1);
             }
          }
-         else if('\r' == format[format_pos])
+         else if(IOCMD_FORMAT_OP_CARIAGE_RETURN == op.type)
          {
             if(IOCMD_BOOL_IS_TRUE(is_print))
             {
@@ -739,39 +1054,26 @@ int IOCMD_Proc_Main_Loop(
                exe->print_cariage_return(exe->dev);
             }
          }
-         else
+         else if(IOCMD_FORMAT_OP_LITERAL == op.type)
          {
-            for(pos = 0; (pos + format_pos) < IOCMD_MAX_STRING_LENGTH ; pos++)
-            {
-               if(('%' == format[pos + format_pos])
-                  || ('\0' == format[pos + format_pos])
-                  || ('\n' == format[pos + format_pos])
-                  || ('\r' == format[pos + format_pos]))
-               {
-                  break;
-               }
-            }
-
 #ifdef IOCMD_USE_LOG
             if(IOCMD_BOOL_IS_TRUE(is_print))
 #endif
             {
                exe = params->print.exe;
 
-               out_pos += exe->print_string_len(exe->dev, &format[format_pos], pos);
+               out_pos += exe->print_string_len(exe->dev, &format[op.data.literal.pos], op.data.literal.len);
             }
 #ifdef IOCMD_USE_LOG
             else
             {
-               out_pos += pos;
+               out_pos += op.data.literal.len;
             }
 #endif
-            format_pos += pos - 1;
          }
-      }
+      }while(IOCMD_FORMAT_OP_END != op.type);
    }
 
    return out_pos;
 } /* IOCMD_Proc_Main_Loop */
 #endif
-
@@ -29,6 +29,202 @@
 
 #if(IOCMD_OUT_USE_UTOA)
 
+#if(IOCMD_UTOA_USE_DIGIT_PAIRS)
+
+#if(IOCMD_OUT_SUPPORT_U64)
+typedef uint64_t IOCMD_Utoa_Value_DT;
+#else
+typedef uint32_t IOCMD_Utoa_Value_DT;
+#endif
+
+static const char IOCMD_utoa_digit_pairs[201] =
+   "0001020304050607080910111213141516171819"
+   "2021222324252627282930313233343536373839"
+   "4041424344454647484950515253545556575859"
+   "6061626364656667686970717273747576777879"
+   "8081828384858687888990919293949596979899";
+
+static const IOCMD_Utoa_Value_DT IOCMD_utoa_pow10[] =
+{
+   1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U
+#if(IOCMD_OUT_SUPPORT_U64)
+   ,
+   10000000000U, 100000000000U, 1000000000000U, 10000000000000U, 100000000000000U,
+   1000000000000000U, 10000000000000000U, 100000000000000000U, 1000000000000000000U, 10000000000000000000U
+#endif
+};
+
+static uint_fast8_t IOCMD_utoa_num_bits(IOCMD_Utoa_Value_DT value)
+{
+   uint_fast8_t result;
+
+#if(defined(__GNUC__) || defined(__clang__))
+   result = (uint_fast8_t)(64 - __builtin_clzll((unsigned long long)value));
+#else
+   for(result = 0; 0 != value; result++)
+   {
+      value = IOCMD_DIV_BY_POWER_OF_2(value, 1);
+   }
+#endif
+
+   return result;
+} /* IOCMD_utoa_num_bits */
+
+/**
+ * Conversion engine for 32/64-bit CPUs: length of result is known before conversion (from number of significant bits),
+ * so digits are written directly to their final place in output buffer - decimal ones two at a time from table of digit pairs.
+ * Division by constant 100 is replaced by compiler with multiplication by reciprocal.
+ */
+static int IOCMD_utoa_digit_pairs_engine(char* buf, IOCMD_Utoa_Value_DT value, uint_fast8_t base, uint_fast8_t num_pads_to_print, char pad, IOCMD_Bool_DT is_upper_case)
+{
+   const char          *format = IOCMD_BOOL_IS_TRUE(is_upper_case) ? "0123456789ABCDEF" : "0123456789abcdef";
+   IOCMD_Utoa_Value_DT  temp;
+   uint_fast8_t         num_digits = 0;
+   uint_fast8_t         num_bits;
+   uint_fast8_t         pair;
+   int                  result = 0;
+   int                  pos;
+
+   if(0 == value)
+   {
+      /* zero has one digit, same as any other value */
+      num_digits = 1;
+   }
+   else if(10 == base)
+   {
+      num_bits    = IOCMD_utoa_num_bits(value);
+      num_digits  = (uint_fast8_t)((num_bits * 1233U) >> 12);
+      num_digits  = (value < IOCMD_utoa_pow10[num_digits]) ? num_digits : (num_digits + 1);
+   }
+   else if(16 == base)
+   {
+      num_digits  = (IOCMD_utoa_num_bits(value) + 3U) / 4U;
+   }
+   else if(8 == base)
+   {
+      num_digits  = (IOCMD_utoa_num_bits(value) + 2U) / 3U;
+   }
+   else
+   {
+      for(temp = value; 0 != temp; temp /= base)
+      {
+         num_digits++;
+      }
+   }
+
+   while(num_pads_to_print > num_digits)
+   {
+      buf[result++] = pad;
+      num_pads_to_print--;
+   }
+
+   result     += (int)num_digits;
+   pos         = result;
+   buf[pos]    = '\0';
+
+   if(10 == base)
+   {
+      while(value >= 100U)
+      {
+         pair     = (uint_fast8_t)(value % 100U) * 2U;
+         value   /= 100U;
+         buf[--pos] = IOCMD_utoa_digit_pairs[pair + 1U];
+         buf[--pos] = IOCMD_utoa_digit_pairs[pair];
+      }
+
+      if(value >= 10U)
+      {
+         pair     = (uint_fast8_t)value * 2U;
+         buf[--pos] = IOCMD_utoa_digit_pairs[pair + 1U];
+         buf[--pos] = IOCMD_utoa_digit_pairs[pair];
+      }
+      else
+      {
+         buf[--pos] = (char)('0' + (char)value);
+      }
+   }
+   else if(16 == base)
+   {
+      for(; num_digits > 0; num_digits--)
+      {
+         buf[--pos] = format[value & 0xF];
+         value = IOCMD_DIV_BY_POWER_OF_2(value, 4);
+      }
+   }
+   else if(8 == base)
+   {
+      for(; num_digits > 0; num_digits--)
+      {
+         buf[--pos] = format[value & 0x7];
+         value = IOCMD_DIV_BY_POWER_OF_2(value, 3);
+      }
+   }
+   else
+   {
+      for(; num_digits > 0; num_digits--)
+      {
+         buf[--pos] = format[value % base];
+         value /= base;
+      }
+   }
+
+   return result;
+} /* IOCMD_utoa_digit_pairs_engine */
+
+#if(IOCMD_OUT_SUPPORT_U64)
+int IOCMD_Utoa64(char* buf, uint64_t value, uint_fast8_t base, uint_fast8_t num_pads_to_print, char pad, IOCMD_Bool_DT is_upper_case)
+{
+   int result = 0;
+
+   if(IOCMD_CHECK_PTR(char, buf))
+   {
+      result = IOCMD_utoa_digit_pairs_engine(buf, value, base, num_pads_to_print, pad, is_upper_case);
+   }
+
+   return result;
+} /* IOCMD_Utoa64 */
+#endif
+
+int IOCMD_Utoa32(char* buf, uint32_t value, uint_fast8_t base, uint_fast8_t num_pads_to_print, char pad, IOCMD_Bool_DT is_upper_case)
+{
+   int result = 0;
+
+   if(IOCMD_CHECK_PTR(char, buf))
+   {
+      result = IOCMD_utoa_digit_pairs_engine(buf, value, base, num_pads_to_print, pad, is_upper_case);
+   }
+
+   return result;
+} /* IOCMD_Utoa32 */
+
+#if(!IOCMD_OUT_MINIMAL_PROGRAM_MEMORY_USAGE)
+int IOCMD_Utoa16(char* buf, uint16_t value, uint_fast8_t base, uint_fast8_t num_pads_to_print, char pad, IOCMD_Bool_DT is_upper_case)
+{
+   int result = 0;
+
+   if(IOCMD_CHECK_PTR(char, buf))
+   {
+      result = IOCMD_utoa_digit_pairs_engine(buf, value, base, num_pads_to_print, pad, is_upper_case);
+   }
+
+   return result;
+} /* IOCMD_Utoa16 */
+
+int IOCMD_Utoa8(char* buf, uint8_t value, uint_fast8_t base, uint_fast8_t num_pads_to_print, char pad, IOCMD_Bool_DT is_upper_case)
+{
+   int result = 0;
+
+   if(IOCMD_CHECK_PTR(char, buf))
+   {
+      result = IOCMD_utoa_digit_pairs_engine(buf, value, base, num_pads_to_print, pad, is_upper_case);
+   }
+
+   return result;
+} /* IOCMD_Utoa8 */
+#endif
+
+#else
+
 #if(IOCMD_HEX_TO_BCD_DONT_USE_DIV && (!IOCMD_OUT_MINIMAL_PROGRAM_MEMORY_USAGE))
 
 typedef struct IOCMD_hex_to_bcd_tab_DataTag
@@ -611,3 +807,5 @@ int IOCMD_Utoa8(char* buf, uint8_t value, uint_fast8_t base, uint_fast8_t num_pa
 
 #endif
 
+#endif
+
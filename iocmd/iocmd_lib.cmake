@@ -54,6 +54,7 @@ if((DEFINED IOCMD_USE_OUT AND IOCMD_USE_OUT MATCHES ON) OR (DEFINED IOCMD_USE_LO
         ${IOCMD_PATH}/imp/src/iocmd_out_utoa.c
         ${IOCMD_PATH}/imp/src/iocmd_out_parser.c
         ${IOCMD_PATH}/imp/src/iocmd_out_processor.c
+        ${IOCMD_PATH}/imp/src/iocmd_out_dtoa.c
     )
 endif()
 
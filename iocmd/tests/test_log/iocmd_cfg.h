@@ -0,0 +1,155 @@
+/** ---------------------------------------- LICENSE SECTION -------------------------------------------------------------------
+ *
+ * Copyright (c) 2018 Piotr Wojtowicz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * -----------------------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef IOTERM_CFG_H_
+#define IOTERM_CFG_H_
+
+#include "cfg.h"
+#include <pthread.h>
+
+#define IOCMD_USE_OUT
+#define IOCMD_USE_LOG
+#define IOCMD_USE_IN
+#define IOCMD_USE_CMD
+
+#define IOCMD_PROMOTION_INT8_TO_INT16           true
+#define IOCMD_PROMOTION_INT16_TO_INT32          true
+
+#define IOCMD_OUT_MINIMAL_STACK_USAGE           true
+
+#define IOCMD_MACRO_COMPILATION_SWITCH_ENABLE   true
+#define IOCMD_SUPPORT_VARIADIC_MACROS           true
+
+#define IOCMD_PROGRAM_MEMORY_END                0xFFFFFFFFFFFFFFFF
+#define IOCMD_MAX_LOG_LENGTH                    1280
+#define IOCMD_MAX_ENTRANCE_LENGTH               1280
+#define IOCMD_MAX_LOG__DATA_1_LENGTH            1280
+#define IOCMD_MAX_LOG__DATA_2_LENGTH            1280
+#define IOCMD_FORCE_STRINGS_COPYING             true
+#define IOCMD_DATA_COMPARE_PRINT_BOTH_CONTEXTS  true
+
+/* big enough to keep all logs of every test - outputs of different configurations are compared */
+#define IOCMD_LOG_MAIN_BUF_SIZE                 4000000
+#define IOCMD_LOG_QUIET_BUF_SIZE                200000
+
+#define IOCMD_LOGS_TREE_OS_CRITICAL_ID          IOCMD_OS_SWITCH
+
+/* logs are stored from many threads by multi-thread tests */
+extern pthread_mutex_t main_log_mutex;
+#define IOCMD_PROTECTION_INIT(params)           (0 == pthread_mutex_init(&main_log_mutex, NULL))
+#define IOCMD_PROTECTION_DEINIT(params)         pthread_mutex_destroy(&main_log_mutex)
+#define IOCMD_PROTECTION_LOCK(params)           pthread_mutex_lock(&main_log_mutex)
+#define IOCMD_PROTECTION_UNLOCK(params)         pthread_mutex_unlock(&main_log_mutex)
+
+#define IOCMD_OS_GET_CURRENT_CONTEXT_ID()       main_get_context_id()
+
+/**
+ * TEST_LOG_CONFIG selects optional feature tested by the build - it is given by Makefile.
+ * Configuration 0 doesn't enable any optional feature; logs printed by every other configuration are compared with its logs.
+ */
+#ifndef TEST_LOG_CONFIG
+#define TEST_LOG_CONFIG                         0
+#endif
+
+#if(1 == TEST_LOG_CONFIG)
+/* common staging ring only; few slots so writers often find the ring full */
+#define IOCMD_LOG_LOCK_FREE_STAGING             true
+#define IOCMD_LOG_STAGING_NUM_SLOTS             4
+#elif(2 == TEST_LOG_CONFIG)
+/* threads own staging rings, the rest of threads uses common ring */
+#define IOCMD_LOG_LOCK_FREE_STAGING             true
+#define IOCMD_LOG_STAGING_NUM_SLOTS             8
+#define IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS     2
+#define IOCMD_LOG_CONTEXT_STAGING_NUM_SLOTS     8
+#elif(3 == TEST_LOG_CONFIG)
+/* arguments compressed before the lock is taken */
+#define IOCMD_LOG_COMPRESS_OUTSIDE_LOCK         true
+#elif(4 == TEST_LOG_CONFIG)
+/* main and quiet logs kept in one buffer */
+#define IOCMD_LOG_SINGLE_STORAGE                true
+#elif(5 == TEST_LOG_CONFIG)
+/* integer arguments stored as varints */
+#define IOCMD_LOG_VARINT_ARGUMENTS              true
+#elif(6 == TEST_LOG_CONFIG)
+/* delta-coded headers; headers are built before the lock is taken */
+#define IOCMD_LOG_COMPACT_HEADER                true
+#define IOCMD_LOG_COMPACT_HEADER_KEYFRAME_PERIOD 16
+#define IOCMD_LOG_COMPRESS_OUTSIDE_LOCK         true
+#elif(7 == TEST_LOG_CONFIG)
+/* logs store index of call site descriptor instead of file, line and format */
+#define IOCMD_LOG_CALL_SITE_DESCRIPTORS         true
+#elif(8 == TEST_LOG_CONFIG)
+/* arguments stored according to types captured at call site */
+#define IOCMD_LOG_CALL_SITE_DESCRIPTORS         true
+#define IOCMD_LOG_TYPED_ARGUMENTS               true
+#elif(9 == TEST_LOG_CONFIG)
+/* runtime level checked by logging macros, before arguments are evaluated */
+#define IOCMD_LOG_INLINE_LEVEL_CHECK            true
+#elif(10 == TEST_LOG_CONFIG)
+/* function enter / exit are measured by profiler instead of being stored in logs buffers */
+#define IOCMD_LOG_PROFILER                      true
+#define IOCMD_LOG_HIGH_RES_TIME                 true
+#elif(11 == TEST_LOG_CONFIG)
+/* logs can be exported as trace-event JSON - logs printed by IOCMD_Proc_Buffered_Logs stay the same */
+#define IOCMD_LOG_TRACE_EXPORT                  true
+#elif(12 == TEST_LOG_CONFIG)
+/* time of logs read from TSC / CLOCK_MONOTONIC and printed in microseconds */
+#define IOCMD_LOG_HIGH_RES_TIME                 true
+#elif(13 == TEST_LOG_CONFIG)
+/* data comparison stores only rows which differ */
+#define IOCMD_LOG_DATA_COMPARE_DIFF_ONLY        true
+#elif(14 == TEST_LOG_CONFIG)
+/* data of data logs compressed in main / quiet buffer */
+#define IOCMD_LOG_DATA_COMPRESSION              true
+#elif(15 == TEST_LOG_CONFIG)
+/* data logs which do not fit into working buffer are stored as fragments */
+#define IOCMD_LOG_DATA_FRAGMENTATION            true
+#elif(16 == TEST_LOG_CONFIG)
+/* main and quiet buffers placed in memory given by application and moved to new memory while logging */
+#define IOCMD_LOG_EXTERNAL_BUF_MEMORY           true
+#elif(17 == TEST_LOG_CONFIG)
+/* oldest logs removed from full buffer in batches of 1/8 of the buffer, also when buffers are moved to smaller memory */
+#define IOCMD_LOG_REMOVE_LOGS_IN_BATCHES        true
+#define IOCMD_LOG_EXTERNAL_BUF_MEMORY           true
+#elif(18 == TEST_LOG_CONFIG)
+/* lengths of the oldest logs read one by one when they are removed from full buffer, instead of index of positions */
+#define IOCMD_LOG_REMOVE_LOGS_INDEX_SIZE        0
+#elif(19 == TEST_LOG_CONFIG)
+/* main and quiet logs kept in one buffer placed in memory given by application - moved by test to small memory */
+#define IOCMD_LOG_SINGLE_STORAGE                true
+#define IOCMD_LOG_EXTERNAL_BUF_MEMORY           true
+#endif
+
+#define IOCMD_LOGS_TREE \
+/*                   name              compilation switch level   compilation switch entr     default level log           default silent level log   default entrances state     description */ \
+IOCMD_LOG_ADD_MODULE(IOCMD_OS,         IOCMD_LOG_LEVEL_DEBUG_LO , IOCMD_ENTRANCE_ENABLED    , IOCMD_LOG_LEVEL_DEBUG_LO  , IOCMD_LOG_LEVEL_DEBUG_LO , IOCMD_ENTRANCE_QUIET      , "logs printed from OS callbacks") \
+IOCMD_LOG_ADD_GROUP( IOCMD_OS_SWITCH,  IOCMD_LOG_LEVEL_DEBUG_LO , IOCMD_ENTRANCE_ENABLED    , IOCMD_LOG_LEVEL_DEBUG_LO  , IOCMD_LOG_LEVEL_DEBUG_LO , IOCMD_ENTRANCE_QUIET      , "logs printed from threads context switch routine") \
+IOCMD_LOG_ADD_MODULE(MAIN_APP,         IOCMD_LOG_LEVEL_DEBUG_LO , IOCMD_ENTRANCE_ENABLED    , IOCMD_LOG_LEVEL_NOTICE    , IOCMD_LOG_LEVEL_DEBUG_LO , IOCMD_ENTRANCE_QUIET      , "logs printed from \"main\" function") \
+IOCMD_LOG_ADD_ITEM(  ARITH_ADD,        IOCMD_LOG_LEVEL_DEBUG_LO , IOCMD_ENTRANCE_ENABLED    , IOCMD_LOG_LEVEL_INFO_MID  , IOCMD_LOG_LEVEL_DEBUG_LO , IOCMD_ENTRANCE_ENABLED    , "arithmetic functions - adding") \
+IOCMD_LOG_ADD_ITEM(  MT_TEST,          IOCMD_LOG_LEVEL_DEBUG_LO , IOCMD_ENTRANCE_ENABLED    , IOCMD_LOG_LEVEL_INFO_MID  , IOCMD_LOG_LEVEL_EMERG    , IOCMD_ENTRANCE_DISABLED   , "logs of multi-thread tests")
+
+int main_get_context_id(void);
+
+#endif
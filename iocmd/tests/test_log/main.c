@@ -0,0 +1,1411 @@
+/** ---------------------------------------- LICENSE SECTION -------------------------------------------------------------------
+ *
+ * Copyright (c) 2018 Piotr Wojtowicz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * -----------------------------------------------------------------------------------------------------------------------------
+ */
+
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "iocmd.h"
+#include "iocmd_log_internal.h"
+
+/**
+ * Drains logs stored by the same sequence of logging calls to file given as first parameter.
+ * Makefile builds this application once for each TEST_LOG_CONFIG and compares every file with the one printed by
+ * configuration 0 (no optional feature enabled). Multi-thread tests print their results to stdout.
+ */
+
+#define MAIN_NUM_LOOPS                 3000
+#define MAIN_MT_NUM_THREADS            4
+#define MAIN_MT_NUM_LOGS               20000
+#define MAIN_MT_LINE_SIZE              512
+#define MAIN_SATURATION_NUM_LOGS       500000
+#define MAIN_SINGLE_STORAGE_BUF_SIZE   4096
+#define MAIN_SINGLE_STORAGE_NUM_MAIN   8
+#define MAIN_SINGLE_STORAGE_NUM_QUIET  1000
+
+pthread_mutex_t main_log_mutex;
+
+static FILE *main_log_file;
+static _Thread_local int main_context_id;
+
+int main_get_context_id(void)
+{
+   return main_context_id;
+}
+
+int main_print_text(void *dev, const char *string)
+{
+   int result = 0;
+
+   if(NULL != string)
+   {
+      result = strlen(string);
+
+      fprintf(main_log_file, "%s", string);
+   }
+
+   return result;
+}
+
+int main_print_text_repeat(void *dev, const char *string, int num_repeats)
+{
+   int result = 0;
+
+   if(NULL != string)
+   {
+      while(0 != num_repeats)
+      {
+         result += strlen(string);
+
+         fprintf(main_log_file, "%s", string);
+         num_repeats--;
+      }
+   }
+
+   return result;
+}
+
+int main_print_text_len(void *dev, const char *string, int str_len)
+{
+   int result = 0;
+
+   if(NULL != string)
+   {
+      if(0 == str_len)
+      {
+         result = strlen(string);
+
+         fprintf(main_log_file, "%s", string);
+      }
+      else
+      {
+         result = strnlen(string, str_len);
+
+         fprintf(main_log_file, "%.*s", result, string);
+      }
+   }
+
+   return result;
+}
+
+void main_print_endline_repeat(void *dev, int num_repeats)
+{
+   while(0 != num_repeats)
+   {
+      fprintf(main_log_file, "\n");
+      num_repeats--;
+   }
+}
+
+void main_print_cariage_return(void *dev)
+{
+   fprintf(main_log_file, "\r");
+}
+
+IOCMD_Print_Exe_Params_XT main_out = {
+   NULL, main_print_text, main_print_text_repeat, main_print_text_len, main_print_endline_repeat, main_print_cariage_return};
+
+
+/* multi-thread test - printed lines are not stored but checked one by one */
+typedef struct
+{
+   char         line[MAIN_MT_LINE_SIZE];
+   size_t       line_len;
+   unsigned     next_seq[MAIN_MT_NUM_THREADS];
+   long         last_cntr;
+   long         last_token;
+   unsigned     num_logs;
+   unsigned     num_errors;
+}main_mt_check_T;
+
+static main_mt_check_T main_mt_check;
+static atomic_uint     main_mt_token;
+
+static void main_mt_add_to_line(const char *string, size_t str_len)
+{
+   if(str_len > (sizeof(main_mt_check.line) - 1 - main_mt_check.line_len))
+   {
+      str_len = sizeof(main_mt_check.line) - 1 - main_mt_check.line_len;
+   }
+
+   memcpy(&main_mt_check.line[main_mt_check.line_len], string, str_len);
+   main_mt_check.line_len += str_len;
+}
+
+static void main_mt_check_line(void)
+{
+   const char *text;
+   char       *end;
+   long        cntr;
+   unsigned    thread;
+   unsigned    seq;
+   unsigned    token;
+
+   main_mt_check.line[main_mt_check.line_len] = '\0';
+
+   text = strstr(main_mt_check.line, ":: ");
+
+   if(NULL != text)
+   {
+      cntr = strtol(main_mt_check.line, &end, 10);
+
+      /* global counters are given to logs in the order in which they are moved to log buffers */
+      if((end == main_mt_check.line) || (cntr <= main_mt_check.last_cntr))
+      {
+         printf("multi-thread test: wrong log counter: %s\n", main_mt_check.line);
+         main_mt_check.num_errors++;
+      }
+      else
+      {
+         main_mt_check.last_cntr = cntr;
+      }
+
+      if(2 == sscanf(text, ":: mt %u %u", &thread, &seq))
+      {
+         /* logs of one thread are never reordered nor lost */
+         if((thread >= MAIN_MT_NUM_THREADS) || (seq != main_mt_check.next_seq[thread]))
+         {
+            printf("multi-thread test: wrong log order: %s\n", main_mt_check.line);
+            main_mt_check.num_errors++;
+         }
+         else
+         {
+            main_mt_check.next_seq[thread]++;
+         }
+         main_mt_check.num_logs++;
+      }
+      else if(1 == sscanf(text, ":: token %u", &token))
+      {
+         /* log printed after other thread's log was seen by the writer must be placed after it */
+         if((long)token <= main_mt_check.last_token)
+         {
+            printf("multi-thread test: wrong order of logs of different threads: %s\n", main_mt_check.line);
+            main_mt_check.num_errors++;
+         }
+         else
+         {
+            main_mt_check.last_token = (long)token;
+         }
+      }
+   }
+
+   main_mt_check.line_len = 0;
+}
+
+int main_mt_print_text(void *dev, const char *string)
+{
+   size_t result = strlen(string);
+
+   main_mt_add_to_line(string, result);
+
+   return (int)result;
+}
+
+int main_mt_print_text_repeat(void *dev, const char *string, int num_repeats)
+{
+   int result = 0;
+
+   while(0 != num_repeats)
+   {
+      result += main_mt_print_text(dev, string);
+      num_repeats--;
+   }
+
+   return result;
+}
+
+int main_mt_print_text_len(void *dev, const char *string, int str_len)
+{
+   size_t result = (0 == str_len) ? strlen(string) : strnlen(string, str_len);
+
+   main_mt_add_to_line(string, result);
+
+   return (int)result;
+}
+
+void main_mt_print_endline_repeat(void *dev, int num_repeats)
+{
+   if(0 != num_repeats)
+   {
+      main_mt_check_line();
+   }
+}
+
+void main_mt_print_cariage_return(void *dev)
+{
+   main_mt_check.line_len = 0;
+}
+
+IOCMD_Print_Exe_Params_XT main_mt_out = {
+   NULL, main_mt_print_text, main_mt_print_text_repeat, main_mt_print_text_len, main_mt_print_endline_repeat, main_mt_print_cariage_return};
+
+
+uint8_t working_buf[IOCMD_WORKING_BUF_RECOMMENDED_SIZE];
+uint8_t table_to_print[300];
+uint8_t table_to_compare[300];
+uint8_t table_with_runs[600];
+
+static int main_num_evaluations;
+static int main_num_adds;
+
+/* counts evaluations of log arguments */
+static int main_evaluate(int value)
+{
+   main_num_evaluations++;
+
+   return value;
+}
+
+static int main_add(int a, int b)
+{
+   int result;
+
+   IOCMD_ENTER_FUNC(ARITH_ADD);
+
+   main_num_adds++;
+
+   result = a + b;
+
+   IOCMD_DEBUG_HI_3(ARITH_ADD, "add:: a = %d; b = %d; result = %d", a, b, result);
+
+   IOCMD_EXIT_FUNC(ARITH_ADD);
+
+   return result;
+}
+
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY)
+static void *main_new_logs_memory(void)
+{
+   void *mem = malloc(IOCMD_LOG_MAIN_BUF_SIZE + IOCMD_LOG_QUIET_BUF_SIZE);
+
+   if(NULL == mem)
+   {
+      printf("memory for logs cannot be allocated\n");
+      exit(1);
+   }
+
+   return mem;
+}
+
+/* buffered logs are moved to new memory while both buffers keep logs */
+static void main_change_logs_memory(void)
+{
+   void *old_mem;
+
+   if(IOCMD_BOOL_IS_FALSE(IOCMD_Logs_Change_Memory(
+      main_new_logs_memory(), IOCMD_LOG_MAIN_BUF_SIZE, IOCMD_LOG_QUIET_BUF_SIZE, &old_mem)))
+   {
+      printf("logs memory cannot be changed\n");
+      exit(1);
+   }
+
+   free(old_mem);
+}
+#endif
+
+/* the same logs are stored by every configuration */
+static void main_store_logs(void)
+{
+   long long big = -1234567890123LL;
+   char ram_string[32];
+   int i;
+
+   for(i = 0; i < Num_Elems(table_to_print); i++)
+   {
+      table_to_print[i]   = (uint8_t)(i * 7);
+      table_to_compare[i] = (uint8_t)((3 == (i % 50)) ? i : (i * 7));
+   }
+   for(i = 0; i < Num_Elems(table_with_runs); i++)
+   {
+      table_with_runs[i] = (uint8_t)((0 == (i % 100)) ? i : (i / 25));
+   }
+   strcpy(ram_string, "ram string");
+
+   IOCMD_EMERG(MAIN_APP, "plain emerg log");
+   IOCMD_ALERT_3(MAIN_APP, "ints: %d %u %x", -5, 7U, 0xABCDU);
+   IOCMD_ALERT_4(MAIN_APP, "widths: [%5d] [%-5d] [%05d] [%+d]", 12, 13, 14, 15);
+   IOCMD_ALERT_3(MAIN_APP, "str: %s |%10s| |%.3s|", ram_string, "lit", "truncate");
+   IOCMD_ALERT_2(MAIN_APP, "char %c and %%%c", 'a', 'b');
+   IOCMD_ALERT_2(MAIN_APP, "ll %lld %llx", big, (unsigned long long)big);
+   IOCMD_ALERT_4(MAIN_APP, "var %*d|%.*d", 6, 42, 3, 7);
+   /* signed / unsigned char pointers are not strings unless they are consumed by %s */
+   IOCMD_ALERT_2(MAIN_APP, "packet at %p value %d", (uint8_t*)(uintptr_t)0x1000, 5);
+   IOCMD_ALERT_1(MAIN_APP, "unsigned char string: %s", (unsigned char*)ram_string);
+   IOCMD_ALERT_2(MAIN_APP, "string as pointer: %p, %s", (void*)(uintptr_t)0x2000, ram_string);
+   IOCMD_NOTICE_1(MAIN_APP, "multi\nline %d\n", 9);
+   IOCMD_INFO_HI_1(MAIN_APP, "quiet only %d", 1);
+   IOCMD_LOG_DATA_ALERT_1(MAIN_APP, table_to_print, sizeof(table_to_print), "data log %d", 1);
+   IOCMD_LOG_DATA_ALERT_1(MAIN_APP, table_with_runs, sizeof(table_with_runs), "data with runs %d", 3);
+   IOCMD_COMPARE_DATA_ALERT_1(MAIN_APP, table_to_print, 100, table_to_compare, 100, "compare %d", 2);
+   main_add(2, 3);
+   /* MT_TEST logs with level DEBUG_LO are stored only when temporary level allows it */
+   IOCMD_DEBUG_LO_1(MT_TEST, "disabled %d", main_evaluate(1));
+   IOCMD_Set_Temporary_Main_Level(IOCMD_LOG_LEVEL_DEBUG_LO);
+   IOCMD_DEBUG_LO_1(MT_TEST, "temporary level %d", main_evaluate(2));
+   IOCMD_Clear_Temporary_Main_Level();
+   IOCMD_DEBUG_LO_1(MT_TEST, "disabled %d", main_evaluate(3));
+   IOCMD_Proc_Buffered_Logs(IOCMD_TRUE, &main_out, working_buf, sizeof(working_buf));
+
+   for(i = 0; i < MAIN_NUM_LOOPS; i++)
+   {
+      IOCMD_ALERT_2(MAIN_APP, "loop %d of %s", i, "many");
+
+      if(0 == (i % 97))
+      {
+         IOCMD_LOG_DATA_ALERT_1(MAIN_APP, table_to_print, 40 + (i % 200), "loop data %d", i);
+      }
+      if(0 == (i % 89))
+      {
+         main_add(i, 1);
+      }
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY)
+      if((MAIN_NUM_LOOPS / 2) == i)
+      {
+         main_change_logs_memory();
+      }
+#endif
+   }
+   IOCMD_Proc_Buffered_Logs(IOCMD_TRUE, &main_out, working_buf, sizeof(working_buf));
+   IOCMD_Proc_Buffered_Logs(IOCMD_FALSE, &main_out, working_buf, sizeof(working_buf));
+}
+
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+/* descriptor of every log keeps types of its arguments, also when they are not used to store the log */
+static int main_call_sites_test(void)
+{
+   const IOCMD_Log_Call_Site_XT *call_sites;
+   uint_fast32_t num_call_sites;
+   uint_fast32_t cntr;
+   int result = 1;
+
+   call_sites = IOCMD_Log_Get_Call_Sites(&num_call_sites);
+
+   for(cntr = 0; cntr < num_call_sites; cntr++)
+   {
+      if(0 == strcmp(call_sites[cntr].format, "packet at %p value %d"))
+      {
+         if((2 == call_sites[cntr].num_args)
+            && ((IOCMD_LOG_ARG_POINTER | (IOCMD_LOG_ARG_INT << 4)) == call_sites[cntr].arg_types))
+         {
+            result = 0;
+         }
+      }
+   }
+
+   if(0 == result)
+   {
+      printf("call site descriptors test finished successfully\n");
+   }
+   else
+   {
+      printf("call site descriptors test NOK\n");
+   }
+
+   return result;
+}
+#endif
+
+/* logs of every level from one log id; effective main and quiet levels of the id are read back from printed logs */
+#define MAIN_LEVELS_STORE(id, step) \
+   IOCMD_EMERG_3(      id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_EMERG); \
+   IOCMD_ALERT_3(      id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_ALERT); \
+   IOCMD_CRIT_3(       id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_CRIT); \
+   IOCMD_ERROR_3(      id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_ERROR); \
+   IOCMD_WARN_3(       id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_WARN); \
+   IOCMD_NOTICE_3(     id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_NOTICE); \
+   IOCMD_INFO_HI_3(    id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_INFO_HI); \
+   IOCMD_INFO_MID_3(   id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_INFO_MID); \
+   IOCMD_INFO_LO_3(    id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_INFO_LO); \
+   IOCMD_DEBUG_HI_3(   id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_DEBUG_HI); \
+   IOCMD_DEBUG_MID_3(  id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_DEBUG_MID); \
+   IOCMD_DEBUG_LO_3(   id, "levels %d %d %d", step, id, IOCMD_LOG_LEVEL_DEBUG_LO)
+
+#define MAIN_LEVELS_NUM_IDS         4
+#define MAIN_LEVELS_NUM_STEPS       5
+
+/* checks that logs of every id are stored up to expected main level and only in quiet buffer up to expected quiet level */
+static int main_levels_check(int step, const uint8_t expected[MAIN_LEVELS_NUM_IDS][2])
+{
+   static const int ids[MAIN_LEVELS_NUM_IDS] = {IOCMD_OS, IOCMD_OS_SWITCH, ARITH_ADD, MT_TEST};
+   char line[MAIN_MT_LINE_SIZE];
+   const char *text;
+   unsigned main_levels[MAIN_LEVELS_NUM_IDS] = {0};
+   unsigned quiet_levels[MAIN_LEVELS_NUM_IDS] = {0};
+   unsigned expected_main;
+   unsigned expected_quiet;
+   int log_step;
+   int id;
+   int level;
+   int cntr;
+   int result = 1;
+
+   main_log_file = tmpfile();
+
+   if(NULL != main_log_file)
+   {
+      MAIN_LEVELS_STORE(IOCMD_OS, step);
+      MAIN_LEVELS_STORE(IOCMD_OS_SWITCH, step);
+      MAIN_LEVELS_STORE(ARITH_ADD, step);
+      MAIN_LEVELS_STORE(MT_TEST, step);
+
+      IOCMD_Proc_Buffered_Logs(IOCMD_TRUE, &main_out, working_buf, sizeof(working_buf));
+
+      rewind(main_log_file);
+      result = 0;
+
+      while(NULL != fgets(line, sizeof(line), main_log_file))
+      {
+         text = strstr(line, ":: levels ");
+
+         if((NULL != text) && (3 == sscanf(text, ":: levels %d %d %d", &log_step, &id, &level)) && (step == log_step))
+         {
+            for(cntr = 0; cntr < MAIN_LEVELS_NUM_IDS; cntr++)
+            {
+               if(id == ids[cntr])
+               {
+                  if(NULL != strstr(line, "--QUIET---"))
+                  {
+                     quiet_levels[cntr] |= 1U << level;
+                  }
+                  else
+                  {
+                     main_levels[cntr] |= 1U << level;
+                  }
+               }
+            }
+         }
+      }
+      fclose(main_log_file);
+
+      for(cntr = 0; cntr < MAIN_LEVELS_NUM_IDS; cntr++)
+      {
+         expected_main  = (2U << expected[cntr][0]) - 1U;
+         expected_quiet = ((2U << expected[cntr][1]) - 1U) & (~expected_main);
+
+         if((expected_main != main_levels[cntr]) || (expected_quiet != quiet_levels[cntr]))
+         {
+            printf("levels step %d, log %d: main 0x%X quiet 0x%X, expected main 0x%X quiet 0x%X\n",
+               step, ids[cntr], main_levels[cntr], quiet_levels[cntr], expected_main, expected_quiet);
+            result = 1;
+         }
+      }
+   }
+
+   return result;
+}
+
+/* levels set by commands for groups and modules and temporary levels set / cleared by functions and by commands */
+static int main_levels_test(void)
+{
+   static const char *set_mod_main[]      = {IOCMD_CMD_ROOT, "log", "set", "active", "module", "MAIN_APP", "4"};
+   static const char *set_mod_quiet[]     = {IOCMD_CMD_ROOT, "log", "set", "quiet",  "module", "MAIN_APP", "8"};
+   static const char *set_os_main[]       = {IOCMD_CMD_ROOT, "log", "set", "active", "module", "IOCMD_OS", "2"};
+   static const char *set_os_quiet[]      = {IOCMD_CMD_ROOT, "log", "set", "quiet",  "module", "IOCMD_OS", "6"};
+   static const char *set_grp_main[]      = {IOCMD_CMD_ROOT, "log", "set", "active", "group",  "IOCMD_OS_SWITCH", "3"};
+   static const char *set_grp_quiet[]     = {IOCMD_CMD_ROOT, "log", "set", "quiet",  "group",  "IOCMD_OS_SWITCH", "5"};
+   static const char *temp_main[]         = {IOCMD_CMD_ROOT, "log", "temp", "active", "2"};
+   static const char *temp_quiet_off[]    = {IOCMD_CMD_ROOT, "log", "temp", "quiet", "off"};
+   /* {main, quiet} for IOCMD_OS, IOCMD_OS_SWITCH, ARITH_ADD, MT_TEST after every step */
+   static const uint8_t expected[MAIN_LEVELS_NUM_STEPS][MAIN_LEVELS_NUM_IDS][2] =
+   {
+      /* module, then group inside of module, set by commands */
+      {{2, 6}, {3, 5}, {4, 8}, {4, 8}},
+      /* temporary levels set by functions */
+      {{1, 9}, {1, 9}, {1, 9}, {1, 9}},
+      /* temporary main level set by command */
+      {{2, 9}, {2, 9}, {2, 9}, {2, 9}},
+      /* temporary quiet level cleared by command */
+      {{2, 6}, {2, 5}, {2, 8}, {2, 8}},
+      /* temporary main level cleared by function */
+      {{2, 6}, {3, 5}, {4, 8}, {4, 8}}
+   };
+   int result = 0;
+
+   main_log_file = tmpfile();
+
+   if(NULL != main_log_file)
+   {
+      (void)IOCMD_Parse_Lib_Commands(Num_Elems(set_mod_main),  set_mod_main,  &main_out, IOCMD_TRUE);
+      (void)IOCMD_Parse_Lib_Commands(Num_Elems(set_mod_quiet), set_mod_quiet, &main_out, IOCMD_TRUE);
+      (void)IOCMD_Parse_Lib_Commands(Num_Elems(set_os_main),   set_os_main,   &main_out, IOCMD_TRUE);
+      (void)IOCMD_Parse_Lib_Commands(Num_Elems(set_os_quiet),  set_os_quiet,  &main_out, IOCMD_TRUE);
+      (void)IOCMD_Parse_Lib_Commands(Num_Elems(set_grp_main),  set_grp_main,  &main_out, IOCMD_TRUE);
+      (void)IOCMD_Parse_Lib_Commands(Num_Elems(set_grp_quiet), set_grp_quiet, &main_out, IOCMD_TRUE);
+      /* logs stored before are not checked */
+      IOCMD_Proc_Buffered_Logs(IOCMD_TRUE, &main_out, working_buf, sizeof(working_buf));
+      fclose(main_log_file);
+   }
+
+   result |= main_levels_check(0, expected[0]);
+
+   IOCMD_Set_Temporary_Main_Level(IOCMD_LOG_LEVEL_ALERT);
+   IOCMD_Set_Temporary_Quiet_Level(IOCMD_LOG_LEVEL_DEBUG_HI);
+   result |= main_levels_check(1, expected[1]);
+
+   main_log_file = tmpfile();
+
+   if(NULL != main_log_file)
+   {
+      (void)IOCMD_Parse_Lib_Commands(Num_Elems(temp_main), temp_main, &main_out, IOCMD_TRUE);
+      fclose(main_log_file);
+   }
+   result |= main_levels_check(2, expected[2]);
+
+   main_log_file = tmpfile();
+
+   if(NULL != main_log_file)
+   {
+      (void)IOCMD_Parse_Lib_Commands(Num_Elems(temp_quiet_off), temp_quiet_off, &main_out, IOCMD_TRUE);
+      fclose(main_log_file);
+   }
+   result |= main_levels_check(3, expected[3]);
+
+   IOCMD_Clear_Temporary_Main_Level();
+   result |= main_levels_check(4, expected[4]);
+
+   if(0 == result)
+   {
+      printf("levels test finished successfully\n");
+   }
+   else
+   {
+      printf("levels test NOK\n");
+   }
+
+   return result;
+}
+
+#ifdef TEST_LOG_CPP
+void main_cpp_store_logs(void);
+
+/* log stored by C++ code (main_cpp.cpp) is printed the same as from C and is stored with types captured by templates */
+static int main_cpp_test(void)
+{
+   const IOCMD_Log_Call_Site_XT *call_sites;
+   uint_fast32_t num_call_sites;
+   uint_fast32_t cntr;
+   char line[MAIN_MT_LINE_SIZE];
+   int num_found = 0;
+   int result = 1;
+
+   main_log_file = tmpfile();
+
+   if(NULL != main_log_file)
+   {
+      main_cpp_store_logs();
+      IOCMD_Proc_Buffered_Logs(IOCMD_FALSE, &main_out, working_buf, sizeof(working_buf));
+
+      rewind(main_log_file);
+
+      while(NULL != fgets(line, sizeof(line), main_log_file))
+      {
+         if(NULL != strstr(line, "c++ typed args: 5 text 3 -7"))
+         {
+            num_found++;
+         }
+      }
+      fclose(main_log_file);
+   }
+
+   call_sites = IOCMD_Log_Get_Call_Sites(&num_call_sites);
+
+   for(cntr = 0; cntr < num_call_sites; cntr++)
+   {
+      if((0 == strcmp(call_sites[cntr].format, "c++ typed args: %d %s %u %ld"))
+         && ((IOCMD_LOG_ARG_INT | (IOCMD_LOG_ARG_STRING << 4) | (IOCMD_LOG_ARG_INT << 8) | (IOCMD_LOG_ARG_LONG << 12))
+            == call_sites[cntr].arg_types)
+         && (IOCMD_LOG_ARG_TYPES_VALID == atomic_load(call_sites[cntr].arg_types_check)))
+      {
+         num_found++;
+      }
+   }
+
+   if(2 == num_found)
+   {
+      result = 0;
+      printf("c++ typed arguments test finished successfully\n");
+   }
+   else
+   {
+      printf("c++ typed arguments test NOK\n");
+   }
+
+   return result;
+}
+#endif
+
+#if(IOCMD_LOG_PROFILER)
+/* every call of main_add is counted by profiler and printed by command "out prof" */
+static int main_prof_test(void)
+{
+   const char *argv[] = {IOCMD_CMD_ROOT, "prof"};
+   IOCMD_Log_Profiler_Stats_XT stats;
+   char line[MAIN_MT_LINE_SIZE];
+   char func_name[MAIN_MT_LINE_SIZE];
+   char log_name[MAIN_MT_LINE_SIZE];
+   unsigned long long num_calls;
+   size_t index;
+   int num_found = 0;
+   int result = 1;
+
+   for(index = 0; index < IOCMD_LOG_PROFILER_NUM_FUNCTIONS; index++)
+   {
+      if(IOCMD_Log_Get_Profiler_Stats(index, &stats) && (0 == strcmp(stats.func_name, "main_add")))
+      {
+         if((main_num_adds == stats.num_calls) && (stats.min_time <= stats.max_time)
+            && (stats.total_time >= (stats.num_calls * stats.min_time)))
+         {
+            num_found++;
+         }
+      }
+   }
+
+   main_log_file = tmpfile();
+
+   if(NULL != main_log_file)
+   {
+      if(IOCMD_BOOL_IS_TRUE(IOCMD_Parse_Lib_Commands(Num_Elems(argv), argv, &main_out, IOCMD_TRUE)))
+      {
+         rewind(main_log_file);
+
+         while(NULL != fgets(line, sizeof(line), main_log_file))
+         {
+            if((3 == sscanf(line, " %s %s %llu", func_name, log_name, &num_calls))
+               && (0 == strcmp(func_name, "main_add")) && (0 == strcmp(log_name, "ARITH_ADD"))
+               && (main_num_adds == num_calls))
+            {
+               num_found++;
+            }
+         }
+      }
+      fclose(main_log_file);
+   }
+
+   if(2 == num_found)
+   {
+      result = 0;
+      printf("profiler test finished successfully\n");
+   }
+   else
+   {
+      printf("profiler test NOK\n");
+   }
+
+   return result;
+}
+#endif
+
+#if(IOCMD_LOG_TRACE_EXPORT)
+/* logs and function enter / exit are exported as one trace event per line; data logs are not exported */
+static int main_trace_test(void)
+{
+   static const char * const events[][2] =
+   {
+      {"[",                 "\n"},
+      {"{\"ph\":\"i\",",     "\"cat\":\"log\",\"name\":\"ALERT\",\"args\":{\"msg\":\"trace \\\"quoted\\\" 7\",\"file\":\"main.c\","},
+      {"{\"ph\":\"B\",",     "\"cat\":\"function\",\"name\":\"main_add\"},\n"},
+      {"{\"ph\":\"E\",",     "\"cat\":\"function\",\"name\":\"main_add\"},\n"}
+   };
+   char line[MAIN_MT_LINE_SIZE];
+   size_t num_lines = 0;
+   int result = 1;
+
+   IOCMD_ALERT_2(MAIN_APP, "trace \"%s\" %d\n", "quoted", 7);
+   IOCMD_LOG_DATA_ALERT(MAIN_APP, table_to_print, 16, "trace data");
+   main_add(1, 1);
+
+   main_log_file = tmpfile();
+
+   if(NULL != main_log_file)
+   {
+      IOCMD_Proc_Buffered_Logs_Trace(IOCMD_FALSE, IOCMD_TRUE, &main_out, working_buf, sizeof(working_buf));
+
+      rewind(main_log_file);
+      result = 0;
+
+      while(NULL != fgets(line, sizeof(line), main_log_file))
+      {
+         if((num_lines >= Num_Elems(events))
+            || (0 != strncmp(line, events[num_lines][0], strlen(events[num_lines][0])))
+            || (NULL == strstr(line, events[num_lines][1])))
+         {
+            result = 1;
+         }
+         num_lines++;
+      }
+      fclose(main_log_file);
+   }
+
+   if((0 == result) && (Num_Elems(events) == num_lines))
+   {
+      printf("trace export test finished successfully\n");
+   }
+   else
+   {
+      result = 1;
+      printf("trace export test NOK\n");
+   }
+
+   return result;
+}
+#endif
+
+#if(IOCMD_LOG_DATA_COMPRESSION)
+/* data with runs of equal bytes takes in main buffer much less than its size */
+static int main_compression_test(void)
+{
+   IOCMD_Buff_Params_Readout_XT before;
+   IOCMD_Buff_Params_Readout_XT after;
+   int result = 1;
+
+   IOCMD_Log_Get_Buf_Params(&before);
+   IOCMD_LOG_DATA_ALERT(MAIN_APP, table_with_runs, sizeof(table_with_runs), "compressed data");
+   IOCMD_Log_Get_Buf_Params(&after);
+
+   if((after.main_buf_current_used_size - before.main_buf_current_used_size) < (sizeof(table_with_runs) / 2))
+   {
+      result = 0;
+      printf("data compression test finished successfully\n");
+   }
+   else
+   {
+      printf("data compression test NOK\n");
+   }
+
+   return result;
+}
+#endif
+
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+/* data much bigger than working buffer is printed fully, row by row */
+static int main_fragmentation_test(void)
+{
+   static uint8_t table_big[6000];
+   char line[MAIN_MT_LINE_SIZE];
+   unsigned begin;
+   unsigned end;
+   unsigned size;
+   unsigned first;
+   unsigned next = 0;
+   size_t i;
+   int result = 1;
+
+   for(i = 0; i < Num_Elems(table_big); i++)
+   {
+      table_big[i] = (uint8_t)((i * 13) + (i / 256));
+   }
+
+   IOCMD_LOG_DATA_ALERT(MAIN_APP, table_big, sizeof(table_big), "fragmented data");
+
+   main_log_file = tmpfile();
+
+   if(NULL != main_log_file)
+   {
+      IOCMD_Proc_Buffered_Logs(IOCMD_FALSE, &main_out, working_buf, sizeof(working_buf));
+
+      rewind(main_log_file);
+      result = 0;
+
+      while(NULL != fgets(line, sizeof(line), main_log_file))
+      {
+         if(4 == sscanf(line, "%*u %u-%u/%u: %x", &begin, &end, &size, &first))
+         {
+            if((begin != next) || (end < begin) || (size != sizeof(table_big)) || (first != table_big[begin]))
+            {
+               result = 1;
+            }
+            next = end + 1;
+         }
+      }
+      fclose(main_log_file);
+   }
+
+   if((0 == result) && (sizeof(table_big) == next))
+   {
+      printf("data fragmentation test finished successfully\n");
+   }
+   else
+   {
+      result = 1;
+      printf("data fragmentation test NOK\n");
+   }
+
+   return result;
+}
+#endif
+
+/**
+ * saturation benchmark - quiet buffer is full all the time so the oldest logs are removed again and again;
+ * logs which stay in the buffer must be the newest ones, consecutive and readable
+ */
+static int main_saturation_test(void)
+{
+   struct timespec start;
+   struct timespec end;
+   char line[MAIN_MT_LINE_SIZE];
+   const char *found;
+   double seconds;
+   int num_read = 0;
+   int next = -1;
+   int value;
+   int i;
+   int result = 1;
+
+   IOCMD_Clear_All_Logs(IOCMD_TRUE);
+
+   clock_gettime(CLOCK_MONOTONIC, &start);
+   for(i = 0; i < MAIN_SATURATION_NUM_LOGS; i++)
+   {
+      /* quiet log only */
+      IOCMD_DEBUG_LO_1(MAIN_APP, "saturation %d", i);
+   }
+   clock_gettime(CLOCK_MONOTONIC, &end);
+
+   seconds = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1000000000.0);
+
+   main_log_file = tmpfile();
+
+   if(NULL != main_log_file)
+   {
+      IOCMD_Proc_Buffered_Logs(IOCMD_TRUE, &main_out, working_buf, sizeof(working_buf));
+
+      rewind(main_log_file);
+      result = 0;
+
+      while(NULL != fgets(line, sizeof(line), main_log_file))
+      {
+         found = strstr(line, "saturation ");
+
+         if((NULL != found) && (1 == sscanf(found, "saturation %d", &value)))
+         {
+            if((next >= 0) && (value != next))
+            {
+               result = 1;
+            }
+            next = value + 1;
+            num_read++;
+         }
+      }
+      fclose(main_log_file);
+   }
+
+   /* at least half of the buffer must be kept - every log takes less than 64 bytes */
+   if((0 == result) && (MAIN_SATURATION_NUM_LOGS == next) && (num_read > (IOCMD_LOG_QUIET_BUF_SIZE / 2 / 64)))
+   {
+      printf("saturated quiet buffer: %.0f logs per second, %d logs kept\n", (double)MAIN_SATURATION_NUM_LOGS / seconds, num_read);
+      printf("saturation test finished successfully\n");
+   }
+   else
+   {
+      result = 1;
+      printf("saturation test NOK\n");
+   }
+
+   return result;
+}
+
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY)
+/* when buffers are moved to smaller memory, the oldest logs are removed so 1/8 of new quiet buffer stays free */
+static int main_shrink_memory_test(void)
+{
+   IOCMD_Buff_Params_Readout_XT params;
+   void *old_mem;
+   int i;
+   int result = 1;
+
+   for(i = 0; i < (IOCMD_LOG_QUIET_BUF_SIZE / 8); i++)
+   {
+      IOCMD_ALERT_1(MAIN_APP, "fill %d", i);
+   }
+
+   if(IOCMD_BOOL_IS_TRUE(IOCMD_Logs_Change_Memory(
+      main_new_logs_memory(), IOCMD_LOG_MAIN_BUF_SIZE, IOCMD_LOG_QUIET_BUF_SIZE / 2, &old_mem)))
+   {
+      free(old_mem);
+      IOCMD_Log_Get_Buf_Params(&params);
+
+      if((params.quiet_buf_current_used_size > 0)
+         && (params.quiet_buf_current_used_size <= (params.quiet_buf_size - (params.quiet_buf_size / 8))))
+      {
+         result = 0;
+      }
+   }
+
+   if(0 == result)
+   {
+      printf("buffers shrinking test finished successfully\n");
+   }
+   else
+   {
+      printf("buffers shrinking test NOK\n");
+   }
+
+   return result;
+}
+
+
+/* memory too small for buffers is refused and logs stay where they were */
+static int main_too_small_memory_test(void)
+{
+   IOCMD_Buff_Params_Readout_XT before;
+   IOCMD_Buff_Params_Readout_XT after;
+   uint8_t small_mem[64];
+   void *old_mem = small_mem;
+   int result = 1;
+
+   IOCMD_Log_Get_Buf_Params(&before);
+
+   if(IOCMD_BOOL_IS_FALSE(IOCMD_Logs_Change_Memory(small_mem, sizeof(small_mem) / 2, sizeof(small_mem) / 2, &old_mem))
+      && (old_mem == small_mem))
+   {
+      IOCMD_Log_Get_Buf_Params(&after);
+
+      if((after.main_buf_size == before.main_buf_size) && (after.quiet_buf_size == before.quiet_buf_size)
+         && (after.main_buf_current_used_size == before.main_buf_current_used_size)
+         && (after.quiet_buf_current_used_size == before.quiet_buf_current_used_size))
+      {
+         result = 0;
+      }
+   }
+
+   if(0 == result)
+   {
+      printf("too small memory test finished successfully\n");
+   }
+   else
+   {
+      printf("too small memory test NOK\n");
+   }
+
+   return result;
+}
+#endif
+
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY && IOCMD_LOG_SINGLE_STORAGE)
+/* burst of quiet logs in small common buffer removes main logs which were not printed yet - only the newest logs stay */
+static int main_single_storage_test(void)
+{
+   char line[MAIN_MT_LINE_SIZE];
+   const char *text;
+   void *old_mem;
+   int quiet_view = 0;
+   int num_main[2] = {0, 0};
+   int num_quiet = 0;
+   int last_quiet = -1;
+   int value;
+   int i;
+   int result = 1;
+
+   main_log_file = tmpfile();
+
+   if((NULL != main_log_file) && IOCMD_BOOL_IS_TRUE(IOCMD_Logs_Change_Memory(
+      malloc(2 * MAIN_SINGLE_STORAGE_BUF_SIZE), MAIN_SINGLE_STORAGE_BUF_SIZE, MAIN_SINGLE_STORAGE_BUF_SIZE, &old_mem)))
+   {
+      free(old_mem);
+      result = 0;
+
+      /* logs stored before are not checked */
+      IOCMD_Proc_Buffered_Logs(IOCMD_TRUE, &main_out, working_buf, sizeof(working_buf));
+      rewind(main_log_file);
+
+      for(i = 0; i < MAIN_SINGLE_STORAGE_NUM_MAIN; i++)
+      {
+         IOCMD_ALERT_1(MAIN_APP, "single storage main %d", i);
+      }
+      for(i = 0; i < MAIN_SINGLE_STORAGE_NUM_QUIET; i++)
+      {
+         IOCMD_DEBUG_LO_1(MAIN_APP, "single storage quiet %d", i);
+      }
+      IOCMD_ALERT_1(MAIN_APP, "single storage main %d", MAIN_SINGLE_STORAGE_NUM_MAIN);
+
+      IOCMD_Proc_Buffered_Logs(IOCMD_FALSE, &main_out, working_buf, sizeof(working_buf));
+      fprintf(main_log_file, "quiet view\n");
+      IOCMD_Proc_Buffered_Logs(IOCMD_TRUE, &main_out, working_buf, sizeof(working_buf));
+
+      rewind(main_log_file);
+
+      while(NULL != fgets(line, sizeof(line), main_log_file))
+      {
+         if(0 == strcmp(line, "quiet view\n"))
+         {
+            quiet_view = 1;
+         }
+         else if(NULL != (text = strstr(line, ":: single storage main ")))
+         {
+            /* only main log stored after the burst is kept */
+            if((1 != sscanf(text, ":: single storage main %d", &value)) || (MAIN_SINGLE_STORAGE_NUM_MAIN != value))
+            {
+               result = 1;
+            }
+            num_main[quiet_view]++;
+         }
+         else if(NULL != (text = strstr(line, ":: single storage quiet ")))
+         {
+            /* quiet logs are kept from some point up to the last one, without gaps */
+            if((0 == quiet_view) || (1 != sscanf(text, ":: single storage quiet %d", &value))
+               || ((last_quiet >= 0) && (value != (last_quiet + 1))))
+            {
+               result = 1;
+            }
+            last_quiet = value;
+            num_quiet++;
+         }
+      }
+      fclose(main_log_file);
+   }
+
+   if((0 == result) && (1 == num_main[0]) && (num_main[1] <= 1)
+      && (num_quiet > 0) && (num_quiet < MAIN_SINGLE_STORAGE_NUM_QUIET) && ((MAIN_SINGLE_STORAGE_NUM_QUIET - 1) == last_quiet))
+   {
+      printf("single storage test finished successfully\n");
+   }
+   else
+   {
+      result = 1;
+      printf("single storage test NOK\n");
+   }
+
+   return result;
+}
+#endif
+
+#if(IOCMD_LOG_REMOVE_LOGS_IN_BATCHES)
+/* when quiet buffer gets full, 1/8 of it is released above free space requested for next log */
+static int main_batch_removal_test(void)
+{
+   IOCMD_Buff_Params_Readout_XT params;
+   size_t last_used = 0;
+   size_t free_size = 0;
+   int i;
+   int result = 1;
+
+   for(i = 0; i < 1000000; i++)
+   {
+      IOCMD_ALERT_1(MAIN_APP, "fill %d", i);
+      IOCMD_Log_Get_Buf_Params(&params);
+
+      if(params.quiet_buf_current_used_size < last_used)
+      {
+         free_size = params.quiet_buf_size - params.quiet_buf_current_used_size;
+         break;
+      }
+      last_used = params.quiet_buf_current_used_size;
+   }
+
+   if(free_size > ((params.quiet_buf_size / 8) + IOCMD_LOG_HEADER_SIZE + IOCMD_MAX_LOG_LENGTH))
+   {
+      result = 0;
+      printf("batch removal test finished successfully\n");
+   }
+   else
+   {
+      printf("batch removal test NOK\n");
+   }
+
+   return result;
+}
+#endif
+
+#if(IOCMD_LOG_HIGH_RES_TIME)
+/* times printed from log file must grow from 0 (IOCMD_Logs_Init) and stay in range of the test execution time */
+static int main_time_test(const char *file_name)
+{
+   FILE *file = fopen(file_name, "r");
+   char line[MAIN_MT_LINE_SIZE];
+   const char *time;
+   double value;
+   double last = 0.0;
+   int result = 0;
+
+   if(NULL == file)
+   {
+      result = 1;
+   }
+   else
+   {
+      while(NULL != fgets(line, sizeof(line), file))
+      {
+         time = strstr(line, " [");
+
+         if((NULL != time) && (NULL != strstr(line, "] T:")) && (1 == sscanf(time, " [%lf]", &value)))
+         {
+            if((value < last) || (value > 60.0))
+            {
+               result = 1;
+            }
+            last = value;
+         }
+      }
+      fclose(file);
+   }
+
+   if(0 == result)
+   {
+      printf("high resolution time test finished successfully\n");
+   }
+   else
+   {
+      printf("high resolution time test NOK\n");
+   }
+
+   return result;
+}
+#endif
+
+static void *main_mt_thread(void *arg)
+{
+   unsigned thread = (unsigned)(uintptr_t)arg;
+   unsigned seq;
+   unsigned token;
+
+   main_context_id = (int)thread + 1;
+
+   for(seq = 0; seq < MAIN_MT_NUM_LOGS; seq++)
+   {
+      /* data logs are stored directly in log buffers, other logs can wait in staging rings */
+      if(0 == (seq % 64))
+      {
+         IOCMD_LOG_DATA_NOTICE_2(MT_TEST, table_to_print, 16, "mt %u %u", thread, seq);
+      }
+      else
+      {
+         IOCMD_NOTICE_2(MT_TEST, "mt %u %u", thread, seq);
+      }
+
+      /* token is passed from thread to thread - each one logs it before passing it to the next one */
+      token = atomic_load_explicit(&main_mt_token, memory_order_acquire);
+
+      if(thread == (token % MAIN_MT_NUM_THREADS))
+      {
+         IOCMD_NOTICE_1(MT_TEST, "token %u", token);
+
+         atomic_store_explicit(&main_mt_token, token + 1U, memory_order_release);
+      }
+   }
+
+   IOCMD_Log_Thread_Exit();
+
+   return NULL;
+}
+
+#if(IOCMD_LOG_LOCK_FREE_STAGING && (IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0))
+/* finished threads gave their staging rings back; main thread keeps its ring until it calls IOCMD_Log_Thread_Exit */
+static int main_context_rings_test(void)
+{
+   IOCMD_Buff_Params_Readout_XT params;
+   size_t used[3];
+   int result = 1;
+
+   IOCMD_Log_Get_Buf_Params(&params);
+   used[0] = params.context_staging_rings_used;
+
+   IOCMD_Log_Thread_Exit();
+   IOCMD_Log_Get_Buf_Params(&params);
+   used[1] = params.context_staging_rings_used;
+
+   IOCMD_ALERT(MAIN_APP, "main thread logs again");
+   IOCMD_Log_Get_Buf_Params(&params);
+   used[2] = params.context_staging_rings_used;
+
+   if((1 == used[0]) && (0 == used[1]) && (1 == used[2]))
+   {
+      result = 0;
+      printf("context staging rings test finished successfully\n");
+   }
+   else
+   {
+      printf("context staging rings test NOK\n");
+   }
+
+   return result;
+}
+#endif
+
+/* threads log in parallel while main thread prints logs; logs must be complete and in order */
+static int main_mt_test(void)
+{
+   pthread_t threads[MAIN_MT_NUM_THREADS];
+   unsigned cntr;
+   int result = 0;
+
+   memset(&main_mt_check, 0, sizeof(main_mt_check));
+   main_mt_check.last_cntr  = -1;
+   main_mt_check.last_token = -1;
+   atomic_store(&main_mt_token, 0U);
+
+   /* logs stored before are not checked */
+   IOCMD_Clear_All_Logs(IOCMD_TRUE);
+
+   for(cntr = 0; cntr < MAIN_MT_NUM_THREADS; cntr++)
+   {
+      if(0 != pthread_create(&threads[cntr], NULL, main_mt_thread, (void*)(uintptr_t)cntr))
+      {
+         printf("multi-thread test: thread cannot be created\n");
+         return 1;
+      }
+   }
+
+   while(main_mt_check.num_logs < (MAIN_MT_NUM_THREADS * MAIN_MT_NUM_LOGS))
+   {
+      IOCMD_Proc_Buffered_Logs(IOCMD_FALSE, &main_mt_out, working_buf, sizeof(working_buf));
+
+      if(0 != main_mt_check.num_errors)
+      {
+         break;
+      }
+
+      sched_yield();
+   }
+
+   for(cntr = 0; cntr < MAIN_MT_NUM_THREADS; cntr++)
+   {
+      pthread_join(threads[cntr], NULL);
+   }
+
+   if((0 == main_mt_check.num_errors) && (main_mt_check.last_token >= 0))
+   {
+      printf("multi-thread test finished successfully\n");
+   }
+   else
+   {
+      printf("multi-thread test NOK\n");
+      result = 1;
+   }
+
+   return result;
+}
+
+int main(int argc, const char* argv[])
+{
+   int result = 0;
+
+   main_log_file = stdout;
+
+   if(argc > 1)
+   {
+      main_log_file = fopen(argv[1], "w");
+
+      if(NULL == main_log_file)
+      {
+         printf("file %s cannot be opened\n", argv[1]);
+         return 1;
+      }
+   }
+
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY)
+   if(IOCMD_BOOL_IS_FALSE(IOCMD_Logs_Init_With_Memory(
+      main_new_logs_memory(), IOCMD_LOG_MAIN_BUF_SIZE, IOCMD_LOG_QUIET_BUF_SIZE)))
+#else
+   if(IOCMD_BOOL_IS_FALSE(IOCMD_Logs_Init()))
+#endif
+   {
+      printf("logs initialization failed\n");
+      return 1;
+   }
+
+   IOCMD_Install_Standard_Output(&main_out);
+
+   main_store_logs();
+
+   if(stdout != main_log_file)
+   {
+      fclose(main_log_file);
+   }
+
+   result |= main_mt_test();
+
+   result |= main_saturation_test();
+
+#if(IOCMD_LOG_LOCK_FREE_STAGING && (IOCMD_LOG_NUM_CONTEXT_STAGING_RINGS > 0))
+   result |= main_context_rings_test();
+#endif
+
+#if(IOCMD_LOG_PROFILER)
+   result |= main_prof_test();
+#endif
+
+#if(IOCMD_LOG_TRACE_EXPORT)
+   result |= main_trace_test();
+#endif
+
+#if(IOCMD_LOG_DATA_COMPRESSION)
+   result |= main_compression_test();
+#endif
+
+#if(IOCMD_LOG_DATA_FRAGMENTATION)
+   result |= main_fragmentation_test();
+#endif
+
+#if(IOCMD_LOG_REMOVE_LOGS_IN_BATCHES)
+   result |= main_batch_removal_test();
+#endif
+
+#if(IOCMD_LOG_EXTERNAL_BUF_MEMORY)
+   result |= main_too_small_memory_test();
+   result |= main_shrink_memory_test();
+#if(IOCMD_LOG_SINGLE_STORAGE)
+   result |= main_single_storage_test();
+#endif
+#endif
+
+#if(IOCMD_LOG_HIGH_RES_TIME)
+   if(argc > 1)
+   {
+      result |= main_time_test(argv[1]);
+   }
+#endif
+
+#if(IOCMD_LOG_CALL_SITE_DESCRIPTORS)
+   result |= main_call_sites_test();
+#endif
+
+#ifdef TEST_LOG_CPP
+   result |= main_cpp_test();
+#endif
+
+#if(IOCMD_LOG_INLINE_LEVEL_CHECK)
+   /* arguments of disabled logs are not evaluated */
+   if(1 == main_num_evaluations)
+   {
+      printf("inline level check test finished successfully\n");
+   }
+   else
+   {
+      printf("inline level check test NOK\n");
+      result = 1;
+   }
+#endif
+
+   /* changes levels of logs - executed as last one */
+   result |= main_levels_test();
+
+   return result;
+}
@@ -0,0 +1,45 @@
+/** ---------------------------------------- LICENSE SECTION -------------------------------------------------------------------
+ *
+ * Copyright (c) 2018 Piotr Wojtowicz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * -----------------------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * Part of test application compiled as C++ (make config_cpp): logs are stored through iocmd_log.hpp, which captures
+ * types of log arguments by templates instead of C11 _Generic.
+ */
+
+#include "iocmd_log.hpp"
+
+static_assert(
+   (IOCMD_LOG_ARG_INT | (IOCMD_LOG_ARG_STRING << 4) | (IOCMD_LOG_ARG_DOUBLE << 8) | (IOCMD_LOG_ARG_LONG << 12)
+      | (IOCMD_LOG_ARG_POINTER << 16))
+   == IOCMD_LOG_CALL_SITE_ARG_TYPES("%d %s %f %ld %p", 'a', "text", 2.5f, -7L, (const void*)0),
+   "types of arguments captured by templates");
+
+extern "C" void main_cpp_store_logs(void)
+{
+   const char *text = "text";
+
+   IOCMD_ALERT_4(MAIN_APP, "c++ typed args: %d %s %u %ld", 5, text, 3U, -7L);
+}
@@ -1,6 +1,10 @@
 #include "iocmd.h"
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
 
 typedef union
 {
@@ -111,6 +115,17 @@ IOCMD_Print_Exe_Params_XT *main_get_exe(void)
    return(&main_out);
 }
 
+#if(IOCMD_OUT_FORMAT_CACHE_SIZE > 0)
+bool_t main_is_format_constant(const char *format)
+{
+   /* symbols provided by GNU linker - constant strings are located between begining of program and end of initialized data */
+   extern const char __executable_start[];
+   extern const char edata[];
+
+   return ((format >= __executable_start) && (format < edata)) ? true : false;
+}
+#endif
+
 bool_t check_results(bool_t print_correct_result)
 {
    bool_t failed = false;
@@ -1374,6 +1389,99 @@ static void floating_test(void)
    double f = 1.2;
    long double ff = 1.23;
    bool_t failed = false;
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+   static const char * const formats[] =
+   {
+      "%f", "%F", "%.0f", "%#.0f", "%.3f", "%+.10f", "% 12.4f", "%-12.2f|", "%012.3f", "%.20f",
+      "%e", "%E", "%.0e", "%#.0e", "%+.12e", "%-15.3e|", "%015.4E", "%.30e",
+      "%.3g", "%#.3g", "%.10g", "%+.17g", "%12.5G", "%-12.1g|", "%#.0g", "%012.4g",
+      "%a", "%A", "%.0a", "%.3a", "%+20.2a", "%#a", "%020a", "%-14a|", "%.15A"
+   };
+   static const double values[] =
+   {
+      0.0, -0.0, 1.0, -1.5, 0.5, 2.5, 0.125, 1e-5, 123456.789, 9.9999999, 0.1, 1e22, 1e100, -3.14159265358979,
+      1.7976931348623157e308, 2.2250738585072014e-308, 4.9406564584124654e-324, HUGE_VAL, -HUGE_VAL, NAN
+   };
+#if(IOCMD_OUT_FLOATING_POINT_SHORTEST_G)
+   static const struct
+   {
+      double      value;
+      const char *result;
+   }shortest[] =
+   {
+      { 0.0,                     "0"                        },
+      { 0.1,                     "0.1"                      },
+      { 0.1 + 0.2,               "0.30000000000000004"      },
+      { -2.5,                    "-2.5"                     },
+      { 100.0,                   "100"                      },
+      { 1e6,                     "1000000"                  },
+      { 1234567.5,               "1234567.5"                },
+      { 1e16,                    "10000000000000000"        },
+      { 123456789012345680.0,    "1.2345678901234568e+17"   },
+      { 0.0001,                  "0.0001"                   },
+      { 1e-5,                    "1e-05"                    },
+      { 5e-324,                  "5e-324"                   },
+      { 1.7976931348623157e308,  "1.7976931348623157e+308"  }
+   };
+#endif
+   size_t format_cntr;
+   size_t value_cntr;
+   int sprintf_pos;
+   int iocmd_pos;
+
+   for(format_cntr = 0; format_cntr < (sizeof(formats) / sizeof(formats[0])); format_cntr++)
+   {
+      for(value_cntr = 0; value_cntr < (sizeof(values) / sizeof(values[0])); value_cntr++)
+      {
+         sprintf(sprintf_result,              formats[format_cntr], values[value_cntr]);
+         IOCMD_Printf(                        formats[format_cntr], values[value_cntr]);
+         IOCMD_Snprintf(table, sizeof_table,  formats[format_cntr], values[value_cntr]);
+         failed |= check_results(false);
+      }
+   }
+
+   sprintf(sprintf_result,              "double:%.2f; teraz int: %d; %s", 2.675, 123, "ok");
+   IOCMD_Printf(                        "double:%.2f; teraz int: %d; %s", 2.675, 123, "ok");
+   IOCMD_Snprintf(table, sizeof_table,  "double:%.2f; teraz int: %d; %s", 2.675, 123, "ok");
+   failed |= check_results(false);
+
+   sprintf(sprintf_result,              "double:%*.*e; teraz int: %d", 15, 3, 6.02214076e23, 124);
+   IOCMD_Printf(                        "double:%*.*e; teraz int: %d", 15, 3, 6.02214076e23, 124);
+   IOCMD_Snprintf(table, sizeof_table,  "double:%*.*e; teraz int: %d", 15, 3, 6.02214076e23, 124);
+   failed |= check_results(false);
+
+   /* long double is printed after conversion to double */
+   sprintf(sprintf_result,              "double:%f %e %g %a; teraz int: %d", (double)ff, (double)ff, (double)ff, (double)ff, 131);
+   IOCMD_Printf(                        "double:%Lf %Le %Lg %La; teraz int: %d", ff, ff, ff, ff, 131);
+   IOCMD_Snprintf(table, sizeof_table,  "double:%Lf %Le %Lg %La; teraz int: %d", ff, ff, ff, ff, 131);
+   failed |= check_results(false);
+
+   sprintf(sprintf_result,              "pos:%.3e%n", f, &sprintf_pos);
+   IOCMD_Printf(                        "pos:%.3e%n", f, &iocmd_pos);
+   IOCMD_Snprintf(table, sizeof_table,  "pos:%.3e%n", f, &iocmd_pos);
+   failed |= check_results(false);
+
+   if(sprintf_pos != iocmd_pos)
+   {
+      printf("%%n after floating point: %d != %d test NOK\n\r", sprintf_pos, iocmd_pos);
+      failed = true;
+   }
+
+#if(IOCMD_OUT_FLOATING_POINT_SHORTEST_G)
+   for(value_cntr = 0; value_cntr < (sizeof(shortest) / sizeof(shortest[0])); value_cntr++)
+   {
+      strcpy(sprintf_result, shortest[value_cntr].result);
+      IOCMD_Printf(                        "%g", shortest[value_cntr].value);
+      IOCMD_Snprintf(table, sizeof_table,  "%g", shortest[value_cntr].value);
+      failed |= check_results(false);
+   }
+
+   sprintf(sprintf_result,              "[%s] [%s]", "1E-07", "  -0.25");
+   IOCMD_Printf(                        "[%G] [%7g]", 1e-7, -0.25);
+   IOCMD_Snprintf(table, sizeof_table,  "[%G] [%7g]", 1e-7, -0.25);
+   failed |= check_results(false);
+#endif
+#else
 
    sprintf(sprintf_result,              "double:%%f; teraz int: %d", 123);
    IOCMD_Printf(                        "double:%f; teraz int: %d", f, 123);
@@ -1490,6 +1598,460 @@ static void floating_test(void)
    IOCMD_Snprintf(table, sizeof_table,  "double:%LA; teraz int: %d", ff, 131);
    failed |= check_results(false);
 
+#endif
+
+   if(!failed)
+   {
+      printf("%s finished successfully\n\r", __FUNCTION__);
+   }
+}
+
+#if(IOCMD_OUT_FORMAT_CACHE_SIZE > 0)
+static void format_cache_test(void)
+{
+   IOCMD_Format_Cache_Stats_XT stats_before;
+   IOCMD_Format_Cache_Stats_XT stats_after;
+   const char *cached_format = "cache: [%5d] %-6s %% %c;";
+   char *table = iocmd_snprintf_result;
+   size_t sizeof_table = sizeof(iocmd_snprintf_result);
+   char format[64];
+   int cntr;
+   bool_t failed = false;
+
+   IOCMD_Get_Format_Cache_Stats(&stats_before);
+
+   for(cntr = 0; cntr < 3; cntr++)
+   {
+      sprintf(sprintf_result,              cached_format, cntr, "abc", 'x' + cntr);
+      IOCMD_Printf(                        cached_format, cntr, "abc", 'x' + cntr);
+      IOCMD_Snprintf(table, sizeof_table,  cached_format, cntr, "abc", 'x' + cntr);
+      failed |= check_results(false);
+   }
+
+   IOCMD_Get_Format_Cache_Stats(&stats_after);
+
+   /* first call compiles format, next 5 calls use already compiled one */
+   if((stats_after.misses != (stats_before.misses + 1)) || (stats_after.hits != (stats_before.hits + 5))
+      || (stats_after.used_entries != (stats_before.used_entries + 1)))
+   {
+      printf("format cache: hits %u -> %u, misses %u -> %u test NOK\n\r",
+         stats_before.hits, stats_after.hits, stats_before.misses, stats_after.misses);
+      failed = true;
+   }
+
+   /* format too long to be cached */
+   for(cntr = 0; cntr < 2; cntr++)
+   {
+      sprintf(sprintf_result,              "%d %d %d %d %d %d %d %d %d %d", cntr, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+      IOCMD_Printf(                        "%d %d %d %d %d %d %d %d %d %d", cntr, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+      IOCMD_Snprintf(table, sizeof_table,  "%d %d %d %d %d %d %d %d %d %d", cntr, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+      failed |= check_results(false);
+   }
+
+   IOCMD_Get_Format_Cache_Stats(&stats_before);
+
+   /* not cacheable format occupies its entry, so it is counted as used, but it is never a hit */
+   if((stats_before.used_entries != (stats_after.used_entries + 1)) || (stats_before.hits != stats_after.hits)
+      || (stats_before.misses != (stats_after.misses + 4)))
+   {
+      printf("format cache: too long format counted wrong test NOK\n\r");
+      failed = true;
+   }
+
+   stats_after = stats_before;
+
+#if(IOCMD_OUT_SUPPORT_FLOATING_POINT)
+   /* format with floating point parameter is cached like any other */
+   for(cntr = 0; cntr < 2; cntr++)
+   {
+      sprintf(sprintf_result,              "double:%f; int: %d", 1.5, cntr);
+      IOCMD_Printf(                        "double:%f; int: %d", 1.5, cntr);
+      IOCMD_Snprintf(table, sizeof_table,  "double:%f; int: %d", 1.5, cntr);
+      failed |= check_results(false);
+   }
+
+   IOCMD_Get_Format_Cache_Stats(&stats_before);
+
+   if((stats_before.used_entries != (stats_after.used_entries + 1)) || (stats_before.hits != (stats_after.hits + 3)))
+   {
+      printf("format cache: format with floating point parameter has not been cached test NOK\n\r");
+      failed = true;
+   }
+#else
+   /* format with not supported parameter is also not cached, but occupies its entry */
+   for(cntr = 0; cntr < 2; cntr++)
+   {
+      sprintf(sprintf_result,              "double:%%f; int: %d", cntr);
+      IOCMD_Printf(                        "double:%f; int: %d", 1.5, cntr);
+      IOCMD_Snprintf(table, sizeof_table,  "double:%f; int: %d", 1.5, cntr);
+      failed |= check_results(false);
+   }
+
+   IOCMD_Get_Format_Cache_Stats(&stats_before);
+
+   if((stats_before.used_entries != (stats_after.used_entries + 1)) || (stats_before.hits != stats_after.hits))
+   {
+      printf("format cache: not cacheable format has been cached test NOK\n\r");
+      failed = true;
+   }
+#endif
+
+   /* format located in RAM must not be cached - it is modified between calls */
+   for(cntr = 0; cntr < 3; cntr++)
+   {
+      sprintf(format, "ram %%0%dd:%%s", cntr + 2);
+      sprintf(sprintf_result,              format, cntr, "ok");
+      IOCMD_Printf(                        format, cntr, "ok");
+      IOCMD_Snprintf(table, sizeof_table,  format, cntr, "ok");
+      failed |= check_results(false);
+   }
+
+   IOCMD_Get_Format_Cache_Stats(&stats_after);
+
+   if((stats_before.used_entries != stats_after.used_entries) || (stats_before.hits != stats_after.hits)
+      || (stats_before.misses != stats_after.misses) || (IOCMD_OUT_FORMAT_CACHE_SIZE != stats_after.size))
+   {
+      printf("format cache: format from RAM has been cached test NOK\n\r");
+      failed = true;
+   }
+
+   if(!failed)
+   {
+      printf("%s finished successfully\n\r", __FUNCTION__);
+   }
+}
+#endif
+
+#if(IOCMD_OUT_USE_BUFFERED_EXE)
+static char   buffered_exe_test_result[1024];
+static int    buffered_exe_test_result_pos;
+static int    buffered_exe_test_num_calls;
+
+static int buffered_exe_test_output(void *sink, const char *data, int size)
+{
+   memcpy(&buffered_exe_test_result[buffered_exe_test_result_pos], data, size);
+   buffered_exe_test_result_pos += size;
+   buffered_exe_test_result[buffered_exe_test_result_pos] = 0;
+
+   return size;
+}
+
+static int buffered_exe_test_count_text(void *dev, const char *string)
+{
+   buffered_exe_test_num_calls++;
+   return main_print_text(dev, string);
+}
+
+static int buffered_exe_test_count_text_repeat(void *dev, const char *string, int num_repeats)
+{
+   buffered_exe_test_num_calls++;
+   return main_print_text_repeat(dev, string, num_repeats);
+}
+
+static int buffered_exe_test_count_text_len(void *dev, const char *string, int str_len)
+{
+   buffered_exe_test_num_calls++;
+   return main_print_text_len(dev, string, str_len);
+}
+
+static void buffered_exe_test_count_endline_repeat(void *dev, int num_repeats)
+{
+   buffered_exe_test_num_calls++;
+   main_print_endline_repeat(dev, num_repeats);
+}
+
+static void buffered_exe_test_count_cariage_return(void *dev)
+{
+   buffered_exe_test_num_calls++;
+   main_print_cariage_return(dev);
+}
+
+static bool_t buffered_exe_test_check(const char *expected, uint32_t num_writes, uint32_t expected_num_writes, int line)
+{
+   bool_t failed = false;
+
+   if((0 != strcmp(expected, buffered_exe_test_result)) || (num_writes != expected_num_writes))
+   {
+      printf("line %d: expected: \"%s\" in %u writes, result: \"%s\" in %u writes test NOK\n\r",
+         line, expected, expected_num_writes, buffered_exe_test_result, num_writes);
+      failed = true;
+   }
+
+   buffered_exe_test_result_pos = 0;
+   buffered_exe_test_result[0]  = 0;
+
+   return failed;
+}
+
+static void buffered_exe_test(void)
+{
+   IOCMD_Print_Exe_Params_XT counting_exe = {
+      NULL,
+      buffered_exe_test_count_text,
+      buffered_exe_test_count_text_repeat,
+      buffered_exe_test_count_text_len,
+      buffered_exe_test_count_endline_repeat,
+      buffered_exe_test_count_cariage_return};
+   IOCMD_Buffered_Exe_XT bexe;
+   const char *format = "%-12s|%8d|%08X|%c|%-6s";
+   char buf[128];
+   char small_buf[64];
+   char expected[512];
+#if(IOCMD_OUT_BUFFERED_EXE_SUPPORT_POSIX_FD)
+   int pipe_fd[2];
+   int len;
+#endif
+   bool_t failed = false;
+
+   buffered_exe_test_result_pos = 0;
+
+   IOCMD_Buffered_Exe_Init(&bexe, buf, sizeof(buf), buffered_exe_test_output, NULL);
+
+   /* whole line passed to the device by single call */
+   sprintf(expected, format, "name", 1234, 0xBEEF, 'z', "end");
+   strcat(expected, IOCMD_ENDLINE);
+   IOCMD_Oprintf_Line(&bexe.exe, format, "name", 1234, 0xBEEF, 'z', "end");
+   failed |= buffered_exe_test_check(expected, bexe.num_writes, 1, __LINE__);
+
+   /* text without end of line stays in staging buffer until flush */
+   bexe.num_writes = 0;
+   sprintf(expected, "part %5d;", 7);
+   IOCMD_Oprintf(&bexe.exe, "part %5d;", 7);
+   if((0 != bexe.num_writes) || (0 != buffered_exe_test_result_pos))
+   {
+      printf("line %d: text passed to the device before end of line test NOK\n\r", __LINE__);
+      failed = true;
+   }
+   (void)IOCMD_Buffered_Exe_Flush(&bexe);
+   failed |= buffered_exe_test_check(expected, bexe.num_writes, 1, __LINE__);
+
+   /* line longer than staging buffer */
+   IOCMD_Buffered_Exe_Init(&bexe, small_buf, sizeof(small_buf), buffered_exe_test_output, NULL);
+   sprintf(expected, "long:%200d:%s", 5, "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123456789");
+   strcat(expected, IOCMD_ENDLINE);
+   IOCMD_Oprintf_Line(&bexe.exe, "long:%200d:%s", 5, "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123456789");
+   failed |= buffered_exe_test_check(expected, bexe.num_writes, (strlen(expected) + sizeof(small_buf) - 1) / sizeof(small_buf), __LINE__);
+
+#if(IOCMD_OUT_BUFFERED_EXE_SUPPORT_POSIX_FD)
+   /* POSIX file descriptor backend */
+   if(0 == pipe(pipe_fd))
+   {
+      IOCMD_Buffered_Exe_Init_Fd(&bexe, buf, sizeof(buf), pipe_fd[1]);
+      sprintf(expected, format, "fd", -56, 0x12, 'q', "pipe");
+      strcat(expected, IOCMD_ENDLINE);
+      IOCMD_Oprintf_Line(&bexe.exe, format, "fd", -56, 0x12, 'q', "pipe");
+      len = read(pipe_fd[0], buffered_exe_test_result, sizeof(buffered_exe_test_result) - 1);
+      buffered_exe_test_result[(len > 0) ? len : 0] = 0;
+      failed |= buffered_exe_test_check(expected, bexe.num_writes, 1, __LINE__);
+      close(pipe_fd[0]);
+      close(pipe_fd[1]);
+   }
+   else
+   {
+      printf("line %d: pipe cannot be created test NOK\n\r", __LINE__);
+      failed = true;
+   }
+#endif
+
+   /* number of device calls needed for the same line without buffering */
+   buffered_exe_test_num_calls = 0;
+   IOCMD_Oprintf_Line(&counting_exe, format, "name", 1234, 0xBEEF, 'z', "end");
+   printf("device calls per line: %d without buffering, 1 with buffering\n\r", buffered_exe_test_num_calls);
+
+   if(!failed)
+   {
+      printf("%s finished successfully\n\r", __FUNCTION__);
+   }
+}
+#endif
+
+static int snprintf_size_test_local_vsnprintf(char *buf, size_t buf_size, const char *format, ...)
+{
+   va_list arguments;
+   int result;
+
+   va_start(arguments, format);
+
+   result = IOCMD_Vsnprintf(buf, buf_size, format, arguments);
+
+   va_end(arguments);
+
+   return result;
+}
+
+static void snprintf_size_test(void)
+{
+   const char *format = "%-12s|%8d|%08X|%c|%.3s|%5.2s|%%|%-4u";
+   char expected[128];
+   char buf[128];
+   char *dynamic;
+   int expected_len;
+   int len;
+   size_t size;
+   bool_t failed = false;
+
+   expected_len = snprintf(expected, sizeof(expected), format, "name", -1234, 0xBEEF, 'z', "truncate", "ab", 77U);
+
+   /* only length is computed */
+   len = IOCMD_Snprintf(NULL, 0, format, "name", -1234, 0xBEEF, 'z', "truncate", "ab", 77U);
+   if(len != expected_len)
+   {
+      printf("line %d: IOCMD_Snprintf(NULL, 0) returned %d instead of %d test NOK\n\r", __LINE__, len, expected_len);
+      failed = true;
+   }
+   len = snprintf_size_test_local_vsnprintf(NULL, 0, format, "name", -1234, 0xBEEF, 'z', "truncate", "ab", 77U);
+   if(len != expected_len)
+   {
+      printf("line %d: IOCMD_Vsnprintf(NULL, 0) returned %d instead of %d test NOK\n\r", __LINE__, len, expected_len);
+      failed = true;
+   }
+
+   /* every size of the buffer - from nothing written, through truncated output to whole output */
+   for(size = 0; size <= (size_t)(expected_len + 2); size++)
+   {
+      memset(buf, '#', sizeof(buf));
+      len = IOCMD_Snprintf(buf, size, format, "name", -1234, 0xBEEF, 'z', "truncate", "ab", 77U);
+      memset(expected, '#', sizeof(expected));
+      (void)snprintf(expected, size, format, "name", -1234, 0xBEEF, 'z', "truncate", "ab", 77U);
+      if((len != expected_len) || (0 != memcmp(buf, expected, sizeof(buf))))
+      {
+         printf("line %d: buf_size %d: IOCMD_Snprintf returned %d: \"%.*s\" test NOK\n\r", __LINE__, (int)size, len, (int)size, buf);
+         failed = true;
+      }
+   }
+
+   /* buffer sized by the first call */
+   len = IOCMD_Snprintf(NULL, 0, "%s:%*d", "dynamic", 40, 5);
+   dynamic = malloc(len + 1);
+   if(len != IOCMD_Snprintf(dynamic, len + 1, "%s:%*d", "dynamic", 40, 5))
+   {
+      printf("line %d: second IOCMD_Snprintf returned different length test NOK\n\r", __LINE__);
+      failed = true;
+   }
+   (void)snprintf(expected, sizeof(expected), "%s:%*d", "dynamic", 40, 5);
+   if(0 != strcmp(dynamic, expected))
+   {
+      printf("line %d: \"%s\" instead of \"%s\" test NOK\n\r", __LINE__, dynamic, expected);
+      failed = true;
+   }
+   free(dynamic);
+
+   if(!failed)
+   {
+      printf("%s finished successfully\n\r", __FUNCTION__);
+   }
+}
+
+static void literal_scan_test(void)
+{
+   static const char literal_chars[] = "abcdefgh\x01\x7F\xFE\x80" "ABC #";
+   static const char *corpus[] =
+   {
+      "TEST:loop iteration...; a = %d, b = %s",
+      "Temporary state for logging: %d(%s)",
+      "IOCMD_ENTER_FUNC(MAIN_APP); finished",
+      "dummy; num additional hex bytes: %d",
+      "  rest of data was cut during logging at %d",
+      "Logs abbreviations description: CL - console level, CQ - quiet level, CE - entrance %d",
+      "test modulu IOCMD_OUT; str_ptr: %X",
+      "%4d -> %s - CL: console / CQ: quiet / CE: entrance / L: log level",
+      "main.c:58   ;     ALERT:: data log %d of %s",
+      "Entrances possible states:"
+   };
+   static const char *terminators[] = {"%dZ", "\nZ", "\rZ", ""};
+   char format_buf[IOCMD_MAX_STRING_LENGTH + 64];
+   char ram_corpus[sizeof(corpus) / sizeof(corpus[0])][128];
+   char expected[IOCMD_MAX_STRING_LENGTH + 64];
+   char out[IOCMD_MAX_STRING_LENGTH + 64];
+   char *format;
+   struct timespec start;
+   struct timespec end;
+   size_t offset;
+   size_t len;
+   size_t cntr;
+   size_t term;
+   int loop;
+   bool_t failed = false;
+
+   /* literal of every length, starting from every alignment, ended by every kind of stop character */
+   for(offset = 0; offset < 16; offset++)
+   {
+      for(len = 0; len < 40; len++)
+      {
+         for(term = 0; term < (sizeof(terminators) / sizeof(terminators[0])); term++)
+         {
+            format = &format_buf[offset];
+            for(cntr = 0; cntr < len; cntr++)
+            {
+               format[cntr] = literal_chars[(cntr + offset) % (sizeof(literal_chars) - 1)];
+            }
+            strcpy(&format[len], terminators[term]);
+
+            if(0 == term)
+            {
+               memcpy(expected, format, len);
+               strcpy(&expected[len], "5Z");
+            }
+            else if(1 == term)
+            {
+               memcpy(expected, format, len);
+               strcpy(&expected[len], IOCMD_ENDLINE "Z");
+            }
+            else if(2 == term)
+            {
+               /* cariage return moves IOCMD_Snprintf back to begining of the buffer */
+               strcpy(expected, "Z");
+            }
+            else
+            {
+               memcpy(expected, format, len);
+               expected[len] = '\0';
+            }
+
+            (void)IOCMD_Snprintf(out, sizeof(out), format, 5);
+            if(0 != strcmp(out, expected))
+            {
+               printf("line %d: offset %d, length %d, terminator %d: \"%s\" instead of \"%s\" test NOK\n\r",
+                  __LINE__, (int)offset, (int)len, (int)term, out, expected);
+               failed = true;
+            }
+         }
+      }
+   }
+
+   /* literal longer than IOCMD_MAX_STRING_LENGTH is cut exactly on the limit */
+   for(offset = 0; offset < 8; offset++)
+   {
+      format = &format_buf[offset];
+      memset(format, 'x', IOCMD_MAX_STRING_LENGTH + 40);
+      format[IOCMD_MAX_STRING_LENGTH + 40] = '\0';
+      len = (size_t)IOCMD_Snprintf(out, sizeof(out), format);
+      if((IOCMD_MAX_STRING_LENGTH != len) || (IOCMD_MAX_STRING_LENGTH != strlen(out)))
+      {
+         printf("line %d: offset %d: %d characters printed instead of %d test NOK\n\r",
+            __LINE__, (int)offset, (int)len, IOCMD_MAX_STRING_LENGTH);
+         failed = true;
+      }
+   }
+
+   /* formats from RAM are not cached, so every call scans literals */
+   for(cntr = 0; cntr < (sizeof(corpus) / sizeof(corpus[0])); cntr++)
+   {
+      strcpy(ram_corpus[cntr], corpus[cntr]);
+   }
+   clock_gettime(CLOCK_MONOTONIC, &start);
+   for(loop = 0; loop < 20000; loop++)
+   {
+      for(cntr = 0; cntr < (sizeof(corpus) / sizeof(corpus[0])); cntr++)
+      {
+         (void)IOCMD_Snprintf(out, sizeof(out), ram_corpus[cntr], loop, "text");
+      }
+   }
+   clock_gettime(CLOCK_MONOTONIC, &end);
+   printf("IOCMD_Snprintf ns per not cached format: %.1f\n\r",
+      ((double)(end.tv_sec - start.tv_sec) * 1e9 + (double)(end.tv_nsec - start.tv_nsec))
+         / (20000.0 * (double)(sizeof(corpus) / sizeof(corpus[0]))));
+
    if(!failed)
    {
       printf("%s finished successfully\n\r", __FUNCTION__);
@@ -1630,6 +2192,219 @@ static void wrong_order_test(void)
    }
 }
 
+static bool_t utoa_test_check(const char *name, uint64_t value, uint_fast8_t base, uint_fast8_t num_pads, char pad, bool_t is_upper_case, const char *result, int length)
+{
+   char expected[48];
+   const char *format;
+   bool_t failed = false;
+
+   if(10 == base)
+   {
+      format = ('0' == pad) ? "%0*llu" : "%*llu";
+   }
+   else if(16 == base)
+   {
+      if(is_upper_case)
+      {
+         format = ('0' == pad) ? "%0*llX" : "%*llX";
+      }
+      else
+      {
+         format = ('0' == pad) ? "%0*llx" : "%*llx";
+      }
+   }
+   else
+   {
+      format = ('0' == pad) ? "%0*llo" : "%*llo";
+   }
+
+   sprintf(expected, format, (int)num_pads, (unsigned long long)value);
+
+   if((0 != strcmp(expected, result)) || ((int)strlen(expected) != length))
+   {
+      printf("%s(%llu, base %u, pads %u, '%c'): \"%s\" (%d) expected: \"%s\" test NOK\n\r",
+         name, (unsigned long long)value, (unsigned)base, (unsigned)num_pads, pad, result, length, expected);
+      failed = true;
+   }
+
+   return failed;
+}
+
+static bool_t utoa_test_value(uint64_t value, uint_fast8_t width)
+{
+   static const uint_fast8_t bases[] = {8, 10, 16};
+   static const uint_fast8_t pads[]  = {0, 3, 12, 25};
+   char result[48];
+   int length;
+   uint_fast8_t base_cntr;
+   uint_fast8_t pad_cntr;
+   uint_fast8_t num_pads;
+   char pad;
+   bool_t is_upper_case;
+   bool_t failed = false;
+
+   for(base_cntr = 0; base_cntr < (sizeof(bases) / sizeof(bases[0])); base_cntr++)
+   {
+      for(pad_cntr = 0; pad_cntr < (sizeof(pads) / sizeof(pads[0])); pad_cntr++)
+      {
+#if(IOCMD_UTOA_USE_DIGIT_PAIRS)
+         num_pads      = pads[pad_cntr];
+#else
+         /* zero without pads gives empty string */
+         num_pads      = ((0 == value) && (0 == pads[pad_cntr])) ? 1 : pads[pad_cntr];
+#endif
+         pad           = (0 != (pad_cntr & 1)) ? '0' : ' ';
+         is_upper_case = (0 != (value & 1)) ? true : false;
+
+         memset(result, 0x55, sizeof(result));
+
+         if(8 == width)
+         {
+            length = IOCMD_Utoa8(result, (uint8_t)value, bases[base_cntr], num_pads, pad, is_upper_case);
+            failed |= utoa_test_check("IOCMD_Utoa8", value, bases[base_cntr], num_pads, pad, is_upper_case, result, length);
+         }
+         else if(16 == width)
+         {
+            length = IOCMD_Utoa16(result, (uint16_t)value, bases[base_cntr], num_pads, pad, is_upper_case);
+            failed |= utoa_test_check("IOCMD_Utoa16", value, bases[base_cntr], num_pads, pad, is_upper_case, result, length);
+         }
+         else if(32 == width)
+         {
+            length = IOCMD_Utoa32(result, (uint32_t)value, bases[base_cntr], num_pads, pad, is_upper_case);
+            failed |= utoa_test_check("IOCMD_Utoa32", value, bases[base_cntr], num_pads, pad, is_upper_case, result, length);
+         }
+         else
+         {
+            length = IOCMD_Utoa64(result, value, bases[base_cntr], num_pads, pad, is_upper_case);
+            failed |= utoa_test_check("IOCMD_Utoa64", value, bases[base_cntr], num_pads, pad, is_upper_case, result, length);
+         }
+      }
+   }
+
+   return failed;
+}
+
+static uint64_t utoa_test_random(uint64_t *seed)
+{
+   *seed ^= *seed << 13;
+   *seed ^= *seed >> 7;
+   *seed ^= *seed << 17;
+
+   /* random number of significant bits to test every length of result */
+   return *seed >> (*seed % 64);
+}
+
+static void utoa_test_benchmark(uint_fast8_t width)
+{
+   static const uint_fast8_t bases[] = {8, 10, 16};
+   struct timespec start;
+   struct timespec end;
+   char result[48];
+   uint64_t seed = 0x9E3779B97F4A7C15ULL;
+   uint64_t values[256];
+   volatile int sink = 0;
+   double ns[3];
+   uint_fast8_t base_cntr;
+   int cntr;
+
+   for(cntr = 0; cntr < 256; cntr++)
+   {
+      values[cntr] = utoa_test_random(&seed);
+   }
+
+   for(base_cntr = 0; base_cntr < (sizeof(bases) / sizeof(bases[0])); base_cntr++)
+   {
+      clock_gettime(CLOCK_MONOTONIC, &start);
+
+      for(cntr = 0; cntr < 200000; cntr++)
+      {
+         if(8 == width)
+         {
+            sink += IOCMD_Utoa8(result, (uint8_t)values[cntr & 0xFF], bases[base_cntr], 1, ' ', false);
+         }
+         else if(16 == width)
+         {
+            sink += IOCMD_Utoa16(result, (uint16_t)values[cntr & 0xFF], bases[base_cntr], 1, ' ', false);
+         }
+         else if(32 == width)
+         {
+            sink += IOCMD_Utoa32(result, (uint32_t)values[cntr & 0xFF], bases[base_cntr], 1, ' ', false);
+         }
+         else
+         {
+            sink += IOCMD_Utoa64(result, values[cntr & 0xFF], bases[base_cntr], 1, ' ', false);
+         }
+      }
+
+      clock_gettime(CLOCK_MONOTONIC, &end);
+
+      ns[base_cntr] = ((double)(end.tv_sec - start.tv_sec) * 1e9 + (double)(end.tv_nsec - start.tv_nsec)) / 200000.0;
+   }
+
+   printf("IOCMD_Utoa%u ns per conversion: oct %.1f, dec %.1f, hex %.1f\n\r", (unsigned)width, ns[0], ns[1], ns[2]);
+   (void)sink;
+}
+
+static void utoa_test(void)
+{
+   static const uint_fast8_t bases[] = {8, 10, 16};
+   uint64_t seed = 88172645463325252ULL;
+   uint64_t value;
+   uint64_t power;
+   uint_fast8_t base_cntr;
+   uint_fast8_t width;
+   uint32_t cntr;
+   bool_t failed = false;
+
+   /* all possible values of 8 and 16 bits */
+   for(cntr = 0; (cntr < 0x100) && !failed; cntr++)
+   {
+      failed |= utoa_test_value(cntr, 8);
+   }
+   for(cntr = 0; (cntr < 0x10000) && !failed; cntr++)
+   {
+      failed |= utoa_test_value(cntr, 16);
+   }
+
+   /* powers of base and values next to them, limits */
+   for(width = 32; width <= 64; width += 32)
+   {
+      for(base_cntr = 0; base_cntr < (sizeof(bases) / sizeof(bases[0])); base_cntr++)
+      {
+         for(power = 1; (0 != power) && (power <= (((uint64_t)(-1)) >> (64 - width))) && !failed; power *= bases[base_cntr])
+         {
+            failed |= utoa_test_value(power - 1, width);
+            failed |= utoa_test_value(power, width);
+            failed |= utoa_test_value(power + 1, width);
+
+            if(power > ((((uint64_t)(-1)) >> (64 - width)) / bases[base_cntr]))
+            {
+               break;
+            }
+         }
+      }
+      failed |= utoa_test_value(((uint64_t)(-1)) >> (64 - width), width);
+   }
+
+   for(cntr = 0; (cntr < 100000) && !failed; cntr++)
+   {
+      value = utoa_test_random(&seed);
+
+      failed |= utoa_test_value((uint32_t)value, 32);
+      failed |= utoa_test_value(value, 64);
+   }
+
+   for(width = 8; width <= 64; width *= 2)
+   {
+      utoa_test_benchmark(width);
+   }
+
+   if(!failed)
+   {
+      printf("%s finished successfully\n\r", __FUNCTION__);
+   }
+}
+
 static int printf_methods_params_test_local_vprintf(const char *format, ...)
 {
    va_list arguments;
@@ -1853,6 +2628,15 @@ int main(void)
    floating_test();
    unknown_test();
    wrong_order_test();
+#if(IOCMD_OUT_FORMAT_CACHE_SIZE > 0)
+   format_cache_test();
+#endif
+#if(IOCMD_OUT_USE_BUFFERED_EXE)
+   buffered_exe_test();
+#endif
+   snprintf_size_test();
+   literal_scan_test();
+   utoa_test();
    printf_methods_params_test();
 
    return 0;
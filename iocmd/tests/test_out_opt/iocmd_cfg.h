@@ -0,0 +1,53 @@
+/** ---------------------------------------- LICENSE SECTION -------------------------------------------------------------------
+ *
+ * Copyright (c) 2018 Piotr Wojtowicz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * -----------------------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef IOTERM_CFG_H_
+#define IOTERM_CFG_H_
+
+#include "cfg.h"
+
+#define IOCMD_USE_OUT
+//#define IOCMD_USE_LOG
+//#define IOCMD_USE_IN
+//#define IOCMD_USE_CMD
+
+#define IOCMD_OUT_MINIMAL_STACK_USAGE           true
+
+#define IOCMD_OUT_USE_BUFFERED_EXE              true
+#define IOCMD_OUT_BUFFERED_EXE_SUPPORT_POSIX_FD true
+
+#define IOCMD_UTOA_USE_DIGIT_PAIRS              true
+#define IOCMD_OUT_SCAN_FORMAT_BY_WORDS          true
+
+#define IOCMD_OUT_SUPPORT_FLOATING_POINT        true
+#define IOCMD_OUT_FLOATING_POINT_SHORTEST_G     true
+
+#define IOCMD_OUT_FORMAT_CACHE_SIZE             512
+#define IOCMD_OUT_IS_FORMAT_CACHEABLE(_format)  main_is_format_constant(_format)
+
+bool_t main_is_format_constant(const char *format);
+
+#endif
+